@@ -0,0 +1,156 @@
+/*
+  bench/bench.cpp - Harness Microbenchmark
+  Kalibrasi batch, pengukuran waktu (ns & cycle), penghitung alokasi operator new,
+  serta laporan Serial, CSV & JSON. Dipakai bersama oleh env 'bench' (host) dan
+  'bench_esp32' (perangkat).
+*/
+
+#include "bench.h"
+#include <algorithm>
+#include <math.h>
+#include <new>
+#include "components/hal/hal.h"
+#if HAL_HOST
+#include <chrono>
+#endif
+
+// --- Penghitung Alokasi ---
+// operator new global diganti agar setiap alokasi C++ (termasuk dari library) ikut
+// terhitung. Alokasi lewat malloc langsung (mis. buffer Arduino String) tidak terhitung.
+static bool allocCounting = false;
+static uint64_t allocCount = 0;
+static uint64_t allocBytes = 0;
+
+static void* countedAlloc(size_t size) {
+  if (allocCounting) {
+    allocCount++;
+    allocBytes += size;
+  }
+  void* block = malloc(size > 0 ? size : 1);
+  if (block == nullptr) abort(); // Setara std::bad_alloc, firmware dibangun tanpa exception
+  return block;
+}
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void operator delete(void* block) noexcept { free(block); }
+void operator delete[](void* block) noexcept { free(block); }
+void operator delete(void* block, size_t) noexcept { free(block); }
+void operator delete[](void* block, size_t) noexcept { free(block); }
+
+// --- Pengukuran Batch ---
+struct BenchBatch {
+  double ns;
+  double cycles; // NaN di host
+};
+
+static BenchBatch measureBatch(const BenchCase& benchCase, uint32_t iterations) {
+  BenchBatch batch;
+#if HAL_HOST
+  // Cycle counter host diturunkan dari clock HAL (µs, atau clock virtual), jadi di host
+  // waktu diambil langsung dari steady_clock
+  auto start = std::chrono::steady_clock::now();
+  benchCase.run(iterations);
+  batch.ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  batch.cycles = NAN;
+#else
+  // CCOUNT 32 bit wrap setiap ~17 detik @240 MHz, jauh di atas ukuran batch
+  uint32_t start = hal_cycle_count();
+  benchCase.run(iterations);
+  uint32_t elapsed = hal_cycle_count() - start;
+  batch.cycles = elapsed;
+  batch.ns = elapsed * 1000.0 / hal_cpu_mhz();
+#endif
+  return batch;
+}
+
+// Ukuran batch terkecil yang berjalan minimal BENCH_MIN_BATCH_US (batch kalibrasi sekaligus pemanasan)
+static uint32_t calibrate(const BenchCase& benchCase) {
+  const double targetNs = BENCH_MIN_BATCH_US * 1000.0;
+  uint32_t iterations = 1;
+  while (iterations < BENCH_MAX_ITERATIONS) {
+    double ns = measureBatch(benchCase, iterations).ns;
+    if (ns >= targetNs) break;
+    // Perkiraan dari batch ini (+20%), dibatasi x100 agar batch pertama yang terlalu cepat tidak menyesatkan
+    double scale = ns > 0 ? targetNs * 1.2 / ns : 100.0;
+    if (scale > 100.0) scale = 100.0;
+    if (scale < 2.0) scale = 2.0;
+    double next = iterations * scale;
+    iterations = next < BENCH_MAX_ITERATIONS ? (uint32_t)next : BENCH_MAX_ITERATIONS;
+    yield();
+  }
+  return iterations;
+}
+
+void bench_run(const BenchCase& benchCase, BenchResult& result) {
+  uint32_t iterations = calibrate(benchCase);
+
+  BenchBatch batches[BENCH_REPEATS];
+  allocCount = 0;
+  allocBytes = 0;
+  for (int i = 0; i < BENCH_REPEATS; i++) {
+    allocCounting = true;
+    batches[i] = measureBatch(benchCase, iterations);
+    allocCounting = false;
+    yield();
+  }
+
+  double operations = (double)iterations * BENCH_REPEATS;
+  std::sort(batches, batches + BENCH_REPEATS,
+            [](const BenchBatch& a, const BenchBatch& b) { return a.ns < b.ns; });
+  const BenchBatch& median = batches[BENCH_REPEATS / 2];
+
+  result.name = benchCase.name;
+  result.iterations = iterations;
+  result.nsPerOp = median.ns / iterations;
+  result.nsMin = batches[0].ns / iterations;
+  result.cyclesPerOp = median.cycles / iterations;
+  result.allocsPerOp = allocCount / operations;
+  result.bytesPerOp = allocBytes / operations;
+}
+
+// --- Laporan ---
+void bench_print(const BenchResult& result) {
+  Serial.printf("[BENCH] %-22s %10.1f ns/op (min %.1f)", result.name, result.nsPerOp, result.nsMin);
+  if (!isnan(result.cyclesPerOp)) Serial.printf(" %10.0f cycle/op", result.cyclesPerOp);
+  Serial.printf(" %6.2f alloc/op %8.1f B/op  n=%lu\n", result.allocsPerOp, result.bytesPerOp,
+                (unsigned long)result.iterations);
+}
+
+size_t bench_format_csv(const BenchResult& result, char* out, size_t size) {
+  char cycles[16] = "";
+  if (!isnan(result.cyclesPerOp)) snprintf(cycles, sizeof(cycles), "%.1f", result.cyclesPerOp);
+  int written = snprintf(out, size, "%s,%lu,%.2f,%.2f,%s,%.3f,%.1f", result.name,
+                         (unsigned long)result.iterations, result.nsPerOp, result.nsMin, cycles,
+                         result.allocsPerOp, result.bytesPerOp);
+  return written > 0 ? (size_t)written : 0;
+}
+
+void bench_write_json(JsonWriter& writer, const BenchResult* results, size_t count) {
+  writer.beginObject()
+#if HAL_HOST
+    .field("platform", "host")
+#else
+    .field("platform", "esp32")
+    .field("cpuMhz", (unsigned long)hal_cpu_mhz())
+#endif
+    .field("minBatchUs", (unsigned long)BENCH_MIN_BATCH_US)
+    .field("repeats", BENCH_REPEATS);
+  writer.beginArray("results");
+  for (size_t i = 0; i < count; i++) {
+    const BenchResult& result = results[i];
+    writer.beginObject()
+      .field("name", result.name)
+      .field("iterations", (unsigned long)result.iterations)
+      .field("nsPerOp", result.nsPerOp, 2)
+      .field("nsMin", result.nsMin, 2)
+      .field("cyclesPerOp", result.cyclesPerOp, 1)
+      .field("allocsPerOp", result.allocsPerOp, 3)
+      .field("bytesPerOp", result.bytesPerOp, 1)
+      .endObject();
+  }
+  writer.endArray();
+  writer.endObject();
+}
@@ -0,0 +1,58 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+
+// --- Microbenchmark Jalur Panas Firmware ---
+// Setiap kasus menjalankan operasinya 'iterations' kali per batch. Harness memperbesar
+// batch sampai minimal BENCH_MIN_BATCH_US, lalu mengukur BENCH_REPEATS batch berturut-turut.
+// Waktu diambil dari steady_clock di host dan dari cycle counter CPU (hal_cycle_count)
+// di ESP32. Alokasi dihitung lewat operator new pengganti selama batch terukur.
+#define BENCH_MIN_BATCH_US 20000
+#define BENCH_REPEATS 5
+#define BENCH_MAX_ITERATIONS (1UL << 26)
+#define BENCH_MAX_CASES 16
+#define BENCH_JSON_BUFFER_SIZE 2048
+#define BENCH_CSV_HEADER "name,iterations,ns_per_op,ns_min,cycles_per_op,allocs_per_op,bytes_per_op"
+
+typedef void (*BenchRun)(uint32_t iterations);
+
+struct BenchCase {
+  const char* name;
+  BenchRun run;
+};
+
+struct BenchResult {
+  const char* name;
+  uint32_t iterations; // Operasi per batch terukur
+  float nsPerOp;       // Median batch
+  float nsMin;         // Batch tercepat
+  float cyclesPerOp;   // Median batch dalam cycle CPU (NaN di host)
+  float allocsPerOp;   // Panggilan operator new per operasi
+  float bytesPerOp;    // Byte yang diminta operator new per operasi
+};
+
+// Mencegah compiler membuang hasil operasi yang tidak dipakai
+template <typename T>
+static inline void bench_keep(const T& value) {
+  asm volatile("" : : "r"(&value) : "memory");
+}
+
+// --- Kasus (bench_cases.cpp) ---
+/** @brief Menyiapkan komponen yang dipakai kasus (bus I2C, LCD, snapshot sensor). */
+void bench_cases_begin();
+/** @brief Daftar kasus bawaan; mengembalikan jumlahnya. */
+size_t bench_cases(const BenchCase** cases);
+
+// --- Harness (bench.cpp) ---
+/** @brief Kalibrasi ukuran batch lalu mengukur satu kasus. */
+void bench_run(const BenchCase& benchCase, BenchResult& result);
+/** @brief Satu baris ringkasan "[BENCH] <nama> ... ns/op" ke Serial. */
+void bench_print(const BenchResult& result);
+/** @brief Satu baris CSV (kolom sesuai BENCH_CSV_HEADER, tanpa newline). */
+size_t bench_format_csv(const BenchResult& result, char* out, size_t size);
+/** @brief {"platform","cpuMhz","results":[...]} untuk dibandingkan antar commit. */
+void bench_write_json(JsonWriter& writer, const BenchResult* results, size_t count);
+
+#endif // BENCH_H
@@ -0,0 +1,129 @@
+/*
+  bench/bench_cases.cpp - Kasus Microbenchmark Jalur Panas
+  Setiap kasus memanggil fungsi firmware yang sama dengan yang dijalankan task-nya:
+  serializer telemetri (task jaringan), format UID (task "rfid"), debounce front panel
+  (task "order"), konversi jarak HC-SR04 (task "sensors") dan render scene LCD
+  (antrean task kontrol + task "lcd").
+*/
+
+#include "bench.h"
+#include "components/i2c_bus/i2c_bus.h"
+#include "components/lcd_display/lcd_display.h"
+#include "components/machine_state/machine_state.h"
+#include "components/order_coffee/order_coffee.h"
+#include "components/order_coffee/port_debouncer.h"
+#include "components/rfid_card_reader/rfid_card_reader.h"
+#include "components/rtos_tasks/rtos_tasks.h"
+#include "components/storage_detector/storage_detector.h"
+#include "components/telemetry/telemetry.h"
+#include "components/temperature_humidity/temperature_humidity.h"
+
+// Sama dengan panelButtons di order_coffee.cpp (PB1..PB4 di P0..P3, sampel tiap 10 ms)
+#define BENCH_PANEL_MASK 0x0F
+#define BENCH_PANEL_POLL_MS 10
+
+// Kartu terdaftar (Torabika, Good Day, ABC Susu)
+static const uint8_t BENCH_CARDS[3][4] = {
+  {0x09, 0x1C, 0xD5, 0x4B},
+  {0xA9, 0x03, 0xE8, 0x4B},
+  {0xC9, 0x15, 0xEA, 0xA3}
+};
+
+// --- Telemetri ---
+// Pesan topik "telemetry" ke buffer statis berukuran sama dengan di main.cpp
+static void benchTelemetryJson(uint32_t iterations) {
+  static char buffer[TELEMETRY_JSON_BUFFER_SIZE];
+  for (uint32_t i = 0; i < iterations; i++) {
+    JsonWriter writer(buffer, sizeof(buffer));
+    writeTelemetryJson(writer);
+    bench_keep(writer.length());
+  }
+}
+
+// --- RFID ---
+static void benchFormatUid(uint32_t iterations) {
+  char uidText[RFID_UID_TEXT_LEN];
+  for (uint32_t i = 0; i < iterations; i++) {
+    formatRfidUid(BENCH_CARDS[i % 3], sizeof(BENCH_CARDS[0]), uidText, sizeof(uidText));
+    bench_keep(uidText);
+  }
+}
+
+// --- Debounce Front Panel ---
+// Panel diam: jalur yang dijalankan hampir setiap putaran task "order"
+static void benchDebounceIdle(uint32_t iterations) {
+  static PortDebouncer debouncer(BENCH_PANEL_MASK, PANEL_LONG_PRESS_MS / BENCH_PANEL_POLL_MS,
+                                 PANEL_DOUBLE_PRESS_MS / BENCH_PANEL_POLL_MS);
+  for (uint32_t i = 0; i < iterations; i++) {
+    ButtonEvents events = debouncer.update(0);
+    bench_keep(events);
+  }
+}
+
+// Klik PB1 dengan pantulan kontak saat ditekan & dilepas, lalu panel diam (64 sampel)
+static const uint8_t BENCH_CLICK_SAMPLES[64] = {
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static void benchDebounceClick(uint32_t iterations) {
+  static PortDebouncer debouncer(BENCH_PANEL_MASK, PANEL_LONG_PRESS_MS / BENCH_PANEL_POLL_MS,
+                                 PANEL_DOUBLE_PRESS_MS / BENCH_PANEL_POLL_MS);
+  for (uint32_t i = 0; i < iterations; i++) {
+    ButtonEvents events = debouncer.update(BENCH_CLICK_SAMPLES[i % sizeof(BENCH_CLICK_SAMPLES)]);
+    bench_keep(events);
+  }
+}
+
+// --- Sensor Jarak ---
+// Lebar pulsa ECHO (µs) -> jarak -> status stok: timeout, penuh, ambang 8 cm, hampir kosong
+static const long BENCH_ECHO_US[8] = {0, 176, 294, 411, 470, 529, 705, 823};
+
+static void benchDistanceStatus(uint32_t iterations) {
+  for (uint32_t i = 0; i < iterations; i++) {
+    long distance = storage_detector_distance_from_echo(BENCH_ECHO_US[i % 8]);
+    CoffeeStockStatus status = coffeeStockStatusFromDistance(distance);
+    bench_keep(status);
+  }
+}
+
+// --- LCD ---
+// Scene idle: 1 clear + 4 baris 20 karakter diantrekan, lalu dijalankan ke LCD lewat I2C.
+// Di host delay LCD tidak dihitung (clock virtual), di ESP32 termasuk waktu bus.
+static void benchLcdIdleScene(uint32_t iterations) {
+  for (uint32_t i = 0; i < iterations; i++) {
+    displayIdleMenu();
+    handleLcdDisplay(millis());
+  }
+}
+
+static const BenchCase BENCH_CASES[] = {
+  {"telemetry_json", benchTelemetryJson},
+  {"rfid_format_uid", benchFormatUid},
+  {"debounce_idle", benchDebounceIdle},
+  {"debounce_click", benchDebounceClick},
+  {"distance_status", benchDistanceStatus},
+  {"lcd_idle_scene", benchLcdIdleScene}
+};
+
+size_t bench_cases(const BenchCase** cases) {
+  *cases = BENCH_CASES;
+  return sizeof(BENCH_CASES) / sizeof(BENCH_CASES[0]);
+}
+
+void bench_cases_begin() {
+  setupRtosTasks();
+  setupI2cBus();
+  setupLCD();
+
+  // Snapshot sensor yang dibaca serializer telemetri: dua hopper terisi, satu timeout
+  telemetryDistance1 = 4;
+  telemetryDistance2 = 9;
+  telemetryDistance3 = 0;
+  currentTemperature = 27.5f;
+  currentHumidity = 61.0f;
+  formatRfidUid(BENCH_CARDS[0], sizeof(BENCH_CARDS[0]), currentRfidUid, RFID_UID_TEXT_LEN);
+  machine_state_publish_sensors();
+}
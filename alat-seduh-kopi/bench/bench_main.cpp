@@ -0,0 +1,139 @@
+/*
+  bench/bench_main.cpp - Program Microbenchmark
+  Host ('pio run -e bench' lalu '.pio/build/bench/program'):
+    --filter TEKS     hanya kasus yang namanya mengandung TEKS
+    --json PATH       hasil sebagai JSON ('-' = stdout)
+    --csv PATH        hasil sebagai CSV ('-' = stdout)
+  ESP32 ('pio run -e bench_esp32 -t upload -t monitor'): semua kasus dijalankan sekali
+  setelah boot; hasil dicetak sebagai baris "[BENCH_CSV] ..." dan satu baris
+  "[BENCH_JSON] {...}" yang bisa disalin dari log Serial.
+  Dua hasil JSON dibandingkan dengan 'python scripts/bench_compare.py lama.json baru.json'.
+*/
+
+#include <Arduino.h>
+#include "bench.h"
+#include "components/hal/hal.h"
+#if HAL_HOST
+#include "components/hal/hal_host.h"
+#endif
+
+// --- Stub Simbol main.cpp ---
+// Dipakai web_api & ws_command, yang ikut terhubung tetapi tidak pernah dipanggil di sini
+void requestWsSnapshot(unsigned int clientId) {}
+void toggleWebRelay() {}
+
+static BenchResult benchResults[BENCH_MAX_CASES];
+static char benchJsonBuffer[BENCH_JSON_BUFFER_SIZE];
+
+// Menjalankan kasus yang lolos filter (nullptr = semua); mengembalikan jumlah hasil
+static size_t runBenchmarks(const char* filter) {
+  const BenchCase* cases;
+  size_t caseCount = bench_cases(&cases);
+  size_t resultCount = 0;
+  for (size_t i = 0; i < caseCount && resultCount < BENCH_MAX_CASES; i++) {
+    if (filter != nullptr && strstr(cases[i].name, filter) == nullptr) continue;
+    bench_run(cases[i], benchResults[resultCount]);
+    bench_print(benchResults[resultCount]);
+    resultCount++;
+  }
+  return resultCount;
+}
+
+#if HAL_HOST
+// --- Host ---
+static const char* optionValue(int argc, char** argv, const char* name) {
+  for (int i = 1; i + 1 < argc; i++) {
+    if (strcmp(argv[i], name) == 0) return argv[i + 1];
+  }
+  return nullptr;
+}
+
+static FILE* openOutput(const char* path) {
+  FILE* out = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+  if (out == nullptr) fprintf(stderr, "[BENCH] Gagal menulis %s\n", path);
+  return out;
+}
+
+static void closeOutput(FILE* out) {
+  if (out != stdout) fclose(out);
+}
+
+static bool saveJson(const char* path, size_t count) {
+  JsonWriter writer(benchJsonBuffer, sizeof(benchJsonBuffer));
+  bench_write_json(writer, benchResults, count);
+  if (writer.overflowed()) {
+    fprintf(stderr, "[BENCH] Hasil JSON melebihi %d byte.\n", BENCH_JSON_BUFFER_SIZE);
+    return false;
+  }
+  FILE* out = openOutput(path);
+  if (out == nullptr) return false;
+  fprintf(out, "%s\n", writer.c_str());
+  closeOutput(out);
+  return true;
+}
+
+static bool saveCsv(const char* path, size_t count) {
+  FILE* out = openOutput(path);
+  if (out == nullptr) return false;
+  fprintf(out, "%s\n", BENCH_CSV_HEADER);
+  char row[160];
+  for (size_t i = 0; i < count; i++) {
+    bench_format_csv(benchResults[i], row, sizeof(row));
+    fprintf(out, "%s\n", row);
+  }
+  closeOutput(out);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  const char* jsonPath = optionValue(argc, argv, "--json");
+  const char* csvPath = optionValue(argc, argv, "--csv");
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+
+  // Log setup komponen tidak relevan untuk hasil; delay LCD tidak perlu menunggu waktu nyata
+  Serial.setHostOutput(nullptr);
+  hal_host_use_virtual_clock(true);
+  char* hostArgs[] = {argv[0], (char*)"--no-console"};
+  hal_host_begin(2, hostArgs);
+  bench_cases_begin();
+  Serial.setHostOutput(stdout);
+
+  size_t count = runBenchmarks(optionValue(argc, argv, "--filter"));
+  if (count == 0) {
+    fprintf(stderr, "[BENCH] Tidak ada kasus yang cocok dengan filter.\n");
+    return 2;
+  }
+  bool ok = true;
+  if (jsonPath != nullptr && !saveJson(jsonPath, count)) ok = false;
+  if (csvPath != nullptr && !saveCsv(csvPath, count)) ok = false;
+  fflush(stdout);
+  _Exit(ok ? 0 : 1); // Lewati destruktor global firmware, seperti main() host
+}
+#else
+// --- ESP32 ---
+void setup() {
+  Serial.begin(115200);
+  delay(1000); // Memberi waktu monitor Serial tersambung
+  Serial.println("[BENCH] Menyiapkan komponen...");
+  bench_cases_begin();
+  Serial.printf("[BENCH] CPU %lu MHz, batch minimal %d us, %d ulangan\n", (unsigned long)hal_cpu_mhz(),
+                BENCH_MIN_BATCH_US, BENCH_REPEATS);
+
+  size_t count = runBenchmarks(nullptr);
+
+  Serial.printf("[BENCH_CSV] %s\n", BENCH_CSV_HEADER);
+  char row[160];
+  for (size_t i = 0; i < count; i++) {
+    bench_format_csv(benchResults[i], row, sizeof(row));
+    Serial.printf("[BENCH_CSV] %s\n", row);
+  }
+  JsonWriter writer(benchJsonBuffer, sizeof(benchJsonBuffer));
+  bench_write_json(writer, benchResults, count);
+  Serial.printf("[BENCH_JSON] %s\n", writer.overflowed() ? "{}" : writer.c_str());
+  Serial.println("[BENCH] Selesai.");
+}
+
+void loop() {
+  delay(1000);
+}
+#endif
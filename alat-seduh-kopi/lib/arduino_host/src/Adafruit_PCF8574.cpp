@@ -0,0 +1,44 @@
+/*
+  lib/arduino_host/src/Adafruit_PCF8574.cpp - Adafruit_PCF8574 untuk Host
+*/
+
+#include <Adafruit_PCF8574.h>
+
+bool Adafruit_PCF8574::begin(uint8_t i2cAddress, TwoWire* i2cWire) {
+  address = i2cAddress;
+  wire = i2cWire;
+  wire->beginTransmission(address);
+  return wire->endTransmission() == 0;
+}
+
+bool Adafruit_PCF8574::pinMode(uint8_t pin, uint8_t mode) {
+  if (mode == INPUT || mode == INPUT_PULLUP) writeBuffer |= (1 << pin);
+  else writeBuffer &= ~(1 << pin);
+  return writePort();
+}
+
+bool Adafruit_PCF8574::digitalWrite(uint8_t pin, bool level) {
+  if (level) writeBuffer |= (1 << pin);
+  else writeBuffer &= ~(1 << pin);
+  return writePort();
+}
+
+bool Adafruit_PCF8574::digitalRead(uint8_t pin) {
+  return (digitalReadByte() >> pin) & 0x1;
+}
+
+bool Adafruit_PCF8574::digitalWriteByte(uint8_t data) {
+  writeBuffer = data;
+  return writePort();
+}
+
+uint8_t Adafruit_PCF8574::digitalReadByte() {
+  if (wire->requestFrom(address, (uint8_t)1) == 1) readBuffer = (uint8_t)wire->read();
+  return readBuffer;
+}
+
+bool Adafruit_PCF8574::writePort() {
+  wire->beginTransmission(address);
+  wire->write(writeBuffer);
+  return wire->endTransmission() == 0;
+}
@@ -0,0 +1,30 @@
+#ifndef ARDUINO_HOST_ADAFRUIT_PCF8574_H
+#define ARDUINO_HOST_ADAFRUIT_PCF8574_H
+
+// --- Adafruit_PCF8574 untuk Host ---
+// Perilaku sama dengan library asli: satu byte buffer tulis, setiap pinMode/digitalWrite
+// mengirim seluruh port lewat Wire (pin INPUT ditulis HIGH agar quasi-bidirectional).
+
+#include <Wire.h>
+
+#define PCF8574_I2CADDR_DEFAULT 0x20
+
+class Adafruit_PCF8574 {
+public:
+  bool begin(uint8_t address = PCF8574_I2CADDR_DEFAULT, TwoWire* wire = &Wire);
+  bool pinMode(uint8_t pin, uint8_t mode);
+  bool digitalWrite(uint8_t pin, bool level);
+  bool digitalRead(uint8_t pin);
+  bool digitalWriteByte(uint8_t data);
+  uint8_t digitalReadByte();
+
+private:
+  bool writePort();
+
+  TwoWire* wire = nullptr;
+  uint8_t address = PCF8574_I2CADDR_DEFAULT;
+  uint8_t writeBuffer = 0;
+  uint8_t readBuffer = 0;
+};
+
+#endif // ARDUINO_HOST_ADAFRUIT_PCF8574_H
@@ -0,0 +1,40 @@
+#ifndef ARDUINO_HOST_ADAFRUIT_SENSOR_H
+#define ARDUINO_HOST_ADAFRUIT_SENSOR_H
+
+// --- Adafruit Unified Sensor untuk Host ---
+// Hanya tipe & field yang dipakai DHT_Unified.
+
+#include <Arduino.h>
+
+#define SENSOR_TYPE_RELATIVE_HUMIDITY 12
+#define SENSOR_TYPE_AMBIENT_TEMPERATURE 13
+
+typedef struct {
+  int32_t version;
+  int32_t sensor_id;
+  int32_t type;
+  int32_t reserved0;
+  int32_t timestamp;
+  float temperature;
+  float relative_humidity;
+} sensors_event_t;
+
+typedef struct {
+  char name[12];
+  int32_t version;
+  int32_t sensor_id;
+  int32_t type;
+  float max_value;
+  float min_value;
+  float resolution;
+  int32_t min_delay;
+} sensor_t;
+
+class Adafruit_Sensor {
+public:
+  virtual ~Adafruit_Sensor() {}
+  virtual bool getEvent(sensors_event_t* event) = 0;
+  virtual void getSensor(sensor_t* sensor) = 0;
+};
+
+#endif // ARDUINO_HOST_ADAFRUIT_SENSOR_H
@@ -0,0 +1,192 @@
+/*
+  lib/arduino_host/src/Arduino.cpp - Core Arduino-ESP32 untuk Host
+  Print/Serial ke stdout, fungsi GPIO & waktu lewat HAL host, ESP, dan main() yang
+  memanggil hal_host_begin(), setup() lalu loop() terus-menerus seperti loopTask.
+  Opsi: --seconds N menghentikan proses setelah N detik (mis. untuk CI).
+  main() dilewati dengan -D ARDUINO_HOST_NO_MAIN (program dengan main() sendiri) dan
+  saat 'pio test' (PIO_UNIT_TESTING), karena runner Unity punya main() sendiri.
+*/
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include "components/hal/hal_host.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// --- Waktu & GPIO ---
+unsigned long millis() {
+  return hal_millis();
+}
+
+unsigned long micros() {
+  return hal_micros();
+}
+
+void delay(uint32_t ms) {
+  hal_delay_us(ms * 1000UL);
+}
+
+void delayMicroseconds(uint32_t us) {
+  hal_delay_us(us);
+}
+
+void yield() {
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  hal_gpio_mode(pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  hal_gpio_write(pin, level);
+}
+
+int digitalRead(uint8_t pin) {
+  return hal_gpio_read(pin);
+}
+
+void analogWrite(uint8_t pin, int value) {
+  hal_pwm_write(pin, (uint8_t)constrain(value, 0, 255));
+}
+
+unsigned long pulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs) {
+  return hal_gpio_pulse_in(pin, level, timeoutUs);
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode) {
+  hal_gpio_attach_interrupt(pin, handler, mode);
+}
+
+void detachInterrupt(uint8_t pin) {
+  hal_gpio_attach_interrupt(pin, nullptr, 0);
+}
+
+long random(long howBig) {
+  return howBig > 0 ? (long)(rand() % howBig) : 0;
+}
+
+long random(long howSmall, long howBig) {
+  return howBig > howSmall ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+void randomSeed(unsigned long seed) {
+  srand((unsigned int)seed);
+}
+
+// --- Print ---
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) n += write(*buffer++);
+  return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+  char stackBuffer[128];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(stackBuffer, sizeof(stackBuffer), format, args);
+  va_end(args);
+  if (length < 0) return 0;
+  if ((size_t)length < sizeof(stackBuffer)) return write((const uint8_t*)stackBuffer, length);
+
+  char* heapBuffer = (char*)malloc(length + 1);
+  if (heapBuffer == nullptr) return 0;
+  va_start(args, format);
+  vsnprintf(heapBuffer, length + 1, format, args);
+  va_end(args);
+  size_t n = write((const uint8_t*)heapBuffer, length);
+  free(heapBuffer);
+  return n;
+}
+
+size_t Print::print(unsigned long value, int base) {
+  char buffer[8 * sizeof(unsigned long) + 1];
+  char* p = &buffer[sizeof(buffer) - 1];
+  *p = '\0';
+  if (base < 2) base = 10;
+  do {
+    unsigned long digit = value % base;
+    *--p = (char)(digit < 10 ? '0' + digit : 'A' + digit - 10);
+    value /= base;
+  } while (value > 0);
+  return write(p);
+}
+
+size_t Print::print(long value, int base) {
+  if (base == 10 && value < 0) {
+    size_t n = write((uint8_t)'-');
+    return n + print((unsigned long)(-(value + 1)) + 1, 10);
+  }
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(double value, int digits) {
+  return printf("%.*f", digits, value);
+}
+
+// --- Serial ---
+size_t HardwareSerial::write(uint8_t c) {
+  if (output == nullptr) return 1;
+  return fputc(c, output) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  if (output == nullptr) return size;
+  return fwrite(buffer, 1, size, output);
+}
+
+void HardwareSerial::flush() {
+  if (output != nullptr) fflush(output);
+}
+
+// --- ESP ---
+uint32_t EspClass::getCycleCount() {
+  return hal_cycle_count();
+}
+
+uint32_t EspClass::getCpuFreqMHz() {
+  return hal_cpu_mhz();
+}
+
+uint32_t EspClass::getHeapSize() {
+  return heap_caps_get_total_size(MALLOC_CAP_8BIT);
+}
+
+uint32_t EspClass::getFreeHeap() {
+  return heap_caps_get_free_size(MALLOC_CAP_8BIT);
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+  return heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+  return heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+}
+
+void EspClass::restart() {
+  fflush(stdout);
+  _Exit(0);
+}
+
+// --- Entry Point ---
+#if !defined(ARDUINO_HOST_NO_MAIN) && !defined(PIO_UNIT_TESTING)
+int main(int argc, char** argv) {
+  unsigned long runSeconds = 0;
+  for (int i = 1; i + 1 < argc; i++) {
+    if (strcmp(argv[i], "--seconds") == 0) runSeconds = strtoul(argv[i + 1], nullptr, 10);
+  }
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+
+  hal_host_begin(argc, argv);
+  setup();
+  while (runSeconds == 0 || hal_millis() < runSeconds * 1000UL) {
+    loop();
+  }
+
+  // Task lain tidak pernah selesai (seperti di FreeRTOS): keluar tanpa destruktor global
+  fflush(stdout);
+  _Exit(0);
+}
+#endif // !ARDUINO_HOST_NO_MAIN && !PIO_UNIT_TESTING
@@ -0,0 +1,169 @@
+#ifndef ARDUINO_HOST_ARDUINO_H
+#define ARDUINO_HOST_ARDUINO_H
+
+// --- Core Arduino-ESP32 untuk Host (env 'native') ---
+// Hanya bagian API yang dipakai firmware: Print/Serial ke stdout, fungsi GPIO & waktu
+// yang diteruskan ke HAL host, ESP (cycle counter, heap nominal) dan primitif FreeRTOS.
+// Diaktifkan oleh library.json ("platforms": "native"), tidak ikut build ESP32.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define LOW 0x0
+#define HIGH 0x1
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(text) (text)
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define digitalPinToInterrupt(pin) (pin)
+
+// --- Waktu & GPIO (lewat HAL host) ---
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+unsigned long pulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs = 1000000UL);
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode);
+void detachInterrupt(uint8_t pin);
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+// --- String (minimal, hanya untuk tanda tangan API library) ---
+class String {
+public:
+  String() {}
+  String(const char* text) : value(text != nullptr ? text : "") {}
+  const char* c_str() const { return value.c_str(); }
+  unsigned int length() const { return (unsigned int)value.length(); }
+  bool operator==(const char* other) const { return other != nullptr && value == other; }
+
+private:
+  std::string value;
+};
+
+// --- Print ---
+class Print;
+
+class Printable {
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print& p) const = 0;
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const char* text) { return text != nullptr ? write((const uint8_t*)text, strlen(text)) : 0; }
+  size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+  size_t print(const char* text) { return write(text); }
+  size_t print(const String& text) { return write(text.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(double value, int digits = 2);
+  size_t print(const Printable& value) { return value.printTo(*this); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T& value) { size_t n = print(value); return n + println(); }
+  template <typename T> size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+};
+
+// --- Serial ke stdout ---
+class HardwareSerial : public Print {
+public:
+  using Print::write;
+  void begin(unsigned long baud) {}
+  size_t setTxBufferSize(size_t size) { txBufferSize = size; return size; }
+  // stdout tidak pernah penuh: seluruh buffer TX selalu tersedia
+  int availableForWrite() { return (int)txBufferSize; }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  void flush();
+  int available() { return 0; }
+  int read() { return -1; }
+  operator bool() const { return true; }
+  // Khusus host: tujuan output (default stdout), nullptr = dibuang (mis. simulator)
+  void setHostOutput(FILE* stream) { output = stream; }
+
+private:
+  size_t txBufferSize = 128;
+  FILE* output = stdout;
+};
+
+extern HardwareSerial Serial;
+
+// --- IPAddress ---
+class IPAddress : public Printable {
+public:
+  IPAddress() : bytes{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes{a, b, c, d} {}
+  uint8_t operator[](int index) const { return bytes[index]; }
+  size_t printTo(Print& p) const override { return p.printf("%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]); }
+
+private:
+  uint8_t bytes[4];
+};
+
+// --- ESP ---
+class EspClass {
+public:
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz();
+  uint32_t getHeapSize();
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  void restart();
+};
+
+extern EspClass ESP;
+
+// --- Sketch ---
+// main() host memanggil setup() lalu loop(). Program yang punya main() sendiri
+// (simulator 'sim/') dikompilasi dengan -D ARDUINO_HOST_NO_MAIN.
+void setup();
+void loop();
+
+#include "freertos_host.h"
+
+#endif // ARDUINO_HOST_ARDUINO_H
@@ -0,0 +1,9 @@
+#ifndef ARDUINO_HOST_ASYNCTCP_H
+#define ARDUINO_HOST_ASYNCTCP_H
+
+// --- AsyncTCP untuk Host ---
+// Tidak ada socket di host: lihat ESPAsyncWebServer.h.
+
+#include <Arduino.h>
+
+#endif // ARDUINO_HOST_ASYNCTCP_H
@@ -0,0 +1,14 @@
+#ifndef ARDUINO_HOST_DHT_H
+#define ARDUINO_HOST_DHT_H
+
+// --- DHT untuk Host ---
+
+#include <Arduino.h>
+
+#define DHT11 11
+#define DHT12 12
+#define DHT21 21
+#define DHT22 22
+#define AM2301 21
+
+#endif // ARDUINO_HOST_DHT_H
@@ -0,0 +1,77 @@
+/*
+  lib/arduino_host/src/DHT_U.cpp - DHT_Unified untuk Host (model host_dht22())
+*/
+
+#include <DHT_U.h>
+#include "components/hal/host_peripherals.h"
+
+// Satu transaksi DHT22 (start 1 ms + 40 bit data) memblokir pemanggil sekitar 5 ms;
+// dalam 2 detik setelahnya library asli mengembalikan hasil terakhir tanpa membaca ulang
+#define HOST_DHT_READ_US 5000
+#define HOST_DHT_MIN_INTERVAL_MS 2000
+
+DHT_Unified::DHT_Unified(uint8_t dataPin, uint8_t sensorType, uint8_t count, int32_t tempSensorId,
+                         int32_t humiditySensorId)
+    : pin(dataPin), type(sensorType), temperatureSensor(this, tempSensorId),
+      humiditySensor(this, humiditySensorId) {}
+
+void DHT_Unified::begin() {
+  hal_gpio_mode(pin, INPUT_PULLUP);
+  lastReadMs = millis() - HOST_DHT_MIN_INTERVAL_MS;
+}
+
+void DHT_Unified::readSensor() {
+  unsigned long now = millis();
+  if (hasRead && now - lastReadMs < HOST_DHT_MIN_INTERVAL_MS) return;
+  hasRead = true;
+  lastReadMs = now;
+  hal_delay_us(HOST_DHT_READ_US);
+  if (!host_dht22().read(lastTemperature, lastHumidity)) {
+    lastTemperature = NAN;
+    lastHumidity = NAN;
+  }
+}
+
+static void fillEvent(sensors_event_t* event, int32_t id, int32_t type) {
+  memset(event, 0, sizeof(sensors_event_t));
+  event->version = sizeof(sensors_event_t);
+  event->sensor_id = id;
+  event->type = type;
+  event->timestamp = (int32_t)millis();
+}
+
+bool DHT_Unified::Temperature::getEvent(sensors_event_t* event) {
+  fillEvent(event, id, SENSOR_TYPE_AMBIENT_TEMPERATURE);
+  parent->readSensor();
+  event->temperature = parent->lastTemperature;
+  return true;
+}
+
+void DHT_Unified::Temperature::getSensor(sensor_t* sensor) {
+  memset(sensor, 0, sizeof(sensor_t));
+  strncpy(sensor->name, "DHT22", sizeof(sensor->name) - 1);
+  sensor->sensor_id = id;
+  sensor->type = SENSOR_TYPE_AMBIENT_TEMPERATURE;
+  sensor->max_value = 125.0f;
+  sensor->min_value = -40.0f;
+  sensor->resolution = 0.1f;
+  sensor->min_delay = 2000000L;
+}
+
+bool DHT_Unified::Humidity::getEvent(sensors_event_t* event) {
+  fillEvent(event, id, SENSOR_TYPE_RELATIVE_HUMIDITY);
+  parent->readSensor();
+  event->relative_humidity = parent->lastHumidity;
+  return true;
+}
+
+void DHT_Unified::Humidity::getSensor(sensor_t* sensor) {
+  memset(sensor, 0, sizeof(sensor_t));
+  strncpy(sensor->name, "DHT22", sizeof(sensor->name) - 1);
+  sensor->sensor_id = id;
+  sensor->type = SENSOR_TYPE_RELATIVE_HUMIDITY;
+  sensor->max_value = 100.0f;
+  sensor->min_value = 0.0f;
+  sensor->resolution = 0.1f;
+  sensor->min_delay = 2000000L;
+}
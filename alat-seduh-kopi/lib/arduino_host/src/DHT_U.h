@@ -0,0 +1,55 @@
+#ifndef ARDUINO_HOST_DHT_U_H
+#define ARDUINO_HOST_DHT_U_H
+
+// --- DHT_Unified untuk Host ---
+// Membaca model host_dht22(). Seperti library asli, pembacaan gagal tetap menghasilkan
+// event dengan nilai NAN (getEvent tetap true).
+
+#include <Adafruit_Sensor.h>
+#include <DHT.h>
+
+class DHT_Unified {
+public:
+  DHT_Unified(uint8_t pin, uint8_t type, uint8_t count = 6, int32_t tempSensorId = -1,
+              int32_t humiditySensorId = -1);
+  void begin();
+
+  class Temperature : public Adafruit_Sensor {
+  public:
+    Temperature(DHT_Unified* parent, int32_t id) : parent(parent), id(id) {}
+    bool getEvent(sensors_event_t* event) override;
+    void getSensor(sensor_t* sensor) override;
+
+  private:
+    DHT_Unified* parent;
+    int32_t id;
+  };
+
+  class Humidity : public Adafruit_Sensor {
+  public:
+    Humidity(DHT_Unified* parent, int32_t id) : parent(parent), id(id) {}
+    bool getEvent(sensors_event_t* event) override;
+    void getSensor(sensor_t* sensor) override;
+
+  private:
+    DHT_Unified* parent;
+    int32_t id;
+  };
+
+  Temperature temperature() { return temperatureSensor; }
+  Humidity humidity() { return humiditySensor; }
+
+private:
+  void readSensor();
+
+  uint8_t pin;
+  uint8_t type;
+  bool hasRead = false;
+  unsigned long lastReadMs = 0;
+  float lastTemperature = NAN;
+  float lastHumidity = NAN;
+  Temperature temperatureSensor;
+  Humidity humiditySensor;
+};
+
+#endif // ARDUINO_HOST_DHT_U_H
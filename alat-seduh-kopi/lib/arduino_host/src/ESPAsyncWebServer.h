@@ -0,0 +1,178 @@
+#ifndef ARDUINO_HOST_ESPASYNCWEBSERVER_H
+#define ARDUINO_HOST_ESPASYNCWEBSERVER_H
+
+// --- ESPAsyncWebServer untuk Host ---
+// Server diam: handler & endpoint didaftarkan seperti biasa, tetapi tidak ada socket
+// yang dibuka, sehingga tidak pernah ada request maupun klien WebSocket. Cukup untuk
+// menjalankan seluruh jalur publish (ws_clients melihat nol klien) tanpa jaringan.
+// Tanda tangan mengikuti esphome/ESPAsyncWebServer-esphome 3.x.
+
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+#include <vector>
+
+class AsyncWebServerRequest;
+class AsyncWebSocket;
+class AsyncWebSocketClient;
+
+typedef uint8_t WebRequestMethodComposite;
+#define HTTP_GET 0b00000001
+#define HTTP_POST 0b00000010
+#define HTTP_ANY 0b01111111
+
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<void()> ArDisconnectHandler;
+
+// --- Request & Response ---
+class AsyncWebParameter {
+public:
+  const String& value() const { return paramValue; }
+
+private:
+  String paramValue;
+};
+
+class AsyncWebServerResponse {
+public:
+  virtual ~AsyncWebServerResponse() {}
+  void addHeader(const String& name, const String& value) {}
+};
+
+class AsyncWebServerRequest {
+public:
+  WebRequestMethodComposite method() const { return HTTP_GET; }
+  const String& url() const { return requestUrl; }
+  bool hasParam(const char* name, bool post = false, bool file = false) const { return false; }
+  const AsyncWebParameter* getParam(const char* name, bool post = false, bool file = false) const { return nullptr; }
+  bool hasHeader(const char* name) const { return false; }
+  const String& header(const char* name) const { return requestUrl; }
+  void addInterestingHeader(const char* name) {}
+  void onDisconnect(ArDisconnectHandler handler) {}
+
+  AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(),
+                                        const String& content = String()) { return nullptr; }
+  AsyncWebServerResponse* beginResponse(FS& fs, const String& path, const String& contentType = String(),
+                                        bool download = false) { return nullptr; }
+  AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* content,
+                                          size_t length) { return nullptr; }
+  void send(AsyncWebServerResponse* response) {}
+  void send(int code, const String& contentType = String(), const String& content = String()) {}
+
+private:
+  String requestUrl;
+};
+
+// --- Handler ---
+class AsyncWebHandler {
+public:
+  virtual ~AsyncWebHandler() {}
+  virtual bool canHandle(AsyncWebServerRequest* request) { return false; }
+  virtual void handleRequest(AsyncWebServerRequest* request) {}
+};
+
+// --- WebSocket ---
+typedef enum { WS_DISCONNECTED, WS_CONNECTED, WS_DISCONNECTING } AwsClientStatus;
+typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+
+typedef struct {
+  uint8_t message_opcode;
+  uint32_t num;
+  uint8_t final;
+  uint8_t masked;
+  uint8_t opcode;
+  uint64_t len;
+  uint8_t mask[4];
+  uint64_t index;
+} AwsFrameInfo;
+
+typedef std::function<void(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type,
+                           void* arg, uint8_t* data, size_t len)> AwsEventHandler;
+
+// Buffer pesan bersama: klien yang mengantrekan pesan menaikkan refcount-nya, dan
+// AsyncWebSocket::_cleanBuffers() menghapus buffer yang tidak dikunci & tidak dipakai lagi
+class AsyncWebSocketMessageBuffer {
+public:
+  explicit AsyncWebSocketMessageBuffer(size_t size) : data(size + 1, 0), size(size) {}
+  uint8_t* get() { return data.data(); }
+  size_t length() const { return size; }
+  void lock() { locked = true; }
+  void unlock() { locked = false; }
+  bool canDelete() const { return !locked && count == 0; }
+  void operator++(int) { count++; }
+  void operator--(int) { if (count > 0) count--; }
+
+private:
+  std::vector<uint8_t> data;
+  size_t size;
+  bool locked = false;
+  uint32_t count = 0;
+};
+
+class AsyncWebSocketClient {
+public:
+  uint32_t id() const { return clientId; }
+  AwsClientStatus status() const { return WS_DISCONNECTED; }
+  bool canSend() const { return false; }
+  bool queueIsFull() const { return true; }
+  size_t queueLen() const { return 0; }
+  void text(const char* message, size_t length) {}
+  void text(AsyncWebSocketMessageBuffer* buffer) {} // Klien host tidak pernah terhubung, tidak ada yang diantrekan
+  void close(uint16_t code = 0, const char* message = nullptr) {}
+
+private:
+  uint32_t clientId = 0;
+};
+
+class AsyncWebSocket : public AsyncWebHandler {
+public:
+  explicit AsyncWebSocket(const String& url) {}
+  void onEvent(AwsEventHandler handler) { eventHandler = handler; }
+  AsyncWebSocketClient* client(uint32_t id) { return nullptr; }
+  size_t count() const { return 0; }
+  void cleanupClients(uint16_t maxClients = 8) {}
+
+  AsyncWebSocketMessageBuffer* makeBuffer(size_t size = 0) {
+    AsyncWebSocketMessageBuffer* buffer = new AsyncWebSocketMessageBuffer(size);
+    buffers.push_back(buffer);
+    return buffer;
+  }
+  void _cleanBuffers() {
+    for (size_t i = 0; i < buffers.size();) {
+      if (buffers[i]->canDelete()) {
+        delete buffers[i];
+        buffers.erase(buffers.begin() + i);
+      } else {
+        i++;
+      }
+    }
+  }
+
+private:
+  AwsEventHandler eventHandler;
+  std::vector<AsyncWebSocketMessageBuffer*> buffers;
+};
+
+// --- Server ---
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+public:
+  ArRequestHandlerFunction onRequest;
+};
+
+class AsyncWebServer {
+public:
+  explicit AsyncWebServer(uint16_t port) : port(port) {}
+  void begin() { Serial.printf("[HOST] Server web port %u tidak dibuka (env native tanpa jaringan).\n", port); }
+  AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction handler) {
+    lastHandler.onRequest = handler;
+    return lastHandler;
+  }
+  AsyncWebHandler& addHandler(AsyncWebHandler* handler) { return *handler; }
+
+private:
+  uint16_t port;
+  AsyncCallbackWebHandler lastHandler;
+};
+
+#endif // ARDUINO_HOST_ESPASYNCWEBSERVER_H
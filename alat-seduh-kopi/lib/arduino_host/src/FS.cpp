@@ -0,0 +1,77 @@
+/*
+  lib/arduino_host/src/FS.cpp - File & FS untuk Host (file biasa di direktori root)
+*/
+
+#include <FS.h>
+
+namespace fs {
+
+// Deleter shared_ptr tetap dipanggil untuk pointer null, jadi fopen() gagal tidak dibungkus
+File::File(FILE* file) : handle(file != nullptr ? std::shared_ptr<FILE>(file, fclose) : nullptr) {}
+
+size_t File::write(uint8_t c) {
+  return handle != nullptr && fputc(c, handle.get()) != EOF ? 1 : 0;
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+  return handle != nullptr ? fwrite(buffer, 1, size, handle.get()) : 0;
+}
+
+int File::available() {
+  if (handle == nullptr) return 0;
+  long position = ftell(handle.get());
+  return position < 0 ? 0 : (int)(size() - (size_t)position);
+}
+
+int File::read() {
+  return handle != nullptr ? fgetc(handle.get()) : -1;
+}
+
+int File::peek() {
+  int c = read();
+  if (c != EOF) ungetc(c, handle.get());
+  return c;
+}
+
+size_t File::readBytes(char* buffer, size_t length) {
+  return handle != nullptr ? fread(buffer, 1, length, handle.get()) : 0;
+}
+
+size_t File::readBytesUntil(char terminator, char* buffer, size_t length) {
+  size_t n = 0;
+  while (n < length) {
+    int c = read();
+    if (c < 0 || c == terminator) break;
+    buffer[n++] = (char)c;
+  }
+  return n;
+}
+
+size_t File::size() {
+  if (handle == nullptr) return 0;
+  long position = ftell(handle.get());
+  fseek(handle.get(), 0, SEEK_END);
+  long end = ftell(handle.get());
+  fseek(handle.get(), position, SEEK_SET);
+  return end < 0 ? 0 : (size_t)end;
+}
+
+void File::close() {
+  handle.reset();
+}
+
+static std::string hostPath(const char* root, const char* path) {
+  return std::string(root) + (path[0] == '/' ? "" : "/") + path;
+}
+
+File FS::open(const char* path, const char* mode) {
+  // Mode biner agar ukuran & isi file gzip sama dengan di SPIFFS
+  std::string fileMode = std::string(mode) + "b";
+  return File(fopen(hostPath(root, path).c_str(), fileMode.c_str()));
+}
+
+bool FS::exists(const char* path) {
+  return (bool)open(path, "r");
+}
+
+} // namespace fs
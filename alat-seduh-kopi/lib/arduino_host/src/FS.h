@@ -0,0 +1,47 @@
+#ifndef ARDUINO_HOST_FS_H
+#define ARDUINO_HOST_FS_H
+
+// --- FS untuk Host ---
+// File memetakan path SPIFFS ke file biasa di bawah direktori root FS host.
+
+#include <Arduino.h>
+#include <memory>
+
+namespace fs {
+
+class File : public Print {
+public:
+  using Print::write;
+  File() {}
+  explicit File(FILE* handle);
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  int available();
+  int read();
+  int peek();
+  size_t readBytes(char* buffer, size_t length);
+  size_t readBytesUntil(char terminator, char* buffer, size_t length);
+  size_t size();
+  void close();
+  operator bool() const { return handle != nullptr; }
+
+private:
+  std::shared_ptr<FILE> handle;
+};
+
+class FS {
+public:
+  explicit FS(const char* root) : root(root) {}
+  File open(const char* path, const char* mode = "r");
+  bool exists(const char* path);
+
+protected:
+  const char* root;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // ARDUINO_HOST_FS_H
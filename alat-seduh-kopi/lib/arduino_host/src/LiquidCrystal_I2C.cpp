@@ -0,0 +1,134 @@
+/*
+  lib/arduino_host/src/LiquidCrystal_I2C.cpp - LiquidCrystal_I2C untuk Host
+  Urutan inisialisasi & batas baris setCursor mengikuti library asli apa adanya.
+*/
+
+#include <LiquidCrystal_I2C.h>
+
+#define LCD_CLEARDISPLAY 0x01
+#define LCD_RETURNHOME 0x02
+#define LCD_ENTRYMODESET 0x04
+#define LCD_DISPLAYCONTROL 0x08
+#define LCD_FUNCTIONSET 0x20
+#define LCD_SETDDRAMADDR 0x80
+
+#define LCD_ENTRYLEFT 0x02
+#define LCD_ENTRYSHIFTDECREMENT 0x00
+#define LCD_DISPLAYON 0x04
+#define LCD_CURSOROFF 0x00
+#define LCD_BLINKOFF 0x00
+#define LCD_4BITMODE 0x00
+#define LCD_2LINE 0x08
+#define LCD_1LINE 0x00
+#define LCD_5x8DOTS 0x00
+
+#define LCD_BACKLIGHT 0x08
+#define LCD_NOBACKLIGHT 0x00
+
+#define En 0x04 // Enable bit
+#define Rs 0x01 // Register select bit
+
+LiquidCrystal_I2C::LiquidCrystal_I2C(uint8_t lcdAddress, uint8_t lcdColumns, uint8_t lcdRows)
+    : address(lcdAddress), columns(lcdColumns), rows(lcdRows), displayFunction(0),
+      displayControl(0), displayMode(0), backlightValue(LCD_NOBACKLIGHT) {}
+
+void LiquidCrystal_I2C::init() {
+  Wire.begin();
+  displayFunction = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
+  begin(columns, rows);
+}
+
+void LiquidCrystal_I2C::begin(uint8_t lcdColumns, uint8_t lcdRows) {
+  if (lcdRows > 1) displayFunction |= LCD_2LINE;
+  rows = lcdRows;
+
+  // Tunggu tegangan LCD stabil sebelum instruksi pertama
+  delay(50);
+  expanderWrite(backlightValue);
+  delay(1000);
+
+  // Urutan reset ke mode 4 bit (HD44780 datasheet, figure 24)
+  write4bits(0x03 << 4);
+  delayMicroseconds(4500);
+  write4bits(0x03 << 4);
+  delayMicroseconds(4500);
+  write4bits(0x03 << 4);
+  delayMicroseconds(150);
+  write4bits(0x02 << 4);
+
+  command(LCD_FUNCTIONSET | displayFunction);
+  displayControl = LCD_DISPLAYON | LCD_CURSOROFF | LCD_BLINKOFF;
+  display();
+  clear();
+  displayMode = LCD_ENTRYLEFT | LCD_ENTRYSHIFTDECREMENT;
+  command(LCD_ENTRYMODESET | displayMode);
+  home();
+}
+
+void LiquidCrystal_I2C::clear() {
+  command(LCD_CLEARDISPLAY);
+  delayMicroseconds(2000);
+}
+
+void LiquidCrystal_I2C::home() {
+  command(LCD_RETURNHOME);
+  delayMicroseconds(2000);
+}
+
+void LiquidCrystal_I2C::setCursor(uint8_t col, uint8_t row) {
+  static const int rowOffsets[] = {0x00, 0x40, 0x14, 0x54};
+  if (row > rows) row = rows - 1; // Sama dengan library asli (row == rows tidak dibatasi)
+  command(LCD_SETDDRAMADDR | (col + rowOffsets[row]));
+}
+
+void LiquidCrystal_I2C::display() {
+  displayControl |= LCD_DISPLAYON;
+  command(LCD_DISPLAYCONTROL | displayControl);
+}
+
+void LiquidCrystal_I2C::noDisplay() {
+  displayControl &= ~LCD_DISPLAYON;
+  command(LCD_DISPLAYCONTROL | displayControl);
+}
+
+void LiquidCrystal_I2C::backlight() {
+  backlightValue = LCD_BACKLIGHT;
+  expanderWrite(0);
+}
+
+void LiquidCrystal_I2C::noBacklight() {
+  backlightValue = LCD_NOBACKLIGHT;
+  expanderWrite(0);
+}
+
+size_t LiquidCrystal_I2C::write(uint8_t value) {
+  send(value, Rs);
+  return 1;
+}
+
+void LiquidCrystal_I2C::command(uint8_t value) {
+  send(value, 0);
+}
+
+void LiquidCrystal_I2C::send(uint8_t value, uint8_t mode) {
+  write4bits((value & 0xF0) | mode);
+  write4bits(((value << 4) & 0xF0) | mode);
+}
+
+void LiquidCrystal_I2C::write4bits(uint8_t value) {
+  expanderWrite(value);
+  pulseEnable(value);
+}
+
+void LiquidCrystal_I2C::expanderWrite(uint8_t data) {
+  Wire.beginTransmission(address);
+  Wire.write((uint8_t)(data | backlightValue));
+  Wire.endTransmission();
+}
+
+void LiquidCrystal_I2C::pulseEnable(uint8_t data) {
+  expanderWrite(data | En);
+  delayMicroseconds(1);  // Lebar pulsa EN > 450 ns
+  expanderWrite(data & ~En);
+  delayMicroseconds(50); // Instruksi butuh > 37 µs
+}
@@ -0,0 +1,41 @@
+#ifndef ARDUINO_HOST_LIQUIDCRYSTAL_I2C_H
+#define ARDUINO_HOST_LIQUIDCRYSTAL_I2C_H
+
+// --- LiquidCrystal_I2C untuk Host ---
+// Protokol sama dengan library asli (HD44780 4 bit lewat backpack PCF8574, pulsa EN per
+// nibble beserta jeda datasheet), sehingga model LCD host menerima byte yang sama.
+
+#include <Wire.h>
+
+class LiquidCrystal_I2C : public Print {
+public:
+  using Print::write;
+  LiquidCrystal_I2C(uint8_t address, uint8_t columns, uint8_t rows);
+  void init();
+  void begin(uint8_t columns, uint8_t rows);
+  void clear();
+  void home();
+  void setCursor(uint8_t col, uint8_t row);
+  void display();
+  void noDisplay();
+  void backlight();
+  void noBacklight();
+  size_t write(uint8_t value) override;
+
+private:
+  void command(uint8_t value);
+  void send(uint8_t value, uint8_t mode);
+  void write4bits(uint8_t value);
+  void expanderWrite(uint8_t data);
+  void pulseEnable(uint8_t data);
+
+  uint8_t address;
+  uint8_t columns;
+  uint8_t rows;
+  uint8_t displayFunction;
+  uint8_t displayControl;
+  uint8_t displayMode;
+  uint8_t backlightValue;
+};
+
+#endif // ARDUINO_HOST_LIQUIDCRYSTAL_I2C_H
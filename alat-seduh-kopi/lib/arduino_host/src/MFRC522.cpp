@@ -0,0 +1,34 @@
+/*
+  lib/arduino_host/src/MFRC522.cpp - MFRC522 untuk Host (model kartu host_rc522())
+*/
+
+#include <MFRC522.h>
+#include "components/hal/host_peripherals.h"
+
+MFRC522::MFRC522(byte ssPin, byte rstPin) : chipSelectPin(ssPin), resetPowerDownPin(rstPin) {
+  memset(&uid, 0, sizeof(uid));
+}
+
+void MFRC522::PCD_Init() {
+  hal_gpio_mode(chipSelectPin, OUTPUT);
+  hal_gpio_write(chipSelectPin, HIGH);
+  hal_gpio_mode(resetPowerDownPin, OUTPUT);
+  hal_gpio_write(resetPowerDownPin, HIGH); // Keluar dari power-down
+}
+
+bool MFRC522::PICC_IsNewCardPresent() {
+  return host_rc522().requestCard();
+}
+
+bool MFRC522::PICC_ReadCardSerial() {
+  uint8_t size = 0;
+  if (!host_rc522().selectCard(uid.uidByte, size)) return false;
+  uid.size = size;
+  uid.sak = 0x08; // MIFARE Classic 1K
+  return true;
+}
+
+MFRC522::StatusCode MFRC522::PICC_HaltA() {
+  host_rc522().haltCard();
+  return STATUS_OK; // HLTA yang berhasil tidak dijawab kartu (timeout) = OK
+}
@@ -0,0 +1,44 @@
+#ifndef ARDUINO_HOST_MFRC522_H
+#define ARDUINO_HOST_MFRC522_H
+
+// --- MFRC522 untuk Host ---
+// Perintah PICC (REQA, anticollision/select, HLTA) dijawab model kartu host_rc522();
+// register chip RC522 di bus SPI tidak dimodelkan.
+
+#include <Arduino.h>
+
+class MFRC522 {
+public:
+  enum StatusCode : byte {
+    STATUS_OK,
+    STATUS_ERROR,
+    STATUS_COLLISION,
+    STATUS_TIMEOUT,
+    STATUS_NO_ROOM,
+    STATUS_INTERNAL_ERROR,
+    STATUS_INVALID,
+    STATUS_CRC_WRONG,
+    STATUS_MIFARE_NACK = 0xff
+  };
+
+  typedef struct {
+    byte size;
+    byte uidByte[10];
+    byte sak;
+  } Uid;
+
+  Uid uid;
+
+  MFRC522(byte chipSelectPin, byte resetPowerDownPin);
+  void PCD_Init();
+  void PCD_StopCrypto1() {}
+  bool PICC_IsNewCardPresent();
+  bool PICC_ReadCardSerial();
+  StatusCode PICC_HaltA();
+
+private:
+  byte chipSelectPin;
+  byte resetPowerDownPin;
+};
+
+#endif // ARDUINO_HOST_MFRC522_H
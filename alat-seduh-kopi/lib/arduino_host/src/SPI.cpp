@@ -0,0 +1,7 @@
+/*
+  lib/arduino_host/src/SPI.cpp - Objek SPI untuk Host
+*/
+
+#include <SPI.h>
+
+SPIClass SPI;
@@ -0,0 +1,18 @@
+#ifndef ARDUINO_HOST_SPI_H
+#define ARDUINO_HOST_SPI_H
+
+// --- SPI untuk Host ---
+// Firmware memakai hal_spi_*; objek SPI hanya ada agar header library SPI tetap valid.
+
+#include <Arduino.h>
+
+class SPIClass {
+public:
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+  void end() {}
+  uint8_t transfer(uint8_t data) { return 0xFF; } // MISO mengambang
+};
+
+extern SPIClass SPI;
+
+#endif // ARDUINO_HOST_SPI_H
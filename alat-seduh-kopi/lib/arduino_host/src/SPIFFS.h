@@ -0,0 +1,23 @@
+#ifndef ARDUINO_HOST_SPIFFS_H
+#define ARDUINO_HOST_SPIFFS_H
+
+// --- SPIFFS untuk Host ---
+// Root di HOST_SPIFFS_DIR: keluaran scripts/compress_assets.py untuk env 'native', yaitu
+// isi image SPIFFS yang sama dengan yang di-upload ke perangkat.
+
+#include <FS.h>
+
+#ifndef HOST_SPIFFS_DIR
+#define HOST_SPIFFS_DIR ".pio/build/native/data_gz"
+#endif
+
+class SPIFFSFS : public fs::FS {
+public:
+  SPIFFSFS() : fs::FS(HOST_SPIFFS_DIR) {}
+  bool begin(bool formatOnFail = false, const char* basePath = "/spiffs", uint8_t maxOpenFiles = 10,
+             const char* partitionLabel = nullptr);
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif // ARDUINO_HOST_SPIFFS_H
@@ -0,0 +1,80 @@
+/*
+  lib/arduino_host/src/WiFi.cpp - WiFi untuk Host
+  Event dikirim dari thread pemanggil (begin/disconnect/konsol); callback firmware hanya
+  mencatat flag atomik, sama seperti saat dipanggil dari task event Arduino-ESP32.
+*/
+
+#include <WiFi.h>
+#include <atomic>
+
+#define HOST_WIFI_MAX_CALLBACKS 4
+#define HOST_WIFI_RSSI_DBM -55
+
+WiFiClass WiFi;
+
+static WiFiEventFuncCb callbacks[HOST_WIFI_MAX_CALLBACKS];
+static arduino_event_id_t callbackFilters[HOST_WIFI_MAX_CALLBACKS];
+static int callbackCount = 0;
+static std::atomic<bool> linkAvailable(true);
+static std::atomic<wl_status_t> linkStatus(WL_IDLE_STATUS);
+
+int WiFiClass::onEvent(WiFiEventFuncCb callback, arduino_event_id_t event) {
+  if (callbackCount >= HOST_WIFI_MAX_CALLBACKS) return -1;
+  callbacks[callbackCount] = callback;
+  callbackFilters[callbackCount] = event;
+  return callbackCount++;
+}
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+  return true;
+}
+
+bool WiFiClass::setAutoReconnect(bool autoReconnect) {
+  return true;
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* password) {
+  if (linkAvailable) {
+    linkStatus = WL_CONNECTED;
+    fire(ARDUINO_EVENT_WIFI_STA_CONNECTED, 0);
+    fire(ARDUINO_EVENT_WIFI_STA_GOT_IP, 0);
+  } else {
+    linkStatus = WL_NO_SSID_AVAIL;
+    fire(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, WIFI_REASON_NO_AP_FOUND);
+  }
+  return linkStatus;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool eraseAp) {
+  bool wasConnected = linkStatus.exchange(WL_DISCONNECTED) == WL_CONNECTED;
+  if (wasConnected) fire(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, WIFI_REASON_ASSOC_LEAVE);
+  return true;
+}
+
+wl_status_t WiFiClass::status() {
+  return linkStatus;
+}
+
+IPAddress WiFiClass::localIP() {
+  return linkStatus == WL_CONNECTED ? IPAddress(127, 0, 0, 1) : IPAddress();
+}
+
+int8_t WiFiClass::RSSI() {
+  return linkStatus == WL_CONNECTED ? HOST_WIFI_RSSI_DBM : 0;
+}
+
+void WiFiClass::setHostLinkAvailable(bool available) {
+  linkAvailable = available;
+  if (!available && linkStatus.exchange(WL_CONNECTION_LOST) == WL_CONNECTED) {
+    fire(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, WIFI_REASON_BEACON_TIMEOUT);
+  }
+}
+
+void WiFiClass::fire(arduino_event_id_t event, uint8_t reason) {
+  arduino_event_info_t info;
+  memset(&info, 0, sizeof(info));
+  if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) info.wifi_sta_disconnected.reason = reason;
+  for (int i = 0; i < callbackCount; i++) {
+    if (callbackFilters[i] == ARDUINO_EVENT_MAX || callbackFilters[i] == event) callbacks[i](event, info);
+  }
+}
@@ -0,0 +1,71 @@
+#ifndef ARDUINO_HOST_WIFI_H
+#define ARDUINO_HOST_WIFI_H
+
+// --- WiFi untuk Host ---
+// Stasiun virtual: begin() langsung tersambung (event GOT_IP) selama link host tersedia,
+// atau gagal dengan alasan NO_AP_FOUND. setHostLinkAvailable(false) memutus link dengan
+// event DISCONNECTED, untuk menguji jalur offline wifi_service dari konsol.
+
+#include <Arduino.h>
+#include <functional>
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+typedef enum {
+  ARDUINO_EVENT_WIFI_STA_START = 2,
+  ARDUINO_EVENT_WIFI_STA_CONNECTED = 4,
+  ARDUINO_EVENT_WIFI_STA_DISCONNECTED = 5,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP = 7,
+  ARDUINO_EVENT_MAX = 45
+} arduino_event_id_t;
+
+// Kode alasan putus yang dipakai host (sama dengan wifi_err_reason_t ESP-IDF)
+#define WIFI_REASON_ASSOC_LEAVE 8
+#define WIFI_REASON_BEACON_TIMEOUT 200
+#define WIFI_REASON_NO_AP_FOUND 201
+
+typedef struct {
+  uint8_t ssid[32];
+  uint8_t ssid_len;
+  uint8_t bssid[6];
+  uint8_t reason;
+  int8_t rssi;
+} wifi_event_sta_disconnected_t;
+
+typedef union {
+  wifi_event_sta_disconnected_t wifi_sta_disconnected;
+} arduino_event_info_t;
+
+typedef std::function<void(arduino_event_id_t event, arduino_event_info_t info)> WiFiEventFuncCb;
+
+class WiFiClass {
+public:
+  int onEvent(WiFiEventFuncCb callback, arduino_event_id_t event = ARDUINO_EVENT_MAX);
+  bool mode(wifi_mode_t mode);
+  bool setAutoReconnect(bool autoReconnect);
+  wl_status_t begin(const char* ssid, const char* password = nullptr);
+  bool disconnect(bool wifiOff = false, bool eraseAp = false);
+  wl_status_t status();
+  IPAddress localIP();
+  int8_t RSSI();
+
+  // Khusus host: menaikkan / memutus link (dipanggil konsol atau simulator)
+  void setHostLinkAvailable(bool available);
+
+private:
+  void fire(arduino_event_id_t event, uint8_t reason);
+};
+
+extern WiFiClass WiFi;
+
+#endif // ARDUINO_HOST_WIFI_H
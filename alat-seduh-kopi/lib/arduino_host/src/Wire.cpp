@@ -0,0 +1,62 @@
+/*
+  lib/arduino_host/src/Wire.cpp - Wire untuk Host (lewat hal_i2c_*)
+*/
+
+#include <Wire.h>
+#include "components/hal/hal.h"
+
+TwoWire Wire;
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+  return hal_i2c_begin((uint8_t)sda, (uint8_t)scl, frequency);
+}
+
+bool TwoWire::setClock(uint32_t frequency) {
+  return true;
+}
+
+void TwoWire::setTimeOut(uint16_t timeoutMs) {
+  hal_i2c_set_timeout(timeoutMs);
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  txAddress = address;
+  txLength = 0;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  uint8_t result = hal_i2c_write(txAddress, txBuffer, txLength);
+  txLength = 0;
+  return result;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, bool sendStop) {
+  if (quantity > WIRE_BUFFER_SIZE) quantity = WIRE_BUFFER_SIZE;
+  rxLength = hal_i2c_read(address, rxBuffer, quantity);
+  rxIndex = 0;
+  return (uint8_t)rxLength;
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (txLength >= WIRE_BUFFER_SIZE) return 0;
+  txBuffer[txLength++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t quantity) {
+  size_t n = 0;
+  while (n < quantity && write(data[n])) n++;
+  return n;
+}
+
+int TwoWire::available() {
+  return (int)(rxLength - rxIndex);
+}
+
+int TwoWire::read() {
+  return rxIndex < rxLength ? rxBuffer[rxIndex++] : -1;
+}
+
+int TwoWire::peek() {
+  return rxIndex < rxLength ? rxBuffer[rxIndex] : -1;
+}
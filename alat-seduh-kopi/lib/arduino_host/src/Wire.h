@@ -0,0 +1,38 @@
+#ifndef ARDUINO_HOST_WIRE_H
+#define ARDUINO_HOST_WIRE_H
+
+// --- Wire untuk Host ---
+// Transaksi diteruskan ke hal_i2c_* sehingga library berbasis Wire (PCF8574, LCD)
+// berbicara dengan periferal simulasi di bus I2C host.
+
+#include <Arduino.h>
+
+#define WIRE_BUFFER_SIZE 128
+
+class TwoWire : public Print {
+public:
+  using Print::write;
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+  bool setClock(uint32_t frequency);
+  void setTimeOut(uint16_t timeoutMs);
+  void beginTransmission(uint8_t address);
+  uint8_t endTransmission(bool sendStop = true);
+  uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true);
+  size_t write(uint8_t data) override;
+  size_t write(const uint8_t* data, size_t quantity) override;
+  int available();
+  int read();
+  int peek();
+
+private:
+  uint8_t txAddress = 0;
+  uint8_t txBuffer[WIRE_BUFFER_SIZE];
+  size_t txLength = 0;
+  uint8_t rxBuffer[WIRE_BUFFER_SIZE];
+  size_t rxLength = 0;
+  size_t rxIndex = 0;
+};
+
+extern TwoWire Wire;
+
+#endif // ARDUINO_HOST_WIRE_H
@@ -0,0 +1,26 @@
+/*
+  lib/arduino_host/src/esp_heap_caps.cpp - Angka Heap Nominal untuk Host
+*/
+
+#include <esp_heap_caps.h>
+
+#define HOST_HEAP_TOTAL_BYTES 327680
+#define HOST_HEAP_FREE_BYTES 196608
+#define HOST_HEAP_MIN_FREE_BYTES 180224
+#define HOST_HEAP_LARGEST_BLOCK_BYTES 110592
+
+size_t heap_caps_get_total_size(uint32_t caps) {
+  return HOST_HEAP_TOTAL_BYTES;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+  return HOST_HEAP_FREE_BYTES;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+  return HOST_HEAP_MIN_FREE_BYTES;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+  return HOST_HEAP_LARGEST_BLOCK_BYTES;
+}
@@ -0,0 +1,21 @@
+#ifndef ARDUINO_HOST_ESP_HEAP_CAPS_H
+#define ARDUINO_HOST_ESP_HEAP_CAPS_H
+
+// --- heap_caps untuk Host ---
+// Heap proses host tidak sebanding dengan heap ESP32, jadi angka yang dilaporkan adalah
+// nilai nominal tetap (heap DRAM ESP32 yang umum setelah boot firmware ini). Cukup untuk
+// menjalankan memory_monitor & dashboard; analisis fragmentasi tetap harus di perangkat.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+size_t heap_caps_get_total_size(uint32_t caps);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+
+#endif // ARDUINO_HOST_ESP_HEAP_CAPS_H
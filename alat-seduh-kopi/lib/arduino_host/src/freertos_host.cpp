@@ -0,0 +1,86 @@
+/*
+  lib/arduino_host/src/freertos_host.cpp - Primitif FreeRTOS untuk Host
+  Setiap task berjalan di std::thread sendiri. Handle disimpan ke *createdTask sebelum
+  thread dimulai (FreeRTOS juga mengisinya sebelum task bisa berjalan), sehingga
+  perbandingan xTaskGetCurrentTaskHandle() di rtos_tasks langsung benar.
+*/
+
+#include <Arduino.h>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include "components/hal/hal.h"
+
+// Ukuran stack loopTask Arduino-ESP32 (CONFIG_ARDUINO_LOOP_STACK_SIZE)
+#define HOST_LOOP_TASK_STACK 8192
+
+struct HostTask {
+  const char* name;
+  uint32_t stackDepth;
+};
+
+struct HostSemaphore {
+  std::mutex lock;
+  std::condition_variable available;
+  bool given;
+};
+
+static HostTask loopTask = {"loopTask", HOST_LOOP_TASK_STACK};
+static thread_local HostTask* currentTask = &loopTask;
+
+// --- Task ---
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                                   void* parameter, UBaseType_t priority, TaskHandle_t* createdTask,
+                                   BaseType_t coreId) {
+  HostTask* task = new HostTask{name, stackDepth};
+  if (createdTask != nullptr) *createdTask = task;
+  std::thread([task, function, parameter]() {
+    currentTask = task;
+    function(parameter);
+  }).detach();
+  return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  return currentTask;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  hal_delay_us(ticks * 1000UL);
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+  if (task == nullptr) task = currentTask;
+  return task->stackDepth;
+}
+
+// --- Binary Semaphore ---
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+  HostSemaphore* semaphore = new HostSemaphore();
+  semaphore->given = false;
+  return semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+  std::unique_lock<std::mutex> guard(semaphore->lock);
+  if (ticks == portMAX_DELAY) {
+    semaphore->available.wait(guard, [semaphore]() { return semaphore->given; });
+  } else if (!semaphore->available.wait_for(guard, std::chrono::milliseconds(ticks),
+                                             [semaphore]() { return semaphore->given; })) {
+    return pdFALSE;
+  }
+  semaphore->given = false;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  std::lock_guard<std::mutex> guard(semaphore->lock);
+  if (semaphore->given) return pdFALSE;
+  semaphore->given = true;
+  semaphore->available.notify_one();
+  return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+  delete semaphore;
+}
@@ -0,0 +1,63 @@
+#ifndef ARDUINO_HOST_FREERTOS_H
+#define ARDUINO_HOST_FREERTOS_H
+
+// --- FreeRTOS untuk Host ---
+// Task = std::thread (prioritas & pinning core diabaikan, penjadwal OS yang memutuskan),
+// critical section = recursive mutex per portMUX, binary semaphore = mutex + condvar.
+// Satu tick = 1 ms seperti konfigurasi Arduino-ESP32 (CONFIG_FREERTOS_HZ 1000).
+
+#include <stdint.h>
+#include <mutex>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+typedef struct HostTask* TaskHandle_t;
+typedef struct HostSemaphore* SemaphoreHandle_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+#if ARDUINO_HOST_SINGLE_THREAD
+// Program berthread tunggal (simulator 'sim/'): semua grup scheduler dijalankan satu
+// thread, jadi critical section tidak perlu mengunci apa pun.
+struct portMUX_TYPE {};
+#define portMUX_INITIALIZER_UNLOCKED {}
+
+static inline void portENTER_CRITICAL(portMUX_TYPE* mux) {}
+static inline void portEXIT_CRITICAL(portMUX_TYPE* mux) {}
+static inline void portENTER_CRITICAL_ISR(portMUX_TYPE* mux) {}
+static inline void portEXIT_CRITICAL_ISR(portMUX_TYPE* mux) {}
+#else
+struct portMUX_TYPE {
+  std::recursive_mutex mutex;
+};
+#define portMUX_INITIALIZER_UNLOCKED {}
+
+static inline void portENTER_CRITICAL(portMUX_TYPE* mux) { mux->mutex.lock(); }
+static inline void portEXIT_CRITICAL(portMUX_TYPE* mux) { mux->mutex.unlock(); }
+static inline void portENTER_CRITICAL_ISR(portMUX_TYPE* mux) { mux->mutex.lock(); }
+static inline void portEXIT_CRITICAL_ISR(portMUX_TYPE* mux) { mux->mutex.unlock(); }
+#endif
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                                   void* parameter, UBaseType_t priority, TaskHandle_t* createdTask,
+                                   BaseType_t coreId);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+void vTaskDelay(TickType_t ticks);
+// Host tidak mengukur pemakaian stack: dilaporkan ukuran stack yang diminta (byte)
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+SemaphoreHandle_t xSemaphoreCreateBinary();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+void vSemaphoreDelete(SemaphoreHandle_t semaphore);
+
+#endif // ARDUINO_HOST_FREERTOS_H
@@ -0,0 +1,80 @@
+"""
+scripts/bench_compare.py - Membandingkan Dua Hasil Microbenchmark
+
+Membaca dua hasil program bench (lihat bench/bench_main.cpp): file JSON dari
+'--json PATH' di host, atau log Serial ESP32 yang berisi baris "[BENCH_JSON] {...}".
+Setiap kasus dicetak dengan perubahan ns/op, alloc/op & B/op.
+
+Pemakaian:
+    python scripts/bench_compare.py lama.json baru.json [--threshold 10]
+
+Exit code 1 jika ada kasus yang melambat lebih dari threshold persen (median ns/op)
+atau yang alokasinya per operasi bertambah, sehingga bisa dipakai di CI antar commit.
+"""
+
+import argparse
+import json
+import sys
+
+JSON_LOG_PREFIX = "[BENCH_JSON]"
+
+
+def load_results(path):
+    with open(path, encoding="utf-8", errors="replace") as f:
+        text = f.read()
+    # Log Serial: ambil baris [BENCH_JSON] terakhir
+    for line in reversed(text.splitlines()):
+        index = line.find(JSON_LOG_PREFIX)
+        if index >= 0:
+            text = line[index + len(JSON_LOG_PREFIX):]
+            break
+    data = json.loads(text)
+    return data.get("platform", "?"), {r["name"]: r for r in data["results"]}
+
+
+def percent_change(old, new):
+    if not old:
+        return 0.0 if not new else float("inf")
+    return (new - old) * 100.0 / old
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Bandingkan dua hasil microbenchmark.")
+    parser.add_argument("baseline")
+    parser.add_argument("candidate")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="batas perlambatan ns/op dalam persen (default 10)")
+    args = parser.parse_args()
+
+    old_platform, old = load_results(args.baseline)
+    new_platform, new = load_results(args.candidate)
+    if old_platform != new_platform:
+        print(f"[BENCH] Peringatan: platform berbeda ({old_platform} vs {new_platform})")
+
+    regressions = 0
+    print(f"{'kasus':<22} {'ns/op lama':>12} {'ns/op baru':>12} {'delta':>8} {'alloc/op':>14} {'B/op':>16}")
+    for name in sorted(set(old) | set(new)):
+        if name not in old or name not in new:
+            print(f"{name:<22} {'(hanya di ' + ('lama' if name in old else 'baru') + ')':>34}")
+            continue
+        a, b = old[name], new[name]
+        delta = percent_change(a["nsPerOp"], b["nsPerOp"])
+        flags = []
+        if delta > args.threshold:
+            flags.append("LEBIH LAMBAT")
+        if b["allocsPerOp"] > a["allocsPerOp"]:
+            flags.append("ALOKASI BERTAMBAH")
+        regressions += bool(flags)
+        print(f"{name:<22} {a['nsPerOp']:>12.1f} {b['nsPerOp']:>12.1f} {delta:>+7.1f}% "
+              f"{a['allocsPerOp']:>6.2f}->{b['allocsPerOp']:<6.2f} "
+              f"{a['bytesPerOp']:>7.1f}->{b['bytesPerOp']:<7.1f} {' '.join(flags)}")
+
+    if regressions:
+        print(f"[BENCH] {regressions} kasus mengalami regresi.")
+        return 1
+    print("[BENCH] Tidak ada regresi.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,146 @@
+"""
+scripts/compress_assets.py - Kompresi Aset Web Sebelum Build Filesystem
+
+Dijalankan oleh PlatformIO sebagai extra_script (pre) untuk setiap build.
+Semua file di 'data/' di-gzip ke '.pio/build/<env>/data_gz/', lalu direktori
+itu dipakai sebagai sumber image SPIFFS (buildfs/uploadfs). Script juga menulis
+'assets.manifest' berisi path, ETag kuat (hash isi gzip), dan Content-Type
+setiap aset, yang dibaca firmware saat boot (lihat components/web_assets).
+
+Format tiap baris manifest:
+    <path url> <etag> <content-type>
+
+Hasil gzip yang sama juga ditulis sebagai array byte constexpr di
+'.pio/build/<env>/generated/embedded_assets.h'. Header ini hanya dipakai jika
+firmware dibangun dengan -D DASHBOARD_EMBEDDED (env esp32dev_embedded), sehingga
+dashboard disajikan langsung dari flash tanpa SPIFFS.
+"""
+
+import gzip
+import hashlib
+import os
+
+Import("env")  # noqa: F821 - disediakan oleh SCons/PlatformIO
+
+MANIFEST_NAME = "assets.manifest"
+EMBEDDED_HEADER_NAME = "embedded_assets.h"
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".htm": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".jpg": "image/jpeg",
+    ".ico": "image/x-icon",
+    ".txt": "text/plain",
+}
+
+
+def write_if_changed(path, content):
+    # Hindari menulis ulang file yang sama agar image SPIFFS / firmware tidak dibangun ulang
+    if os.path.isfile(path):
+        with open(path, "rb") as f:
+            if f.read() == content:
+                return
+    with open(path, "wb") as f:
+        f.write(content)
+
+
+def compress_assets(source_dir, output_dir):
+    manifest_lines = []
+    assets = []
+    expected_files = {MANIFEST_NAME}
+
+    for root, _, files in os.walk(source_dir):
+        for name in sorted(files):
+            source_path = os.path.join(root, name)
+            url_path = "/" + os.path.relpath(source_path, source_dir).replace(os.sep, "/")
+            content_type = CONTENT_TYPES.get(os.path.splitext(name)[1].lower(),
+                                             "application/octet-stream")
+
+            with open(source_path, "rb") as f:
+                raw = f.read()
+            # mtime=0 agar hasil gzip (dan ETag) hanya bergantung pada isi file
+            compressed = gzip.compress(raw, compresslevel=9, mtime=0)
+            etag = '"%s"' % hashlib.sha256(compressed).hexdigest()[:16]
+
+            output_name = url_path.lstrip("/") + ".gz"
+            output_path = os.path.join(output_dir, output_name)
+            os.makedirs(os.path.dirname(output_path), exist_ok=True)
+            write_if_changed(output_path, compressed)
+            expected_files.add(output_name.replace("/", os.sep))
+
+            manifest_lines.append("%s %s %s" % (url_path, etag, content_type))
+            assets.append((url_path, etag, content_type, compressed))
+            print("[compress_assets] %s: %d -> %d byte" % (url_path, len(raw), len(compressed)))
+
+    write_if_changed(os.path.join(output_dir, MANIFEST_NAME),
+                     ("\n".join(manifest_lines) + "\n").encode("ascii"))
+
+    # Hapus hasil lama dari file sumber yang sudah tidak ada
+    for root, _, files in os.walk(output_dir):
+        for name in files:
+            relative = os.path.relpath(os.path.join(root, name), output_dir)
+            if relative not in expected_files:
+                os.remove(os.path.join(root, name))
+
+    return assets
+
+
+def write_embedded_header(path, assets):
+    lines = [
+        "// Dibuat otomatis oleh scripts/compress_assets.py - jangan diedit.",
+        "#ifndef EMBEDDED_ASSETS_H",
+        "#define EMBEDDED_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+    for index, (url_path, _, _, compressed) in enumerate(assets):
+        lines.append("// %s (%d byte gzip)" % (url_path, len(compressed)))
+        lines.append("static constexpr uint8_t EMBEDDED_ASSET_%d[] PROGMEM = {" % index)
+        for offset in range(0, len(compressed), 16):
+            chunk = compressed[offset:offset + 16]
+            lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+        lines.append("};")
+        lines.append("")
+
+    lines += [
+        "struct EmbeddedAsset {",
+        "  const char* path;",
+        "  const char* etag;",
+        "  const char* contentType;",
+        "  const uint8_t* data;",
+        "  size_t length;",
+        "};",
+        "",
+        "static constexpr EmbeddedAsset EMBEDDED_ASSETS[] = {",
+    ]
+    for index, (url_path, etag, content_type, _) in enumerate(assets):
+        lines.append('  {"%s", "%s", "%s", EMBEDDED_ASSET_%d, sizeof(EMBEDDED_ASSET_%d)},'
+                     % (url_path, etag.replace('"', '\\"'), content_type, index, index))
+    lines += [
+        "};",
+        "static constexpr size_t EMBEDDED_ASSET_COUNT = %d;" % len(assets),
+        "",
+        "#endif // EMBEDDED_ASSETS_H",
+    ]
+    write_if_changed(path, ("\n".join(lines) + "\n").encode("ascii"))
+
+
+project_dir = env.subst("$PROJECT_DIR")  # noqa: F821
+build_dir = os.path.join(env.subst("$PROJECT_BUILD_DIR"), env.subst("$PIOENV"))  # noqa: F821
+source_dir = os.path.join(project_dir, "data")
+output_dir = os.path.join(build_dir, "data_gz")
+generated_dir = os.path.join(build_dir, "generated")
+os.makedirs(output_dir, exist_ok=True)
+os.makedirs(generated_dir, exist_ok=True)
+
+assets = compress_assets(source_dir, output_dir)
+write_embedded_header(os.path.join(generated_dir, EMBEDDED_HEADER_NAME), assets)
+
+env.Replace(PROJECT_DATA_DIR=output_dir)  # noqa: F821
+env.Append(CPPPATH=[generated_dir])  # noqa: F821
@@ -0,0 +1,601 @@
+/*
+  sim/brew_sim.cpp - Simulator Siklus Seduh dengan Clock Virtual
+  Menjalankan komponen firmware asli (order_coffee, motor_control, lcd_display,
+  rfid_card_reader, temperature_humidity, storage_detector, telemetry) di atas HAL host,
+  tanpa main.cpp, jaringan, maupun thread FreeRTOS. Grup scheduler kontrol & IO dijalankan
+  bergantian dalam satu thread, dan clock virtual langsung dimajukan ke waktu jatuh tempo
+  task berikutnya, sehingga menunggu antar langkah seduh tidak memakan waktu nyata.
+  Firmware memakai state global, jadi paralelisme lewat proses: --jobs N menjalankan N
+  replikasi (seed berbeda) di proses anak lalu menggabungkan sampelnya.
+  Exit code 1 jika target siklus tidak tercapai, pesanan web pernah menimpa pilihan
+  pelanggan di tempat yang belum dikonfirmasi (tap kartu berpacu dengan antrean web), atau
+  heap firmware di akhir lebih besar daripada setelah pemanasan 1 jam (lihat sim_heap.h).
+
+  Pemakaian ('pio run -e sim' lalu '.pio/build/sim/program'):
+    --cycles N            jumlah seduhan yang disimulasikan (default 1000)
+    --soak-hours X        uji soak: jalan X jam virtual, --cycles diabaikan (mis. 72)
+    --jobs N              jumlah proses replikasi paralel, seed+0..N-1 (default 1)
+    --seed N              seed RNG kedatangan pelanggan & gangguan sensor (default 1)
+    --arrival-s X         rata-rata jeda antar pelanggan, detik virtual (default 75)
+    --walkup F            porsi pelanggan di tempat (kartu + tombol), 0..1 (default 0.3)
+    --refill-delay-s X    operator mengisi hopper X detik setelah stok LOW (default 120)
+    --dht-faults-per-hour X  gangguan DHT22 10 detik per jam (default 2)
+    --json PATH           laporan lengkap sebagai JSON ('-' = stdout)
+    --verbose             tampilkan Serial firmware (log komponen) ke stdout
+*/
+
+#include <Arduino.h>
+#include <chrono>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "components/hal/hal_host.h"
+#include "components/i2c_bus/i2c_bus.h"
+#include "components/lcd_display/lcd_display.h"
+#include "components/machine_state/machine_state.h"
+#include "components/motor_control/motor_control.h"
+#include "components/order_coffee/order_coffee.h"
+#include "components/rfid_card_reader/rfid_card_reader.h"
+#include "components/rtos_tasks/rtos_tasks.h"
+#include "components/scheduler/scheduler.h"
+#include "components/storage_detector/storage_detector.h"
+#include "components/telemetry/telemetry.h"
+#include "components/temperature_humidity/temperature_humidity.h"
+#include "sim_heap.h"
+#include "sim_plant.h"
+#include "sim_stats.h"
+#include "sim_workload.h"
+
+#define SIM_SENSOR_INTERVAL_MS 2000UL   // Sama dengan sensorReadInterval di main.cpp
+#define SIM_AMBIENT_C 27.5f             // Suhu & kelembaban ruangan rata-rata
+#define SIM_AMBIENT_RH 60.0f
+#define SIM_MAX_IDLE_MS RTOS_MAX_IDLE_MS
+#define SIM_MAX_VIRTUAL_DAYS 365UL      // Pengaman jika konfigurasi tidak pernah selesai
+#define SIM_MAX_JOBS 64
+#define SIM_REPORT_BUFFER_SIZE 8192
+
+// --- Stub Simbol main.cpp ---
+// Dipakai web_api & ws_command, yang ikut terhubung tetapi tidak pernah dipanggil di sini
+void requestWsSnapshot(unsigned int clientId) {}
+void toggleWebRelay() {}
+
+struct SimOptions {
+  unsigned long cycles;
+  float soakHours; // 0 = berhenti setelah --cycles seduhan
+  int jobs;
+  uint32_t seed;
+  const char* jsonPath;
+  bool verbose;
+  SimPlantConfig plant;
+  SimWorkloadConfig workload;
+};
+
+// Penghitung satu replikasi; dijumlahkan apa adanya saat replikasi digabung
+struct SimCounters {
+  unsigned long cycles;
+  uint64_t busyMs;
+  uint64_t virtualMs;
+  unsigned long long passes;
+  SimWorkloadTotals orders;
+  SimPlantTotals plant;
+  SimHeapTotals heap;
+};
+
+// --- Statistik Siklus ---
+static SimSeries brewSeries;        // BREW_FILL_WATER -> BREW_DONE
+static SimSeries cycleSeries;       // BREW_FILL_WATER -> kembali BREW_IDLE (termasuk tampilan "Siap!")
+static SimSeries phaseSeries[BREW_PHASE_COUNT];
+static SimSeries waitSeries[SIM_CHANNEL_COUNT];
+static SimSeries actuatorSeries[ACT_COUNT]; // On-time per siklus (detik)
+static SimSeries cupSeries;
+static SimSeries powderSeries;
+static SimSeries brewTempSeries;
+static SimCounters counters;
+
+static unsigned long cycleStartMs = 0;
+static unsigned long phaseStartMs = 0;
+static BrewPhase lastPhase = BREW_IDLE;
+static bool inCycle = false;
+static uint64_t cycleStartOnUs[ACT_COUNT];
+
+static const char* CHANNEL_NAMES[SIM_CHANNEL_COUNT] = {"web", "walkup"};
+
+// Semua deret dalam urutan tetap, dipakai untuk mengirim & menggabungkan sampel replikasi
+#define SIM_SERIES_COUNT (5 + BREW_PHASE_COUNT + SIM_CHANNEL_COUNT + ACT_COUNT)
+
+static size_t listSeries(SimSeries** out) {
+  size_t count = 0;
+  out[count++] = &brewSeries;
+  out[count++] = &cycleSeries;
+  for (SimSeries& series : phaseSeries) out[count++] = &series;
+  for (SimSeries& series : waitSeries) out[count++] = &series;
+  for (SimSeries& series : actuatorSeries) out[count++] = &series;
+  out[count++] = &cupSeries;
+  out[count++] = &powderSeries;
+  out[count++] = &brewTempSeries;
+  return count;
+}
+
+static void onOrderStart(const SimOrderStart& order) {
+  sim_series_add(waitSeries[order.channel], order.waitMs / 1000.0f);
+}
+
+static void onSimEvent(const BusEvent& event) {
+  SimHeapPause pause; // Deret sampel simulator bukan heap firmware
+  if (event.type != EVT_BREW_PHASE) return;
+  BrewPhase phase = (BrewPhase)event.value;
+  unsigned long now = event.timestamp;
+  if (inCycle && lastPhase != phase) sim_series_add(phaseSeries[lastPhase], (now - phaseStartMs) / 1000.0f);
+  phaseStartMs = now;
+  lastPhase = phase;
+
+  const SimPlantTotals& totals = sim_plant_totals();
+  if (phase == BREW_FILL_WATER) {
+    inCycle = true;
+    cycleStartMs = now;
+    memcpy(cycleStartOnUs, totals.actuatorOnUs, sizeof(cycleStartOnUs));
+  } else if (phase == BREW_DONE && inCycle) {
+    sim_series_add(brewSeries, (now - cycleStartMs) / 1000.0f);
+    for (int i = 0; i < ACT_COUNT; i++) {
+      sim_series_add(actuatorSeries[i], (totals.actuatorOnUs[i] - cycleStartOnUs[i]) / 1e6f);
+    }
+    const SimCup& cup = sim_plant_cup();
+    sim_series_add(cupSeries, cup.waterMl);
+    sim_series_add(powderSeries, cup.powderG);
+    sim_series_add(brewTempSeries, cup.brewTempC);
+  } else if (phase == BREW_IDLE && inCycle) {
+    sim_series_add(cycleSeries, (now - cycleStartMs) / 1000.0f);
+    counters.busyMs += now - cycleStartMs;
+    counters.cycles++;
+    inCycle = false;
+  }
+}
+
+// --- Firmware ---
+// Pembacaan sensor jarak, seperti task "sensors" di main.cpp
+static void sensorTask(unsigned long currentMillis) {
+  readTelemetrySensors();
+}
+
+// Urutan sama dengan setup() di main.cpp, tanpa WiFi, web server, SPIFFS & logger
+static void setupFirmware() {
+  sim_heap_track(true); // Alokasi saat setup ikut menjadi bagian heap firmware
+  setupRtosTasks();
+  setupI2cBus();
+  setupLCD();
+  setupMotorControl(I2C_MOTOR_ADDRESS);
+  setupOrderCoffee(I2C_FRONT_PANEL_ADDRESS);
+  hal_spi_begin();
+  setupRfidCardReader();
+  setupTemperatureHumidity();
+  storage_detector_init_all_sensors();
+  scheduler_add_periodic("sensors", sensorTask, SIM_SENSOR_INTERVAL_MS, TASK_PRIORITY_LOW, SCHED_GROUP_IO);
+  displayIdleMenu();
+  machine_state_publish_control();
+  machine_state_publish_sensors();
+  sim_heap_track(false);
+}
+
+// Satu putaran: input model & pelanggan, lalu grup yang punya task jatuh tempo (kontrol
+// dulu, seperti task FreeRTOS berprioritas lebih tinggi di core yang sama). Grup yang
+// belum jatuh tempo tidak dijalankan, sama seperti task-nya yang masih tidur. Clock
+// virtual lalu maju ke task atau aksi pelanggan berikutnya.
+static unsigned long controlDueMs = 0;
+static unsigned long ioDueMs = 0;
+
+static void runPass() {
+  sim_workload_step();
+  sim_plant_step();
+  unsigned long now = millis();
+  sim_heap_track(true);
+  if ((long)(now - controlDueMs) >= 0) {
+    scheduler_run(SCHED_GROUP_CONTROL, now);
+    machine_state_publish_control();
+  }
+  if ((long)(millis() - ioDueMs) >= 0) {
+    scheduler_run(SCHED_GROUP_IO, millis());
+    machine_state_publish_sensors();
+  }
+  sim_heap_track(false);
+  counters.passes++;
+
+  // Jadwal dihitung ulang setelah kedua grup, karena task satu grup bisa menjadwalkan
+  // task one-shot di grup lain (mis. reset tampilan RFID)
+  now = millis();
+  unsigned long controlWaitMs = scheduler_next_wait(SCHED_GROUP_CONTROL, now, SIM_MAX_IDLE_MS);
+  unsigned long ioWaitMs = scheduler_next_wait(SCHED_GROUP_IO, now, SIM_MAX_IDLE_MS);
+  controlDueMs = now + controlWaitMs;
+  ioDueMs = now + ioWaitMs;
+  unsigned long waitMs = sim_workload_next_wait(controlWaitMs < ioWaitMs ? controlWaitMs : ioWaitMs);
+  hal_host_advance_us((waitMs > 0 ? waitMs : 1) * 1000ULL); // Minimal satu tick, seperti vTaskDelay
+}
+
+
+// Satu replikasi lengkap di proses ini (firmware hanya bisa disiapkan sekali per proses)
+static void runSimulation(const SimOptions& options, unsigned long cycles, uint32_t seed, char* programName) {
+  SimPlantConfig plant = options.plant;
+  plant.seed = seed * 2 + 1;
+  SimWorkloadConfig workload = options.workload;
+  workload.seed = seed;
+
+  Serial.setHostOutput(options.verbose ? stdout : nullptr);
+  hal_host_use_virtual_clock(true);
+  char* hostArgs[] = {programName, (char*)"--no-console"};
+  hal_host_begin(2, hostArgs);
+
+  sim_plant_begin(plant);
+  setupFirmware();
+  event_bus_subscribe(onSimEvent);
+  sim_workload_begin(workload, onOrderStart);
+
+  unsigned long startMs = millis();
+  const uint64_t soakMs = (uint64_t)(options.soakHours * 3600000.0);
+  const unsigned long maxVirtualMs = SIM_MAX_VIRTUAL_DAYS * 86400000UL;
+  bool warm = false;
+  while (millis() - startMs < maxVirtualMs) {
+    unsigned long elapsedMs = millis() - startMs;
+    if (!warm && elapsedMs >= SIM_HEAP_WARMUP_MS) {
+      sim_heap_mark_warm();
+      warm = true;
+    }
+    if (soakMs > 0) {
+      if (elapsedMs >= soakMs) break;
+    } else {
+      if (counters.cycles >= cycles) break;
+      const SimWorkloadTotals& orders = sim_workload_totals();
+      if (orders.arrivals[SIM_CHANNEL_WEB] + orders.arrivals[SIM_CHANNEL_WALKUP] - orders.rejected >= cycles) {
+        sim_workload_close(); // Cukup pelanggan untuk target siklus, sisanya tinggal dilayani
+      }
+    }
+    runPass();
+  }
+  counters.virtualMs = millis() - startMs;
+  counters.heap = sim_heap_totals();
+  counters.orders = sim_workload_totals();
+  counters.plant = sim_plant_totals();
+}
+
+// --- Replikasi Paralel ---
+static bool writeAll(int fd, const void* data, size_t length) {
+  const uint8_t* bytes = (const uint8_t*)data;
+  while (length > 0) {
+    ssize_t n = write(fd, bytes, length);
+    if (n <= 0) return false;
+    bytes += n;
+    length -= n;
+  }
+  return true;
+}
+
+static bool readAll(int fd, void* data, size_t length) {
+  uint8_t* bytes = (uint8_t*)data;
+  while (length > 0) {
+    ssize_t n = read(fd, bytes, length);
+    if (n <= 0) return false;
+    bytes += n;
+    length -= n;
+  }
+  return true;
+}
+
+// Format pipa: SimCounters, lalu per deret jumlah sampel (uint32) diikuti sampel float
+static bool sendResult(int fd) {
+  SimSeries* series[SIM_SERIES_COUNT];
+  size_t count = listSeries(series);
+  if (!writeAll(fd, &counters, sizeof(counters))) return false;
+  for (size_t i = 0; i < count; i++) {
+    uint32_t n = (uint32_t)series[i]->samples.size();
+    if (!writeAll(fd, &n, sizeof(n))) return false;
+    if (!writeAll(fd, series[i]->samples.data(), n * sizeof(float))) return false;
+  }
+  return true;
+}
+
+static void addCounters(const SimCounters& from) {
+  counters.cycles += from.cycles;
+  counters.busyMs += from.busyMs;
+  counters.virtualMs += from.virtualMs;
+  counters.passes += from.passes;
+
+  SimWorkloadTotals& orders = counters.orders;
+  for (int i = 0; i < SIM_CHANNEL_COUNT; i++) {
+    orders.arrivals[i] += from.orders.arrivals[i];
+    orders.started[i] += from.orders.started[i];
+  }
+  orders.rejected += from.orders.rejected;
+  orders.walkupRetries += from.orders.walkupRetries;
+  orders.menuCorrections += from.orders.menuCorrections;
+  orders.wrongMenu += from.orders.wrongMenu;
+  orders.unattributed += from.orders.unattributed;
+  orders.localOverrides += from.orders.localOverrides;
+
+  SimPlantTotals& plant = counters.plant;
+  for (int i = 0; i < ACT_COUNT; i++) {
+    plant.actuatorOnUs[i] += from.plant.actuatorOnUs[i];
+    plant.actuatorStarts[i] += from.plant.actuatorStarts[i];
+  }
+  for (int i = 0; i < SIM_HOPPER_COUNT; i++) {
+    plant.dispensedG[i] += from.plant.dispensedG[i];
+    plant.shortfallG[i] += from.plant.shortfallG[i];
+    plant.refills[i] += from.plant.refills[i];
+  }
+  plant.dhtFaults += from.plant.dhtFaults;
+  plant.waterUsedMl += from.plant.waterUsedMl;
+
+  // Heap dijumlahkan seperti penghitung lain: pertumbuhan total semua replikasi
+  SimHeapTotals& heap = counters.heap;
+  heap.liveBytesWarm += from.heap.liveBytesWarm;
+  heap.liveBytesEnd += from.heap.liveBytesEnd;
+  heap.liveBlocksEnd += from.heap.liveBlocksEnd;
+  heap.liveBytesMax += from.heap.liveBytesMax;
+  heap.allocs += from.heap.allocs;
+  heap.allocBytes += from.heap.allocBytes;
+}
+
+static bool mergeResult(int fd) {
+  SimCounters from;
+  if (!readAll(fd, &from, sizeof(from))) return false;
+  addCounters(from);
+
+  SimSeries* series[SIM_SERIES_COUNT];
+  size_t count = listSeries(series);
+  std::vector<float> samples;
+  for (size_t i = 0; i < count; i++) {
+    uint32_t n = 0;
+    if (!readAll(fd, &n, sizeof(n))) return false;
+    samples.resize(n);
+    if (!readAll(fd, samples.data(), n * sizeof(float))) return false;
+    for (float value : samples) sim_series_add(*series[i], value);
+  }
+  return true;
+}
+
+// Replikasi ke-j memakai seed + j dan mendapat bagian target siklus yang (hampir) sama
+static bool runJobs(const SimOptions& options, char* programName) {
+  int pipes[SIM_MAX_JOBS];
+  pid_t children[SIM_MAX_JOBS];
+  int started = 0;
+  fflush(stdout);
+  for (; started < options.jobs; started++) {
+    int fds[2];
+    if (pipe(fds) != 0) break;
+    pid_t pid = fork();
+    if (pid < 0) {
+      close(fds[0]);
+      close(fds[1]);
+      break;
+    }
+    if (pid == 0) {
+      close(fds[0]);
+      unsigned long cycles = options.cycles / options.jobs +
+                             ((unsigned long)started < options.cycles % options.jobs ? 1 : 0);
+      runSimulation(options, cycles, options.seed + started, programName);
+      bool sent = sendResult(fds[1]);
+      fflush(stdout);
+      _exit(sent ? 0 : 1); // Lewati destruktor global firmware
+    }
+    close(fds[1]);
+    pipes[started] = fds[0];
+    children[started] = pid;
+  }
+
+  bool ok = started == options.jobs;
+  if (!ok) fprintf(stderr, "[SIM] Hanya %d dari %d replikasi yang bisa dijalankan\n", started, options.jobs);
+  for (int job = 0; job < started; job++) {
+    if (!mergeResult(pipes[job])) {
+      fprintf(stderr, "[SIM] Hasil replikasi %d tidak lengkap\n", job);
+      ok = false;
+    }
+    close(pipes[job]);
+    int status = 0;
+    waitpid(children[job], &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) ok = false;
+  }
+  return ok;
+}
+// --- Laporan ---
+static void printReport(FILE* out, const SimOptions& options, double wallSeconds) {
+  const SimWorkloadTotals& orders = counters.orders;
+  const SimPlantTotals& plant = counters.plant;
+  double virtualSeconds = counters.virtualMs / 1000.0;
+
+  fprintf(out, "[SIM] %lu siklus seduh dalam %.2f s nyata, %d proses (%.1f jam virtual, %.0fx, %.0f siklus/s)\n",
+          counters.cycles, wallSeconds, options.jobs, virtualSeconds / 3600.0, virtualSeconds / wallSeconds,
+          counters.cycles / wallSeconds);
+  fprintf(out, "[SIM] Utilisasi mesin %.1f%%, %llu putaran scheduler\n",
+          virtualSeconds > 0 ? 100.0 * counters.busyMs / 1000.0 / virtualSeconds : 0.0, counters.passes);
+  fprintf(out, "[SIM] Waktu siklus (detik):\n");
+  sim_series_print(out, "seduh (isi air->siap)", brewSeries, "s");
+  sim_series_print(out, "siklus (isi air->idle)", cycleSeries, "s");
+  for (int phase = BREW_FILL_WATER; phase <= BREW_DONE; phase++) {
+    sim_series_print(out, brewPhaseName((BrewPhase)phase), phaseSeries[phase], "s");
+  }
+  fprintf(out, "[SIM] Waktu tunggu antrean (kedatangan->isi air, detik):\n");
+  for (int channel = 0; channel < SIM_CHANNEL_COUNT; channel++) {
+    sim_series_print(out, CHANNEL_NAMES[channel], waitSeries[channel], "s");
+  }
+  fprintf(out, "[SIM] Pesanan: web %lu datang / %lu ditolak (antrean penuh), di tempat %lu datang / "
+          "%lu ulang PB4 / %lu koreksi menu kartu, salah menu %lu, tanpa pemesan %lu\n",
+          orders.arrivals[SIM_CHANNEL_WEB], orders.rejected, orders.arrivals[SIM_CHANNEL_WALKUP],
+          orders.walkupRetries, orders.menuCorrections, orders.wrongMenu, orders.unattributed);
+  if (orders.localOverrides > 0) {
+    fprintf(out, "[SIM] GAGAL: %lu pesanan web menimpa pilihan pelanggan di tempat yang belum dikonfirmasi\n",
+            orders.localOverrides);
+  }
+  fprintf(out, "[SIM] On-time aktuator per siklus (detik):\n");
+  for (int i = 0; i < ACT_COUNT; i++) {
+    sim_series_print(out, actuatorName((ActuatorId)i), actuatorSeries[i], "s");
+  }
+  fprintf(out, "[SIM] Gelas:\n");
+  sim_series_print(out, "air", cupSeries, "ml");
+  sim_series_print(out, "bubuk", powderSeries, "g");
+  sim_series_print(out, "suhu air seduh", brewTempSeries, "C");
+  for (int i = 0; i < SIM_HOPPER_COUNT; i++) {
+    fprintf(out, "[SIM] Hopper %d: %.0f g dituang, %lu isi ulang, kurang %.1f g\n", i + 1,
+            plant.dispensedG[i], plant.refills[i], plant.shortfallG[i]);
+  }
+  fprintf(out, "[SIM] Air galon %.1f L, gangguan DHT22 %lu kali\n", plant.waterUsedMl / 1000.0f, plant.dhtFaults);
+
+  const SimHeapTotals& heap = counters.heap;
+  fprintf(out, "[SIM] Heap firmware: %llu B hidup setelah pemanasan, %llu B (%llu blok) di akhir, "
+          "maks %llu B; %llu alokasi (%llu B) setelah pemanasan\n",
+          (unsigned long long)heap.liveBytesWarm, (unsigned long long)heap.liveBytesEnd,
+          (unsigned long long)heap.liveBlocksEnd, (unsigned long long)heap.liveBytesMax,
+          (unsigned long long)heap.allocs, (unsigned long long)heap.allocBytes);
+  if (heap.liveBytesEnd > heap.liveBytesWarm) {
+    fprintf(out, "[SIM] GAGAL: heap firmware bertambah %llu B selama simulasi\n",
+            (unsigned long long)(heap.liveBytesEnd - heap.liveBytesWarm));
+  }
+}
+
+static void writeReportJson(JsonWriter& writer, const SimOptions& options, double wallSeconds) {
+  const SimWorkloadTotals& orders = counters.orders;
+  const SimPlantTotals& plant = counters.plant;
+  double virtualSeconds = counters.virtualMs / 1000.0;
+
+  writer.beginObject()
+    .field("cycles", counters.cycles)
+    .field("jobs", options.jobs)
+    .field("seed", (unsigned long)options.seed)
+    .field("wallSeconds", (float)wallSeconds, 3)
+    .field("virtualSeconds", (float)virtualSeconds, 1)
+    .field("cyclesPerSecond", (float)(counters.cycles / wallSeconds), 1)
+    .field("utilization", virtualSeconds > 0 ? (float)(counters.busyMs / 1000.0 / virtualSeconds) : 0.0f, 3);
+  sim_series_write_json(writer, "brewSeconds", brewSeries, 3);
+  sim_series_write_json(writer, "cycleSeconds", cycleSeries, 3);
+  writer.beginObject("phaseSeconds");
+  for (int phase = BREW_FILL_WATER; phase <= BREW_DONE; phase++) {
+    sim_series_write_json(writer, brewPhaseName((BrewPhase)phase), phaseSeries[phase], 3);
+  }
+  writer.endObject();
+  writer.beginObject("queueWaitSeconds");
+  for (int channel = 0; channel < SIM_CHANNEL_COUNT; channel++) {
+    sim_series_write_json(writer, CHANNEL_NAMES[channel], waitSeries[channel], 3);
+  }
+  writer.endObject();
+  writer.beginObject("orders")
+    .field("webArrivals", orders.arrivals[SIM_CHANNEL_WEB])
+    .field("webRejected", orders.rejected)
+    .field("walkupArrivals", orders.arrivals[SIM_CHANNEL_WALKUP])
+    .field("walkupRetries", orders.walkupRetries)
+    .field("menuCorrections", orders.menuCorrections)
+    .field("wrongMenu", orders.wrongMenu)
+    .field("unattributed", orders.unattributed)
+    .field("localOverrides", orders.localOverrides)
+    .endObject();
+  writer.beginObject("actuatorSecondsPerCycle");
+  for (int i = 0; i < ACT_COUNT; i++) {
+    sim_series_write_json(writer, actuatorName((ActuatorId)i), actuatorSeries[i], 3);
+  }
+  writer.endObject();
+  writer.beginObject("actuatorStarts");
+  for (int i = 0; i < ACT_COUNT; i++) {
+    writer.field(actuatorName((ActuatorId)i), plant.actuatorStarts[i]);
+  }
+  writer.endObject();
+  sim_series_write_json(writer, "cupMl", cupSeries, 1);
+  sim_series_write_json(writer, "powderG", powderSeries, 2);
+  sim_series_write_json(writer, "brewTempC", brewTempSeries, 1);
+  writer.beginArray("hoppers");
+  for (int i = 0; i < SIM_HOPPER_COUNT; i++) {
+    writer.beginObject()
+      .field("dispensedG", plant.dispensedG[i], 1)
+      .field("refills", plant.refills[i])
+      .field("shortfallG", plant.shortfallG[i], 1)
+      .endObject();
+  }
+  writer.endArray();
+  writer.field("waterUsedL", plant.waterUsedMl / 1000.0f, 2)
+    .field("dhtFaults", plant.dhtFaults);
+  const SimHeapTotals& heap = counters.heap;
+  writer.beginObject("heap")
+    .field("liveBytesWarm", (unsigned long)heap.liveBytesWarm)
+    .field("liveBytesEnd", (unsigned long)heap.liveBytesEnd)
+    .field("liveBlocksEnd", (unsigned long)heap.liveBlocksEnd)
+    .field("liveBytesMax", (unsigned long)heap.liveBytesMax)
+    .field("allocsAfterWarmup", (unsigned long)heap.allocs)
+    .field("allocBytesAfterWarmup", (unsigned long)heap.allocBytes)
+    .endObject();
+  writer.endObject();
+}
+
+static bool saveReportJson(const char* path, const SimOptions& options, double wallSeconds) {
+  static char buffer[SIM_REPORT_BUFFER_SIZE];
+  JsonWriter writer(buffer, sizeof(buffer));
+  writeReportJson(writer, options, wallSeconds);
+  if (writer.overflowed()) {
+    fprintf(stderr, "[SIM] Laporan JSON melebihi %d byte.\n", SIM_REPORT_BUFFER_SIZE);
+    return false;
+  }
+  FILE* out = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+  if (out == nullptr) {
+    fprintf(stderr, "[SIM] Gagal menulis %s\n", path);
+    return false;
+  }
+  fprintf(out, "%s\n", writer.c_str());
+  if (out != stdout) fclose(out);
+  return true;
+}
+
+// --- Opsi ---
+static const char* optionValue(int argc, char** argv, const char* name) {
+  for (int i = 1; i + 1 < argc; i++) {
+    if (strcmp(argv[i], name) == 0) return argv[i + 1];
+  }
+  return nullptr;
+}
+
+static float optionFloat(int argc, char** argv, const char* name, float fallback) {
+  const char* value = optionValue(argc, argv, name);
+  return value != nullptr ? strtof(value, nullptr) : fallback;
+}
+
+static bool optionFlag(int argc, char** argv, const char* name) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], name) == 0) return true;
+  }
+  return false;
+}
+
+int main(int argc, char** argv) {
+  SimOptions options;
+  options.cycles = strtoul(optionValue(argc, argv, "--cycles") ?: "1000", nullptr, 10);
+  options.soakHours = optionFloat(argc, argv, "--soak-hours", 0);
+  options.jobs = atoi(optionValue(argc, argv, "--jobs") ?: "1");
+  options.seed = strtoul(optionValue(argc, argv, "--seed") ?: "1", nullptr, 10);
+  options.jsonPath = optionValue(argc, argv, "--json");
+  options.verbose = optionFlag(argc, argv, "--verbose");
+
+  options.plant.ambientC = SIM_AMBIENT_C;
+  options.plant.humidityPct = SIM_AMBIENT_RH;
+  options.plant.refillDelayMs = (unsigned long)(optionFloat(argc, argv, "--refill-delay-s", 120) * 1000);
+  options.plant.dhtFaultsPerHour = optionFloat(argc, argv, "--dht-faults-per-hour", 2);
+  options.workload.arrivalMeanS = optionFloat(argc, argv, "--arrival-s", 75);
+  options.workload.walkupFraction = optionFloat(argc, argv, "--walkup", 0.3f);
+  if (options.cycles == 0 || options.workload.arrivalMeanS <= 0) {
+    fprintf(stderr, "[SIM] --cycles dan --arrival-s harus lebih dari 0\n");
+    return 2;
+  }
+  if (options.jobs < 1 || options.jobs > SIM_MAX_JOBS || (unsigned long)options.jobs > options.cycles) {
+    fprintf(stderr, "[SIM] --jobs harus 1..%d dan tidak lebih dari --cycles\n", SIM_MAX_JOBS);
+    return 2;
+  }
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+
+  auto wallStart = std::chrono::steady_clock::now();
+  bool ok = true;
+  if (options.jobs == 1) {
+    runSimulation(options, options.cycles, options.seed, argv[0]);
+  } else {
+    ok = runJobs(options, argv[0]);
+  }
+  double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+  printReport(stdout, options, wallSeconds);
+  if (options.jsonPath != nullptr && !saveReportJson(options.jsonPath, options, wallSeconds)) return 1;
+  // Pesanan web tidak boleh menimpa pilihan di tempat (tap kartu berpacu dengan antrean)
+  if (counters.orders.localOverrides > 0) ok = false;
+  // Heap firmware harus datar: tidak ada blok baru yang tertahan setelah pemanasan
+  if (counters.heap.liveBytesEnd > counters.heap.liveBytesWarm) ok = false;
+  if (options.soakHours > 0) return ok ? 0 : 1;
+  return ok && counters.cycles >= options.cycles ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+/*
+  sim/sim_heap.cpp - Pelacak Heap Firmware untuk Uji Soak
+  Simulator berjalan dalam satu thread (ARDUINO_HOST_SINGLE_THREAD), jadi penghitung
+  tidak memerlukan atomic.
+*/
+
+#include "sim_heap.h"
+#include <new>
+
+// Header di depan setiap blok; 16 byte agar alignment malloc tetap terjaga
+struct SimBlockHeader {
+  size_t size;
+  size_t tracked;
+};
+static_assert(sizeof(SimBlockHeader) % alignof(max_align_t) == 0, "header merusak alignment");
+
+static bool tracking = false;
+static bool warm = false;
+static uint64_t liveBytes = 0;
+static uint64_t liveBlocks = 0;
+static SimHeapTotals totals = {};
+
+static void* trackedAlloc(size_t size) {
+  SimBlockHeader* header = (SimBlockHeader*)malloc(sizeof(SimBlockHeader) + size);
+  if (header == nullptr) abort(); // Setara std::bad_alloc, firmware dibangun tanpa exception
+  header->size = size;
+  header->tracked = tracking;
+  if (tracking) {
+    liveBytes += size;
+    liveBlocks++;
+    if (warm) {
+      totals.allocs++;
+      totals.allocBytes += size;
+      if (liveBytes > totals.liveBytesMax) totals.liveBytesMax = liveBytes;
+    }
+  }
+  return header + 1;
+}
+
+static void trackedFree(void* block) {
+  if (block == nullptr) return;
+  SimBlockHeader* header = (SimBlockHeader*)block - 1;
+  if (header->tracked) {
+    liveBytes -= header->size;
+    liveBlocks--;
+  }
+  free(header);
+}
+
+void* operator new(size_t size) { return trackedAlloc(size); }
+void* operator new[](size_t size) { return trackedAlloc(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+void operator delete(void* block) noexcept { trackedFree(block); }
+void operator delete[](void* block) noexcept { trackedFree(block); }
+void operator delete(void* block, size_t) noexcept { trackedFree(block); }
+void operator delete[](void* block, size_t) noexcept { trackedFree(block); }
+
+void sim_heap_track(bool enabled) {
+  tracking = enabled;
+}
+
+void sim_heap_mark_warm() {
+  warm = true;
+  totals.liveBytesWarm = liveBytes;
+  totals.liveBytesMax = liveBytes;
+  totals.allocs = 0;
+  totals.allocBytes = 0;
+}
+
+SimHeapTotals sim_heap_totals() {
+  SimHeapTotals current = totals;
+  current.liveBytesEnd = liveBytes;
+  current.liveBlocksEnd = liveBlocks;
+  if (!warm) current.liveBytesWarm = current.liveBytesMax = liveBytes;
+  return current;
+}
+
+SimHeapPause::SimHeapPause() : wasTracking(tracking) {
+  tracking = false;
+}
+
+SimHeapPause::~SimHeapPause() {
+  tracking = wasTracking;
+}
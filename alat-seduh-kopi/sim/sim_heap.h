@@ -0,0 +1,40 @@
+#ifndef SIM_HEAP_H
+#define SIM_HEAP_H
+
+#include <Arduino.h>
+
+// --- Pelacak Heap Firmware ---
+// operator new/delete global diganti (seperti penghitung alokasi di bench). Setiap blok
+// diberi header kecil berisi ukuran & penanda, sehingga hanya blok yang dialokasikan
+// selama firmware berjalan (sim_heap_track) yang dihitung sebagai heap firmware, termasuk
+// saat dibebaskan belakangan. Subscriber event bus milik simulator dipanggil sinkron dari
+// dalam firmware, jadi alokasinya dikecualikan dengan SimHeapPause.
+// Alokasi lewat malloc langsung tidak terhitung; Arduino String di host memakai std::string.
+// Host tidak punya padanan "largest free block": fragmentasi hanya bisa muncul dari
+// alokasi yang terus terjadi, jadi jumlah alokasi setelah pemanasan ikut dilaporkan.
+#define SIM_HEAP_WARMUP_MS 3600000UL // Heap dianggap stabil setelah 1 jam virtual
+
+struct SimHeapTotals {
+  uint64_t liveBytesWarm;  // Byte firmware yang masih hidup saat pemanasan selesai
+  uint64_t liveBytesEnd;   // ... di akhir simulasi
+  uint64_t liveBytesMax;   // Maksimum setelah pemanasan
+  uint64_t liveBlocksEnd;
+  uint64_t allocs;         // operator new firmware setelah pemanasan
+  uint64_t allocBytes;
+};
+
+/** @brief Menandai firmware sedang berjalan (alokasinya dihitung) atau tidak. */
+void sim_heap_track(bool enabled);
+/** @brief Mengambil byte hidup saat ini sebagai acuan, lalu mulai menghitung alokasi. */
+void sim_heap_mark_warm();
+/** @brief Total saat ini; liveBytesEnd & liveBlocksEnd diambil saat dipanggil. */
+SimHeapTotals sim_heap_totals();
+
+// Menghentikan penghitungan selama kode simulator berjalan di dalam firmware
+struct SimHeapPause {
+  SimHeapPause();
+  ~SimHeapPause();
+  bool wasTracking;
+};
+
+#endif // SIM_HEAP_H
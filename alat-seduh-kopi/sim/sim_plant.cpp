@@ -0,0 +1,197 @@
+/*
+  sim/sim_plant.cpp - Model Fisik Mesin Kopi (pompa, pemanas, hopper, sensor)
+  State aktuator berubah hanya lewat EVT_ACTUATOR, sehingga di antara dua event semua
+  laju aliran konstan: model cukup diintegrasikan saat event datang dan saat driver
+  simulator bangun. Stok hopper dibaca firmware lewat HC-SR04 (task "sensors"), dan
+  operator simulasi mengisi ulang hopper setelah firmware melaporkan stok LOW.
+*/
+
+#include "sim_plant.h"
+#include <algorithm>
+#include <random>
+#include "components/hal/host_peripherals.h"
+#include "components/order_coffee/order_coffee.h"
+#include "components/storage_detector/storage_detector.h"
+#include "components/telemetry/telemetry.h"
+#include "sim_heap.h"
+
+#define SIM_DHT_UPDATE_MS 1000UL
+#define SIM_DHT_FAULT_MS 10000UL
+#define SIM_DAY_S 86400.0f
+#define SIM_WATER_J_PER_ML_C 4.186f
+
+static SimPlantConfig config;
+static SimPlantTotals totals;
+static SimCup cup;
+static std::mt19937 rng;
+
+static uint8_t speeds[ACT_COUNT];
+static uint64_t lastStepUs = 0;
+static float ambientC = 27.0f;
+
+// Air & bubuk di sepanjang jalur seduh
+static float heaterMl = 0;
+static float heaterC = 27.0f;
+static float mixerMl = 0;
+
+// Hopper & operator
+static float hopperG[SIM_HOPPER_COUNT];
+static CoffeeStockStatus lastStock[SIM_HOPPER_COUNT];
+static uint64_t refillAtUs[SIM_HOPPER_COUNT]; // 0 = tidak ada pengisian terjadwal
+static bool hopperChanged = true;
+
+// DHT22
+static unsigned long nextDhtUpdateMs = 0;
+static unsigned long dhtFaultUntilMs = 0;
+
+static const ActuatorId HOPPER_MOTORS[SIM_HOPPER_COUNT] = {ACT_STORAGE_1, ACT_STORAGE_2, ACT_STORAGE_3};
+
+// --- Integrasi ---
+static void integrateHeater(float seconds) {
+  if (heaterMl >= SIM_HEATER_MIN_ML && heaterC < SIM_HEATER_CUTOFF_C) {
+    heaterC += SIM_HEATER_WATT * seconds / (heaterMl * SIM_WATER_J_PER_ML_C);
+    if (heaterC > SIM_HEATER_CUTOFF_C) heaterC = SIM_HEATER_CUTOFF_C;
+  }
+  heaterC -= (heaterC - ambientC) * SIM_HEATER_LOSS_PER_S * seconds;
+}
+
+// Memajukan model dari langkah terakhir sampai nowUs dengan state aktuator saat ini
+static void integrateTo(uint64_t nowUs) {
+  if (nowUs <= lastStepUs) return;
+  uint64_t elapsedUs = nowUs - lastStepUs;
+  float seconds = elapsedUs / 1e6f;
+  lastStepUs = nowUs;
+
+  for (int i = 0; i < ACT_COUNT; i++) {
+    if (speeds[i] > 0) totals.actuatorOnUs[i] += elapsedUs;
+  }
+
+  if (speeds[ACT_PUMP_GALON] > 0) {
+    // Air galon (suhu ruangan) bercampur dengan sisa air di pemanas
+    float addedMl = SIM_GALON_FLOW_ML_S * seconds;
+    heaterC = (heaterC * heaterMl + ambientC * addedMl) / (heaterMl + addedMl);
+    heaterMl += addedMl;
+    totals.waterUsedMl += addedMl;
+  }
+  integrateHeater(seconds);
+  if (speeds[ACT_PUMP_HOT_WATER] > 0) {
+    float movedMl = std::min(SIM_HOT_WATER_FLOW_ML_S * seconds, heaterMl);
+    heaterMl -= movedMl;
+    mixerMl += movedMl;
+  }
+  for (int i = 0; i < SIM_HOPPER_COUNT; i++) {
+    uint8_t speed = speeds[HOPPER_MOTORS[i]];
+    if (speed == 0) continue;
+    float wantedG = SIM_DISPENSE_G_S * seconds * speed / 255.0f;
+    float pouredG = std::min(wantedG, hopperG[i]);
+    hopperG[i] -= pouredG;
+    totals.dispensedG[i] += pouredG;
+    totals.shortfallG[i] += wantedG - pouredG;
+    cup.powderG += pouredG;
+    hopperChanged = true;
+  }
+  if (speeds[ACT_PUMP_SEDUH_KOPI] > 0) {
+    float pouredMl = std::min(SIM_POUR_FLOW_ML_S * seconds, mixerMl);
+    mixerMl -= pouredMl;
+    cup.waterMl += pouredMl;
+  }
+}
+
+// --- Sensor ---
+static void updateHopperSensors(uint64_t nowUs) {
+  const long readings[SIM_HOPPER_COUNT] = {telemetryDistance1, telemetryDistance2, telemetryDistance3};
+  for (int i = 0; i < SIM_HOPPER_COUNT; i++) {
+    // Operator bereaksi pada perubahan status ke LOW yang dilaporkan firmware
+    CoffeeStockStatus stock = coffeeStockStatusFromDistance(readings[i]);
+    if (stock == STOCK_LOW && lastStock[i] != STOCK_LOW && refillAtUs[i] == 0) {
+      refillAtUs[i] = nowUs + (uint64_t)config.refillDelayMs * 1000ULL;
+      if (refillAtUs[i] == 0) refillAtUs[i] = 1;
+    }
+    lastStock[i] = stock;
+    if (refillAtUs[i] != 0 && nowUs >= refillAtUs[i]) {
+      hopperG[i] = SIM_HOPPER_CAPACITY_G;
+      totals.refills[i]++;
+      refillAtUs[i] = 0;
+      hopperChanged = true;
+    }
+  }
+
+  // Jarak HC-SR04 hanya dihitung ulang jika isi hopper berubah
+  if (!hopperChanged) return;
+  hopperChanged = false;
+  for (int i = 0; i < SIM_HOPPER_COUNT; i++) {
+    float emptyFraction = 1.0f - hopperG[i] / SIM_HOPPER_CAPACITY_G;
+    host_ultrasonic(i).setDistance((int)lroundf(SIM_HOPPER_TOP_GAP_CM + emptyFraction * SIM_HOPPER_DEPTH_CM));
+  }
+}
+
+// Suhu ruangan berayun sinusoidal per hari virtual; DHT22 sesekali gagal dibaca
+static void updateAmbient(unsigned long nowMs) {
+  if (nowMs < nextDhtUpdateMs) return;
+  nextDhtUpdateMs = nowMs + SIM_DHT_UPDATE_MS;
+
+  float dayPhase = 2.0f * (float)M_PI * (nowMs / 1000.0f) / SIM_DAY_S;
+  ambientC = config.ambientC + 3.0f * sinf(dayPhase);
+  host_dht22().set(ambientC, config.humidityPct - 8.0f * sinf(dayPhase));
+
+  std::bernoulli_distribution fault(config.dhtFaultsPerHour * SIM_DHT_UPDATE_MS / 3600000.0f);
+  if (nowMs >= dhtFaultUntilMs && fault(rng)) {
+    dhtFaultUntilMs = nowMs + SIM_DHT_FAULT_MS;
+    totals.dhtFaults++;
+  }
+  host_dht22().setFailing(nowMs < dhtFaultUntilMs);
+}
+
+// --- Event Bus ---
+static void onPlantEvent(const BusEvent& event) {
+  SimHeapPause pause; // Dipanggil dari dalam firmware; alokasi model bukan heap firmware
+  if (event.type == EVT_ACTUATOR && event.id < ACT_COUNT) {
+    integrateTo(hal_host_now_us()); // Laju lama berlaku sampai saat event ini
+    uint8_t speed = (uint8_t)event.value;
+    if (speed > 0 && speeds[event.id] == 0) totals.actuatorStarts[event.id]++;
+    speeds[event.id] = speed;
+  } else if (event.type == EVT_BREW_PHASE) {
+    integrateTo(hal_host_now_us());
+    if (event.value == BREW_FILL_WATER) {
+      cup = SimCup();
+      mixerMl = 0; // Mixer dianggap dibilas di antara seduhan
+    } else if (event.value == BREW_HOT_WATER) {
+      cup.brewTempC = heaterC;
+    }
+  }
+}
+
+void sim_plant_begin(const SimPlantConfig& plantConfig) {
+  config = plantConfig;
+  totals = SimPlantTotals();
+  rng.seed(config.seed);
+  ambientC = config.ambientC;
+  heaterC = ambientC;
+  for (int i = 0; i < SIM_HOPPER_COUNT; i++) {
+    hopperG[i] = SIM_HOPPER_CAPACITY_G;
+    lastStock[i] = STOCK_AVAILABLE;
+    refillAtUs[i] = 0;
+  }
+  lastStepUs = hal_host_now_us();
+  event_bus_subscribe(onPlantEvent);
+  sim_plant_step();
+}
+
+void sim_plant_step() {
+  uint64_t nowUs = hal_host_now_us();
+  integrateTo(nowUs);
+  updateHopperSensors(nowUs);
+  updateAmbient((unsigned long)(nowUs / 1000));
+}
+
+const SimCup& sim_plant_cup() {
+  return cup;
+}
+
+const SimPlantTotals& sim_plant_totals() {
+  return totals;
+}
+
+float sim_plant_hopper_level(uint8_t index) {
+  return index < SIM_HOPPER_COUNT ? hopperG[index] : 0.0f;
+}
@@ -0,0 +1,60 @@
+#ifndef SIM_PLANT_H
+#define SIM_PLANT_H
+
+#include <Arduino.h>
+#include "components/motor_control/motor_control.h"
+
+// --- Model Fisik Mesin Kopi untuk Simulator ---
+// Digerakkan event EVT_ACTUATOR (pompa, motor storage) dan fase seduh, lalu diintegrasikan
+// terhadap clock virtual. Hasilnya dikembalikan ke firmware lewat periferal host:
+// jarak HC-SR04 mengikuti isi hopper, DHT22 mengikuti suhu ruangan.
+//   galon --(pompa galon)--> pemanas --(pompa air panas)--> mixer <-- hopper (motor storage)
+//   mixer --(selenoid seduh)--> gelas
+#define SIM_HOPPER_COUNT 3
+#define SIM_GALON_FLOW_ML_S 15.0f       // Pompa galon ke pemanas
+#define SIM_HOT_WATER_FLOW_ML_S 12.0f   // Pompa air panas ke mixer
+#define SIM_POUR_FLOW_ML_S 20.0f        // Selenoid seduh dari mixer ke gelas
+#define SIM_HEATER_WATT 1500.0f         // Elemen pemanas, menyala selama ada air
+#define SIM_HEATER_MIN_ML 10.0f         // Proteksi kering: elemen mati di bawah isi ini
+#define SIM_HEATER_CUTOFF_C 96.0f       // Termostat pemanas
+#define SIM_HEATER_LOSS_PER_S 0.004f    // Koefisien rugi panas ke udara (1/s)
+#define SIM_HOPPER_CAPACITY_G 300.0f
+#define SIM_DISPENSE_G_S 6.0f           // Laju tuang bubuk pada speed 255
+#define SIM_HOPPER_TOP_GAP_CM 2.0f      // Jarak sensor ke permukaan hopper penuh
+#define SIM_HOPPER_DEPTH_CM 12.0f       // Kedalaman hopper dari penuh sampai kosong
+
+struct SimPlantConfig {
+  float ambientC;            // Suhu ruangan rata-rata (berayun ±3 °C per hari virtual)
+  float humidityPct;         // Kelembaban rata-rata
+  unsigned long refillDelayMs; // Waktu operator mengisi ulang hopper setelah stok LOW
+  float dhtFaultsPerHour;    // Rata-rata jendela gangguan DHT22 (10 detik) per jam
+  uint32_t seed;
+};
+
+// Hasil satu seduhan, diisi ulang setiap fase BREW_FILL_WATER
+struct SimCup {
+  float waterMl;    // Air yang sampai ke gelas
+  float powderG;    // Bubuk yang dituang ke mixer
+  float brewTempC;  // Suhu air pemanas saat pompa air panas mulai
+};
+
+struct SimPlantTotals {
+  uint64_t actuatorOnUs[ACT_COUNT];
+  unsigned long actuatorStarts[ACT_COUNT];
+  float dispensedG[SIM_HOPPER_COUNT];
+  float shortfallG[SIM_HOPPER_COUNT]; // Motor berputar saat hopper kosong
+  unsigned long refills[SIM_HOPPER_COUNT];
+  unsigned long dhtFaults;
+  float waterUsedMl;
+};
+
+/** @brief Memasang model ke event bus & periferal host. Dipanggil sebelum setup komponen. */
+void sim_plant_begin(const SimPlantConfig& config);
+/** @brief Mengintegrasikan model sampai waktu virtual sekarang & memperbarui sensor. */
+void sim_plant_step();
+
+const SimCup& sim_plant_cup();
+const SimPlantTotals& sim_plant_totals();
+float sim_plant_hopper_level(uint8_t index); // Gram
+
+#endif // SIM_PLANT_H
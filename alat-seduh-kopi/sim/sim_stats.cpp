@@ -0,0 +1,50 @@
+/*
+  sim/sim_stats.cpp - Deret Sampel & Persentil untuk Laporan Simulator
+*/
+
+#include "sim_stats.h"
+#include <algorithm>
+
+void sim_series_add(SimSeries& series, float value) {
+  if (series.samples.empty() || value < series.min) series.min = value;
+  if (series.samples.empty() || value > series.max) series.max = value;
+  series.samples.push_back(value);
+  series.sum += value;
+}
+
+float sim_series_mean(const SimSeries& series) {
+  return series.samples.empty() ? 0.0f : (float)(series.sum / series.samples.size());
+}
+
+// Persentil nearest-rank
+float sim_series_percentile(SimSeries& series, float p) {
+  if (series.samples.empty()) return 0.0f;
+  if (!std::is_sorted(series.samples.begin(), series.samples.end())) {
+    std::sort(series.samples.begin(), series.samples.end());
+  }
+  size_t rank = (size_t)(p / 100.0f * series.samples.size() + 0.5f);
+  if (rank > 0) rank--;
+  if (rank >= series.samples.size()) rank = series.samples.size() - 1;
+  return series.samples[rank];
+}
+
+void sim_series_write_json(JsonWriter& writer, const char* key, SimSeries& series, uint8_t decimals) {
+  writer.beginObject(key)
+    .field("n", (unsigned long)series.samples.size())
+    .field("mean", sim_series_mean(series), decimals)
+    .field("p50", sim_series_percentile(series, 50), decimals)
+    .field("p95", sim_series_percentile(series, 95), decimals)
+    .field("min", series.samples.empty() ? 0.0f : series.min, decimals)
+    .field("max", series.samples.empty() ? 0.0f : series.max, decimals)
+    .endObject();
+}
+
+void sim_series_print(FILE* out, const char* label, SimSeries& series, const char* unit) {
+  if (series.samples.empty()) {
+    fprintf(out, "  %-22s n=0\n", label);
+    return;
+  }
+  fprintf(out, "  %-22s n=%-6zu mean=%-9.2f p50=%-9.2f p95=%-9.2f max=%-9.2f %s\n", label,
+          series.samples.size(), sim_series_mean(series), sim_series_percentile(series, 50),
+          sim_series_percentile(series, 95), series.max, unit);
+}
@@ -0,0 +1,28 @@
+#ifndef SIM_STATS_H
+#define SIM_STATS_H
+
+#include <Arduino.h>
+#include <vector>
+#include "components/json_writer/json_writer.h"
+
+// --- Statistik Sampel Simulator ---
+// Menyimpan semua sampel (float) agar persentil bisa dihitung tepat di akhir simulasi.
+// Ribuan siklus seduh hanya butuh beberapa puluh KB per deret.
+struct SimSeries {
+  std::vector<float> samples;
+  double sum;
+  float min;
+  float max;
+};
+
+void sim_series_add(SimSeries& series, float value);
+float sim_series_mean(const SimSeries& series);
+// p = 0..100; mengurutkan sampel di tempat saat dipanggil pertama kali
+float sim_series_percentile(SimSeries& series, float p);
+
+// Menulis {"n","mean","p50","p95","max","min"} sebagai objek bernama key
+void sim_series_write_json(JsonWriter& writer, const char* key, SimSeries& series, uint8_t decimals);
+// Satu baris ringkasan: "<label>  n=.. mean=.. p50=.. p95=.. max=.. <unit>"
+void sim_series_print(FILE* out, const char* label, SimSeries& series, const char* unit);
+
+#endif // SIM_STATS_H
@@ -0,0 +1,227 @@
+/*
+  sim/sim_workload.cpp - Kedatangan Pelanggan & Skrip Kartu/Tombol
+  Seduhan yang dimulai (fase BREW_FILL_WATER) dicocokkan ke pelanggan: jika antrean web
+  firmware berkurang, pesanan web terdepan yang dimulai; jika tidak, pelanggan di tempat
+  yang baru mengklik PB4. Waktu tunggu dihitung dari kedatangan sampai saat itu.
+  Pelanggan di tempat tidak melihat antrean web: begitu mesin idle ia menempelkan kartu,
+  sehingga tap kartu bisa berpacu dengan pesanan web yang menunggu di antrean firmware.
+*/
+
+#include "sim_workload.h"
+#include <deque>
+#include <random>
+#include "components/hal/host_peripherals.h"
+#include "components/order_coffee/order_coffee.h"
+#include "sim_heap.h"
+
+// --- Perilaku Pelanggan di Tempat (ms) ---
+#define SIM_CARD_HOLD_MS 400       // Kartu ditempel sebelum diangkat
+#define SIM_READ_LCD_MS 300        // Membaca menu di LCD setelah kartu diangkat
+#define SIM_PRESS_MS 150           // Lama tombol ditekan (jauh di bawah PANEL_LONG_PRESS_MS)
+#define SIM_BUTTON_GAP_MS 250      // Jeda antar tombol
+#define SIM_CONFIRM_TIMEOUT_MS 1000 // Seduhan belum mulai setelah PB4: pelanggan mengulang
+
+#define SIM_PB4_INDEX 3
+
+// Kartu terdaftar di rfid_card_reader, indeks = menuId - 1
+static const uint8_t MENU_CARDS[COFFEE_MENU_COUNT][4] = {
+  {0x09, 0x1C, 0xD5, 0x4B}, // Torabika
+  {0xA9, 0x03, 0xE8, 0x4B}, // Good Day
+  {0xC9, 0x15, 0xEA, 0xA3}  // ABC Susu
+};
+
+struct SimCustomer {
+  unsigned long arrivalMs;
+  uint8_t menuId;
+};
+
+enum WalkupStep : uint8_t {
+  WALKUP_WAIT_IDLE = 0, // Menunggu mesin idle & antrean web kosong
+  WALKUP_CARD_ON,
+  WALKUP_CHECK_MENU,
+  WALKUP_MENU_RELEASE,
+  WALKUP_CONFIRM_PRESS,
+  WALKUP_CONFIRM_RELEASE,
+  WALKUP_WAIT_BREW
+};
+
+static SimWorkloadConfig config;
+static SimWorkloadTotals totals;
+static SimOrderStartHandler startHandler = nullptr;
+static std::mt19937 rng;
+
+static std::deque<SimCustomer> webPending; // Diterima antrean firmware, belum diseduh
+static std::deque<SimCustomer> walkupLine;
+static WalkupStep walkupStep = WALKUP_WAIT_IDLE;
+static unsigned long walkupActionMs = 0;
+static unsigned long nextArrivalMs = 0;
+static bool arrivalsOpen = true;
+static bool walkupSelectionSeen = false; // Firmware sudah menampilkan pilihan pelanggan di tempat
+
+static unsigned long drawInterarrivalMs() {
+  std::exponential_distribution<float> interarrival(1.0f / (config.arrivalMeanS * 1000.0f));
+  return (unsigned long)interarrival(rng) + 1;
+}
+
+static void arrive(unsigned long now) {
+  std::uniform_int_distribution<int> menu(1, COFFEE_MENU_COUNT);
+  std::bernoulli_distribution walkup(config.walkupFraction);
+  SimCustomer customer = {now, (uint8_t)menu(rng)};
+
+  if (walkup(rng)) {
+    totals.arrivals[SIM_CHANNEL_WALKUP]++;
+    walkupLine.push_back(customer);
+    return;
+  }
+  totals.arrivals[SIM_CHANNEL_WEB]++;
+  if (requestCoffeeOrder(customer.menuId) == 0) {
+    totals.rejected++;
+    return;
+  }
+  webPending.push_back(customer);
+}
+
+static void retryWalkup() {
+  totals.walkupRetries++;
+  walkupStep = WALKUP_WAIT_IDLE;
+  walkupSelectionSeen = false;
+}
+
+static void pressButton(uint8_t index, WalkupStep next, unsigned long now) {
+  host_set_button(index, true);
+  walkupStep = next;
+  walkupActionMs = now + SIM_PRESS_MS;
+}
+
+// Satu langkah skrip pelanggan di tempat terdepan
+static void stepWalkup(unsigned long now) {
+  if (walkupLine.empty()) return;
+  const SimCustomer& customer = walkupLine.front();
+
+  if (walkupStep == WALKUP_WAIT_IDLE) {
+    if (currentBrewPhase != BREW_IDLE || menuActive) return;
+    host_rc522().tap(MENU_CARDS[customer.menuId - 1], 4);
+    walkupStep = WALKUP_CARD_ON;
+    walkupActionMs = now + SIM_CARD_HOLD_MS;
+    return;
+  }
+  // Pesanan web selalu langsung dikonfirmasi, jadi menu aktif yang belum dikonfirmasi
+  // selama skrip berjalan adalah pilihan pelanggan ini (kartu atau tombol)
+  if (walkupStep != WALKUP_WAIT_BREW && menuActive && !menuConfirmed) walkupSelectionSeen = true;
+  if (now < walkupActionMs) return;
+
+  switch (walkupStep) {
+    case WALKUP_CARD_ON:
+      host_rc522().remove();
+      walkupStep = WALKUP_CHECK_MENU;
+      walkupActionMs = now + SIM_READ_LCD_MS;
+      break;
+    case WALKUP_CHECK_MENU:
+      if (!menuActive || menuConfirmed) {
+        retryWalkup(); // Kartu tidak terbaca, atau pesanan web sudah mengambil mesin
+      } else if (selectedMenu != customer.menuId) {
+        totals.menuCorrections++;
+        pressButton(customer.menuId - 1, WALKUP_MENU_RELEASE, now);
+      } else {
+        pressButton(SIM_PB4_INDEX, WALKUP_CONFIRM_RELEASE, now);
+      }
+      break;
+    case WALKUP_MENU_RELEASE:
+      host_set_button(customer.menuId - 1, false);
+      walkupStep = WALKUP_CONFIRM_PRESS;
+      walkupActionMs = now + SIM_BUTTON_GAP_MS;
+      break;
+    case WALKUP_CONFIRM_PRESS:
+      pressButton(SIM_PB4_INDEX, WALKUP_CONFIRM_RELEASE, now);
+      break;
+    case WALKUP_CONFIRM_RELEASE:
+      host_set_button(SIM_PB4_INDEX, false);
+      walkupStep = WALKUP_WAIT_BREW;
+      walkupActionMs = now + SIM_CONFIRM_TIMEOUT_MS;
+      break;
+    case WALKUP_WAIT_BREW:
+      retryWalkup();
+      break;
+    default:
+      break;
+  }
+}
+
+static void reportStart(const SimCustomer& customer, uint8_t channel, unsigned long now) {
+  totals.started[channel]++;
+  if (selectedMenu != customer.menuId) totals.wrongMenu++;
+  if (startHandler != nullptr) {
+    SimOrderStart order = {channel, customer.menuId, now - customer.arrivalMs};
+    startHandler(order);
+  }
+}
+
+// Dipanggil di dalam handleOrderCoffee(), setelah pesanan diambil dari antrean
+static void onWorkloadEvent(const BusEvent& event) {
+  SimHeapPause pause; // Dipanggil dari dalam firmware; alokasi model bukan heap firmware
+  if (event.type != EVT_BREW_PHASE || event.value != BREW_FILL_WATER) return;
+
+  QueuedOrder queued[ORDER_QUEUE_SIZE];
+  if (getOrderQueue(queued, ORDER_QUEUE_SIZE) < webPending.size()) {
+    if (walkupSelectionSeen) totals.localOverrides++; // Pesanan web menimpa pilihan di tempat
+    reportStart(webPending.front(), SIM_CHANNEL_WEB, event.timestamp);
+    webPending.pop_front();
+  } else if (!walkupLine.empty() &&
+             (walkupStep == WALKUP_CONFIRM_RELEASE || walkupStep == WALKUP_WAIT_BREW)) {
+    reportStart(walkupLine.front(), SIM_CHANNEL_WALKUP, event.timestamp);
+    walkupLine.pop_front();
+    walkupStep = WALKUP_WAIT_IDLE;
+    walkupSelectionSeen = false;
+  } else {
+    totals.unattributed++;
+  }
+}
+
+void sim_workload_begin(const SimWorkloadConfig& workloadConfig, SimOrderStartHandler onStart) {
+  config = workloadConfig;
+  totals = SimWorkloadTotals();
+  startHandler = onStart;
+  rng.seed(config.seed);
+  webPending.clear();
+  walkupLine.clear();
+  walkupStep = WALKUP_WAIT_IDLE;
+  walkupSelectionSeen = false;
+  arrivalsOpen = true;
+  nextArrivalMs = millis() + drawInterarrivalMs();
+  event_bus_subscribe(onWorkloadEvent);
+}
+
+void sim_workload_step() {
+  unsigned long now = millis();
+  while (arrivalsOpen && now >= nextArrivalMs) {
+    arrive(nextArrivalMs);
+    nextArrivalMs += drawInterarrivalMs();
+  }
+  stepWalkup(now);
+}
+
+unsigned long sim_workload_next_wait(unsigned long maxWaitMs) {
+  unsigned long now = millis();
+  unsigned long wait = maxWaitMs;
+  if (arrivalsOpen) {
+    unsigned long arrivalWait = nextArrivalMs > now ? nextArrivalMs - now : 0;
+    if (arrivalWait < wait) wait = arrivalWait;
+  }
+  if (!walkupLine.empty() && walkupStep != WALKUP_WAIT_IDLE) {
+    unsigned long actionWait = walkupActionMs > now ? walkupActionMs - now : 0;
+    if (actionWait < wait) wait = actionWait;
+  }
+  return wait;
+}
+
+void sim_workload_close() {
+  arrivalsOpen = false;
+}
+
+size_t sim_workload_waiting() {
+  return webPending.size() + walkupLine.size();
+}
+
+const SimWorkloadTotals& sim_workload_totals() {
+  return totals;
+}
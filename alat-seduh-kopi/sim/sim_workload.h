@@ -0,0 +1,54 @@
+#ifndef SIM_WORKLOAD_H
+#define SIM_WORKLOAD_H
+
+#include <Arduino.h>
+
+// --- Beban Pesanan Simulator ---
+// Pelanggan datang sebagai proses Poisson. Pelanggan web memesan lewat requestCoffeeOrder()
+// (antrean firmware); pelanggan di tempat menunggu mesin idle (tanpa melihat antrean web),
+// menempelkan kartu RFID menu pilihannya (RC522), mengoreksi menu dengan PB1..PB3 bila LCD
+// menampilkan menu lain, lalu mengonfirmasi dengan klik PB4. Tombol & kartu digerakkan
+// lewat periferal host.
+#define SIM_CHANNEL_WEB 0
+#define SIM_CHANNEL_WALKUP 1
+#define SIM_CHANNEL_COUNT 2
+
+struct SimWorkloadConfig {
+  float arrivalMeanS;    // Rata-rata jeda antar pelanggan (detik virtual)
+  float walkupFraction;  // Peluang pelanggan memesan di tempat (kartu + tombol)
+  uint32_t seed;
+};
+
+struct SimWorkloadTotals {
+  unsigned long arrivals[SIM_CHANNEL_COUNT];
+  unsigned long started[SIM_CHANNEL_COUNT];
+  unsigned long rejected;        // requestCoffeeOrder() menolak (antrean penuh)
+  unsigned long walkupRetries;   // Konfirmasi PB4 didahului pesanan web, pelanggan mengulang
+  unsigned long menuCorrections; // Kartu memilih menu lain dari labelnya, dikoreksi tombol
+  unsigned long wrongMenu;       // Menu yang diseduh berbeda dari pesanan
+  unsigned long unattributed;    // Seduhan yang tidak cocok dengan pelanggan mana pun
+  unsigned long localOverrides;  // Pesanan web diseduh saat pilihan di tempat belum dikonfirmasi
+};
+
+// Pelanggan yang seduhannya baru dimulai (dilaporkan ke callback)
+struct SimOrderStart {
+  uint8_t channel;
+  uint8_t menuId;
+  unsigned long waitMs; // Dari kedatangan sampai fase BREW_FILL_WATER
+};
+typedef void (*SimOrderStartHandler)(const SimOrderStart& order);
+
+/** @brief Memasang handler fase seduh & menjadwalkan kedatangan pertama. */
+void sim_workload_begin(const SimWorkloadConfig& config, SimOrderStartHandler onStart);
+/** @brief Kedatangan & langkah skrip pelanggan yang jatuh tempo sampai millis() sekarang. */
+void sim_workload_step();
+/** @brief Jeda (ms) sampai aksi workload berikutnya, dibatasi maxWaitMs. */
+unsigned long sim_workload_next_wait(unsigned long maxWaitMs);
+/** @brief Menghentikan kedatangan baru (pelanggan yang sudah datang tetap dilayani). */
+void sim_workload_close();
+/** @brief Jumlah pelanggan yang sudah datang tetapi seduhannya belum dimulai. */
+size_t sim_workload_waiting();
+
+const SimWorkloadTotals& sim_workload_totals();
+
+#endif // SIM_WORKLOAD_H
@@ -0,0 +1,87 @@
+/*
+  src/components/boot_sequence/boot_sequence.cpp - Pencatat Tahap Boot
+  Boot dibagi menjadi tahap hardware (berurutan di setup(), tanpa delay) dan tahap
+  jaringan (di latar belakang). Durasi setiap tahap dicetak ke Serial dan tersedia
+  di GET /api/metrics, sehingga waktu sampai mesin siap menerima pesanan bisa dipantau.
+*/
+
+#include "boot_sequence.h"
+#include <atomic>
+
+struct BootStageInfo {
+  const char* name;
+  unsigned long startMillis;
+  long durationMs; // -1 = belum selesai
+};
+
+// Indeks = BootStage
+static BootStageInfo bootStages[BOOT_STAGE_COUNT] = {
+  {"core", 0, -1},
+  {"i2c", 0, -1},
+  {"actuators", 0, -1},
+  {"sensors", 0, -1},
+  {"storage", 0, -1},
+  {"tasks", 0, -1},
+  {"wifi", 0, -1},
+  {"web", 0, -1}
+};
+
+static const char* const BOOT_STATE_NAMES[] = {
+  "starting",
+  "localReady",
+  "online",
+  "offline"
+};
+
+static std::atomic<uint8_t> currentState(BOOT_STARTING);
+static std::atomic<unsigned long> readyMillis(0);
+
+void boot_stage_begin(BootStage stage) {
+  if (stage >= BOOT_STAGE_COUNT) return;
+  bootStages[stage].startMillis = millis();
+  bootStages[stage].durationMs = -1;
+}
+
+void boot_stage_end(BootStage stage) {
+  if (stage >= BOOT_STAGE_COUNT) return;
+  unsigned long now = millis();
+  bootStages[stage].durationMs = (long)(now - bootStages[stage].startMillis);
+  Serial.printf("[BOOT] Tahap %-9s %5ld ms (t=%lu ms)\n", bootStages[stage].name,
+                bootStages[stage].durationMs, now);
+}
+
+/**
+ * @brief Mengubah state kesiapan. Saat pertama kali BOOT_LOCAL_READY, waktu sejak
+ * boot dicatat sebagai waktu sampai pesanan pertama bisa diterima.
+ */
+void boot_set_state(BootState state) {
+  if (state == BOOT_LOCAL_READY && readyMillis.load() == 0) {
+    readyMillis.store(millis());
+    Serial.printf("[BOOT] Siap menerima pesanan lokal dalam %lu ms.\n", readyMillis.load());
+  }
+  currentState.store(state);
+}
+
+BootState boot_state() {
+  return (BootState)currentState.load();
+}
+
+const char* boot_state_name(BootState state) {
+  if (state > BOOT_OFFLINE) return "unknown";
+  return BOOT_STATE_NAMES[state];
+}
+
+unsigned long boot_ready_millis() {
+  return readyMillis.load();
+}
+
+void writeBootJson(JsonWriter& writer, const char* key) {
+  writer.beginObject(key)
+    .field("state", boot_state_name(boot_state()))
+    .field("readyMs", boot_ready_millis());
+  writer.beginObject("stages");
+  for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+    writer.field(bootStages[i].name, bootStages[i].durationMs);
+  }
+  writer.endObject().endObject();
+}
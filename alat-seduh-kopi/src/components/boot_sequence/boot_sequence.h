@@ -0,0 +1,44 @@
+#ifndef BOOT_SEQUENCE_H
+#define BOOT_SEQUENCE_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+
+// --- Tahap Boot ---
+// Tahap hardware dijalankan berurutan di setup(); tahap jaringan diselesaikan di
+// latar belakang oleh task jaringan setelah mesin sudah menerima pesanan lokal.
+enum BootStage : uint8_t {
+  BOOT_STAGE_CORE = 0,  // Task RTOS & probe performa
+  BOOT_STAGE_I2C,       // Bus I2C, LCD & jadwal scan
+  BOOT_STAGE_ACTUATORS, // PCF8574 motor & front panel
+  BOOT_STAGE_SENSORS,   // SPI/RFID, DHT22 & sensor jarak
+  BOOT_STAGE_STORAGE,   // SPIFFS
+  BOOT_STAGE_TASKS,     // Task kontrol & jaringan dibuat
+  BOOT_STAGE_WIFI,      // Sampai koneksi WiFi pertama (latar belakang)
+  BOOT_STAGE_WEB,       // Server web & WebSocket
+  BOOT_STAGE_COUNT
+};
+
+// State kesiapan mesin
+enum BootState : uint8_t {
+  BOOT_STARTING = 0,    // setup() sedang berjalan
+  BOOT_LOCAL_READY,     // Tombol & kartu RFID sudah bisa memesan, jaringan belum siap
+  BOOT_ONLINE,          // Link WiFi naik & server web aktif
+  BOOT_OFFLINE          // Link WiFi terputus; mesin tetap melayani lokal, 'wifi_service' mencoba lagi
+};
+
+// --- Prototipe Fungsi Boot Sequence ---
+// Mencatat & mencetak durasi setiap tahap. Setiap tahap ditulis oleh satu task saja
+// (tahap hardware oleh setup(), tahap jaringan oleh task jaringan).
+void boot_stage_begin(BootStage stage);
+void boot_stage_end(BootStage stage);
+void boot_set_state(BootState state);
+BootState boot_state();
+const char* boot_state_name(BootState state);
+// millis() saat mesin pertama kali siap menerima pesanan lokal (0 = belum)
+unsigned long boot_ready_millis();
+
+// {"state", "readyMs", "stages":{"core":ms,...}} (tahap yang belum selesai = -1)
+void writeBootJson(JsonWriter& writer, const char* key);
+
+#endif // BOOT_SEQUENCE_H
@@ -0,0 +1,75 @@
+/*
+  src/components/event_bus/event_bus.cpp - Implementasi Event Bus Internal
+  Publish/subscribe sederhana dengan tabel subscriber berkapasitas tetap.
+  Komponen (order_coffee, rfid_card_reader, motor_control) mempublikasikan
+  perubahan state di sini, dan lapisan WebSocket meneruskannya ke browser
+  tanpa menunggu tick telemetri berikutnya.
+*/
+
+#include "event_bus.h"
+#include <atomic>
+
+// --- Tabel Subscriber ---
+static EventHandler subscribers[EVENT_BUS_MAX_SUBSCRIBERS] = {nullptr};
+static uint8_t subscriberCount = 0;
+static std::atomic<unsigned long> publishedCount(0); // Publisher bisa berasal dari task mana pun
+
+// Nama event untuk dikirim ke klien web (indeks = EventType)
+static const char* const EVENT_TYPE_NAMES[EVT_TYPE_COUNT] = {
+  "button",
+  "cardTap",
+  "menu",
+  "brewPhase",
+  "actuator",
+  "relay",
+  "memory"
+};
+
+/**
+ * @brief Mendaftarkan handler yang akan menerima semua event.
+ * @param handler Fungsi callback subscriber.
+ * @return true jika berhasil, false jika tabel subscriber penuh.
+ */
+bool event_bus_subscribe(EventHandler handler) {
+  if (handler == nullptr || subscriberCount >= EVENT_BUS_MAX_SUBSCRIBERS) {
+    Serial.println("[EVENT_BUS] Gagal mendaftarkan subscriber (tabel penuh).");
+    return false;
+  }
+  subscribers[subscriberCount++] = handler;
+  return true;
+}
+
+/**
+ * @brief Mempublikasikan event ke semua subscriber secara sinkron.
+ * Aman dari task mana pun, selama subscriber didaftarkan sebelum task dibuat.
+ * @param type Jenis event.
+ * @param id Identitas sumber (index tombol, ActuatorId, dll.).
+ * @param value Nilai state baru.
+ * @param text Payload teks opsional, dipotong ke EVENT_TEXT_LEN - 1 karakter.
+ */
+void event_bus_publish(EventType type, uint8_t id, int32_t value, const char* text) {
+  BusEvent event;
+  event.type = type;
+  event.id = id;
+  event.value = value;
+  event.timestamp = millis();
+  event.text[0] = '\0';
+  if (text != nullptr) {
+    strncpy(event.text, text, EVENT_TEXT_LEN - 1);
+    event.text[EVENT_TEXT_LEN - 1] = '\0';
+  }
+
+  publishedCount.fetch_add(1, std::memory_order_relaxed);
+  for (uint8_t i = 0; i < subscriberCount; i++) {
+    subscribers[i](event);
+  }
+}
+
+const char* event_bus_type_name(EventType type) {
+  if (type >= EVT_TYPE_COUNT) return "unknown";
+  return EVENT_TYPE_NAMES[type];
+}
+
+unsigned long event_bus_published_count() {
+  return publishedCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,42 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <Arduino.h>
+
+// --- Jenis Event yang Dipublikasikan oleh Komponen ---
+enum EventType : uint8_t {
+  EVT_BUTTON = 0,   // Tombol front panel (id = index tombol, value = PanelButtonAction)
+  EVT_CARD_TAP,     // Kartu RFID di-tap (text = UID, value = 1 terdaftar / 0 tidak dikenal)
+  EVT_MENU,         // Menu kopi dipilih (value = menuId, 0 = tidak ada)
+  EVT_BREW_PHASE,   // Fase proses seduh berubah (value = BrewPhase, text = nama fase)
+  EVT_ACTUATOR,     // Motor/pompa ON/OFF (id = ActuatorId, value = speed, 0 = OFF)
+  EVT_RELAY,        // Relay web (motorPin) ditoggle (value = 1 ON / 0 OFF)
+  EVT_MEMORY,       // Fragmentasi heap melewati ambang (id = 1 naik / 0 pulih, value = persen)
+  EVT_TYPE_COUNT
+};
+
+// --- Konfigurasi Event Bus ---
+#define EVENT_TEXT_LEN 24            // Panjang maksimum teks payload (termasuk '\0')
+#define EVENT_BUS_MAX_SUBSCRIBERS 6  // Jumlah maksimum subscriber
+
+// Struktur event yang dikirim ke semua subscriber
+struct BusEvent {
+  EventType type;
+  uint8_t id;
+  int32_t value;
+  unsigned long timestamp;     // millis() saat event dipublikasikan
+  char text[EVENT_TEXT_LEN];   // Payload teks opsional (UID kartu, nama fase, dll.)
+};
+
+// Callback subscriber. Dipanggil secara sinkron di konteks publisher (task kontrol,
+// task IO, atau AsyncTCP), sehingga handler harus singkat, tidak boleh memanggil
+// delay(), dan hanya boleh menyerahkan event ke task lain lewat antrean.
+typedef void (*EventHandler)(const BusEvent& event);
+
+// --- Prototipe Fungsi Event Bus ---
+bool event_bus_subscribe(EventHandler handler);
+void event_bus_publish(EventType type, uint8_t id, int32_t value, const char* text = nullptr);
+const char* event_bus_type_name(EventType type);
+unsigned long event_bus_published_count();
+
+#endif // EVENT_BUS_H
@@ -0,0 +1,61 @@
+#ifndef HAL_H
+#define HAL_H
+
+#include <Arduino.h>
+
+// --- Pemilihan Backend HAL ---
+// Komponen mengakses perangkat keras (GPIO, PWM, I2C, SPI, clock) hanya lewat fungsi
+// hal_*. Backend ESP32 (hal_esp32.cpp) meneruskannya ke core Arduino & Wire; backend
+// host (hal_host.cpp, -D HAL_HOST=1 di env 'native') menjalankannya terhadap periferal
+// simulasi, sehingga firmware yang sama bisa dikompilasi & dijalankan di Linux.
+#ifndef HAL_HOST
+#define HAL_HOST 0
+#endif
+
+#define HAL_GPIO_COUNT 40 // GPIO0..GPIO39 ESP32
+
+// --- GPIO ---
+// mode: INPUT / OUTPUT / INPUT_PULLUP, level: LOW / HIGH (konstanta Arduino)
+void hal_gpio_mode(uint8_t pin, uint8_t mode);
+void hal_gpio_write(uint8_t pin, uint8_t level);
+int hal_gpio_read(uint8_t pin);
+// Durasi pulsa (µs) dengan level tertentu, 0 jika timeout (semantik pulseIn())
+unsigned long hal_gpio_pulse_in(uint8_t pin, uint8_t level, unsigned long timeoutUs);
+// mode: RISING / FALLING / CHANGE. Handler dipanggil dari konteks interrupt.
+void hal_gpio_attach_interrupt(uint8_t pin, void (*handler)(), int mode);
+
+// --- PWM ---
+void hal_pwm_write(uint8_t pin, uint8_t duty); // Duty 8 bit (0 = mati, 255 = penuh)
+
+// --- I2C ---
+// Hanya dipanggil modul 'i2c_bus'; komponen lain memakai transaksi i2c_bus_*.
+bool hal_i2c_begin(uint8_t sdaPin, uint8_t sclPin, uint32_t clockHz);
+void hal_i2c_set_timeout(uint16_t timeoutMs);
+// Kode hasil sama dengan Wire.endTransmission(): 0 = ACK, 2 = NACK alamat, lainnya = error bus.
+// length 0 adalah probe alamat.
+uint8_t hal_i2c_write(uint8_t address, const uint8_t* data, size_t length);
+// Jumlah byte yang diterima (kurang dari length jika perangkat tidak menjawab)
+size_t hal_i2c_read(uint8_t address, uint8_t* data, size_t length);
+
+// --- SPI ---
+void hal_spi_begin();
+// Satu transfer full-duplex dengan chip select csPin aktif selama transfer. rx boleh nullptr.
+void hal_spi_transfer(uint8_t csPin, const uint8_t* tx, uint8_t* rx, size_t length);
+
+// --- Clock ---
+// Dipanggil di jalur panas (perf_probe, i2c_bus), sehingga backend ESP32 inline.
+#if HAL_HOST
+unsigned long hal_millis();
+uint32_t hal_micros();
+void hal_delay_us(uint32_t us);
+uint32_t hal_cycle_count();
+uint32_t hal_cpu_mhz();
+#else
+static inline unsigned long hal_millis() { return millis(); }
+static inline uint32_t hal_micros() { return micros(); }
+static inline void hal_delay_us(uint32_t us) { delayMicroseconds(us); }
+static inline uint32_t hal_cycle_count() { return ESP.getCycleCount(); }
+static inline uint32_t hal_cpu_mhz() { return ESP.getCpuFreqMHz(); }
+#endif
+
+#endif // HAL_H
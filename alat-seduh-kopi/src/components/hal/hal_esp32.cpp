@@ -0,0 +1,70 @@
+/*
+  src/components/hal/hal_esp32.cpp - Backend HAL untuk ESP32
+  Meneruskan fungsi hal_* ke core Arduino-ESP32 (GPIO, LEDC lewat analogWrite), Wire dan
+  SPI. Tidak menambah state maupun kunci: giliran bus I2C tetap diatur modul 'i2c_bus'.
+  Dikompilasi kosong pada env 'native' (HAL_HOST=1), yang memakai hal_host.cpp.
+*/
+
+#include "hal.h"
+
+#if !HAL_HOST
+#include <Wire.h>
+#include <SPI.h>
+
+void hal_gpio_mode(uint8_t pin, uint8_t mode) {
+  pinMode(pin, mode);
+}
+
+void hal_gpio_write(uint8_t pin, uint8_t level) {
+  digitalWrite(pin, level);
+}
+
+int hal_gpio_read(uint8_t pin) {
+  return digitalRead(pin);
+}
+
+unsigned long hal_gpio_pulse_in(uint8_t pin, uint8_t level, unsigned long timeoutUs) {
+  return pulseIn(pin, level, timeoutUs);
+}
+
+void hal_gpio_attach_interrupt(uint8_t pin, void (*handler)(), int mode) {
+  attachInterrupt(digitalPinToInterrupt(pin), handler, mode);
+}
+
+void hal_pwm_write(uint8_t pin, uint8_t duty) {
+  analogWrite(pin, duty);
+}
+
+bool hal_i2c_begin(uint8_t sdaPin, uint8_t sclPin, uint32_t clockHz) {
+  return Wire.begin(sdaPin, sclPin, clockHz);
+}
+
+void hal_i2c_set_timeout(uint16_t timeoutMs) {
+  Wire.setTimeOut(timeoutMs);
+}
+
+uint8_t hal_i2c_write(uint8_t address, const uint8_t* data, size_t length) {
+  Wire.beginTransmission(address);
+  if (length > 0) Wire.write(data, length);
+  return Wire.endTransmission();
+}
+
+size_t hal_i2c_read(uint8_t address, uint8_t* data, size_t length) {
+  size_t received = Wire.requestFrom(address, (uint8_t)length);
+  for (size_t i = 0; i < received && i < length; i++) data[i] = Wire.read();
+  return received < length ? received : length;
+}
+
+void hal_spi_begin() {
+  SPI.begin();
+}
+
+void hal_spi_transfer(uint8_t csPin, const uint8_t* tx, uint8_t* rx, size_t length) {
+  digitalWrite(csPin, LOW);
+  for (size_t i = 0; i < length; i++) {
+    uint8_t value = SPI.transfer(tx != nullptr ? tx[i] : 0xFF);
+    if (rx != nullptr) rx[i] = value;
+  }
+  digitalWrite(csPin, HIGH);
+}
+#endif // !HAL_HOST
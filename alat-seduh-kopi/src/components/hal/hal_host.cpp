@@ -0,0 +1,211 @@
+/*
+  src/components/hal/hal_host.cpp - Backend HAL untuk Host (Linux)
+  Dipakai env 'native' (-D HAL_HOST=1). GPIO, PWM, I2C dan SPI tidak menyentuh perangkat
+  keras: tulisan firmware diteruskan ke model periferal yang dipasang per pin, alamat
+  I2C atau chip select (lihat modul 'host_peripherals'), dan input digerakkan model
+  lewat hal_host_set_input(), termasuk pemicuan handler interrupt pada tepinya.
+  Clock memakai steady_clock proses, atau clock virtual yang hanya maju lewat delay
+  (dipakai simulator 'sim/'); cycle counter diturunkan dari waktu dengan
+  frekuensi nominal HAL_HOST_CPU_MHZ agar angka perf_probe sebanding dengan ESP32.
+*/
+
+#include "hal_host.h"
+
+#if HAL_HOST
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "host_peripherals.h"
+
+#define HAL_HOST_CPU_MHZ 240
+#define HAL_HOST_I2C_ADDRESSES 128
+#define HAL_HOST_SPI_DEVICES 4
+
+struct HalHostPin {
+  std::atomic<uint8_t> mode;
+  std::atomic<uint8_t> output;  // Level yang ditulis firmware
+  std::atomic<uint8_t> input;   // Level yang digerakkan periferal
+  std::atomic<uint8_t> pwm;
+  HalHostPinModel* model;
+  void (*isr)();
+  int isrMode;
+};
+
+struct HalHostSpiSlot {
+  uint8_t csPin;
+  HalHostSpiDevice* device;
+};
+
+static HalHostPin pins[HAL_GPIO_COUNT];
+static HalHostI2cDevice* i2cDevices[HAL_HOST_I2C_ADDRESSES];
+static HalHostSpiSlot spiDevices[HAL_HOST_SPI_DEVICES];
+static int spiDeviceCount = 0;
+static uint32_t i2cClockHz = 0;
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static bool virtualClock = false;
+static uint64_t virtualNowUs = 0;
+
+static bool validPin(uint8_t pin) {
+  return pin < HAL_GPIO_COUNT;
+}
+
+// --- GPIO ---
+void hal_gpio_mode(uint8_t pin, uint8_t mode) {
+  if (!validPin(pin)) return;
+  pins[pin].mode = mode;
+  if (mode == INPUT_PULLUP && pins[pin].model == nullptr) pins[pin].input = HIGH;
+}
+
+void hal_gpio_write(uint8_t pin, uint8_t level) {
+  if (!validPin(pin)) return;
+  pins[pin].output = level ? HIGH : LOW;
+  pins[pin].pwm = level ? 255 : 0;
+  if (pins[pin].model != nullptr) pins[pin].model->onWrite(pin, level ? HIGH : LOW);
+}
+
+int hal_gpio_read(uint8_t pin) {
+  if (!validPin(pin)) return LOW;
+  return pins[pin].mode == OUTPUT ? pins[pin].output.load() : pins[pin].input.load();
+}
+
+unsigned long hal_gpio_pulse_in(uint8_t pin, uint8_t level, unsigned long timeoutUs) {
+  if (!validPin(pin) || pins[pin].model == nullptr) {
+    hal_delay_us(timeoutUs); // Tanpa periferal: tidak ada pulsa, menunggu sampai timeout
+    return 0;
+  }
+  return pins[pin].model->pulseIn(pin, level, timeoutUs);
+}
+
+void hal_gpio_attach_interrupt(uint8_t pin, void (*handler)(), int mode) {
+  if (!validPin(pin)) return;
+  pins[pin].isrMode = mode;
+  pins[pin].isr = handler;
+}
+
+// --- PWM ---
+void hal_pwm_write(uint8_t pin, uint8_t duty) {
+  if (!validPin(pin)) return;
+  pins[pin].pwm = duty;
+  pins[pin].output = duty > 0 ? HIGH : LOW;
+}
+
+// --- I2C ---
+bool hal_i2c_begin(uint8_t sdaPin, uint8_t sclPin, uint32_t clockHz) {
+  i2cClockHz = clockHz;
+  return true;
+}
+
+void hal_i2c_set_timeout(uint16_t timeoutMs) {
+  // Perangkat simulasi menjawab seketika, tidak ada bus yang bisa macet
+}
+
+uint8_t hal_i2c_write(uint8_t address, const uint8_t* data, size_t length) {
+  HalHostI2cDevice* device = address < HAL_HOST_I2C_ADDRESSES ? i2cDevices[address] : nullptr;
+  if (device == nullptr) return 2; // NACK alamat
+  if (length == 0) return 0;       // Probe alamat
+  return device->write(data, length) ? 0 : 3;
+}
+
+size_t hal_i2c_read(uint8_t address, uint8_t* data, size_t length) {
+  HalHostI2cDevice* device = address < HAL_HOST_I2C_ADDRESSES ? i2cDevices[address] : nullptr;
+  if (device == nullptr) return 0;
+  return device->read(data, length);
+}
+
+// --- SPI ---
+void hal_spi_begin() {
+}
+
+void hal_spi_transfer(uint8_t csPin, const uint8_t* tx, uint8_t* rx, size_t length) {
+  for (int i = 0; i < spiDeviceCount; i++) {
+    if (spiDevices[i].csPin == csPin) {
+      spiDevices[i].device->transfer(tx, rx, length);
+      return;
+    }
+  }
+  if (rx != nullptr) memset(rx, 0xFF, length); // MISO mengambang: tidak ada perangkat
+}
+
+// --- Clock ---
+uint64_t hal_host_now_us() {
+  if (virtualClock) return virtualNowUs;
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long hal_millis() {
+  return (unsigned long)(hal_host_now_us() / 1000);
+}
+
+uint32_t hal_micros() {
+  return (uint32_t)hal_host_now_us();
+}
+
+void hal_delay_us(uint32_t us) {
+  if (virtualClock) {
+    virtualNowUs += us;
+  } else if (us > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+  }
+}
+
+uint32_t hal_cycle_count() {
+  return (uint32_t)(hal_host_now_us() * HAL_HOST_CPU_MHZ);
+}
+
+uint32_t hal_cpu_mhz() {
+  return HAL_HOST_CPU_MHZ;
+}
+
+// Waktu virtual dimulai dari waktu nyata saat diaktifkan, agar millis() tidak mundur
+void hal_host_use_virtual_clock(bool enabled) {
+  if (enabled == virtualClock) return;
+  uint64_t now = hal_host_now_us();
+  virtualClock = enabled;
+  virtualNowUs = now;
+}
+
+void hal_host_advance_us(uint64_t us) {
+  if (virtualClock) virtualNowUs += us;
+}
+
+// --- Pemasangan Periferal ---
+void hal_host_attach_pin(uint8_t pin, HalHostPinModel* model) {
+  if (validPin(pin)) pins[pin].model = model;
+}
+
+void hal_host_attach_i2c(uint8_t address, HalHostI2cDevice* device) {
+  if (address < HAL_HOST_I2C_ADDRESSES) i2cDevices[address] = device;
+}
+
+void hal_host_attach_spi(uint8_t csPin, HalHostSpiDevice* device) {
+  if (spiDeviceCount < HAL_HOST_SPI_DEVICES) spiDevices[spiDeviceCount++] = {csPin, device};
+}
+
+void hal_host_set_input(uint8_t pin, uint8_t level) {
+  if (!validPin(pin)) return;
+  level = level ? HIGH : LOW;
+  uint8_t previous = pins[pin].input.exchange(level);
+  if (previous == level || pins[pin].isr == nullptr) return;
+  int mode = pins[pin].isrMode;
+  if (mode == CHANGE || (mode == RISING && level == HIGH) || (mode == FALLING && level == LOW)) {
+    pins[pin].isr();
+  }
+}
+
+uint8_t hal_host_output(uint8_t pin) {
+  return validPin(pin) ? pins[pin].output.load() : LOW;
+}
+
+uint8_t hal_host_pwm(uint8_t pin) {
+  return validPin(pin) ? pins[pin].pwm.load() : 0;
+}
+
+uint8_t hal_host_pin_mode(uint8_t pin) {
+  return validPin(pin) ? pins[pin].mode.load() : INPUT;
+}
+
+void hal_host_begin(int argc, char** argv) {
+  host_peripherals_begin(argc, argv);
+}
+#endif // HAL_HOST
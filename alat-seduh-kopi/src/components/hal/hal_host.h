@@ -0,0 +1,63 @@
+#ifndef HAL_HOST_H
+#define HAL_HOST_H
+
+#include "hal.h"
+
+#if HAL_HOST
+// --- API Khusus Backend Host ---
+// Hanya tersedia pada env 'native'. Periferal simulasi (modul 'host_peripherals')
+// dipasang ke pin, alamat I2C & chip select SPI; firmware tetap memanggil hal_* biasa.
+
+// Periferal yang terhubung ke pin GPIO
+class HalHostPinModel {
+public:
+  virtual ~HalHostPinModel() {}
+  // Firmware menulis level ke pin OUTPUT milik model
+  virtual void onWrite(uint8_t pin, uint8_t level) {}
+  // Menjawab hal_gpio_pulse_in() untuk pin milik model (µs, 0 = timeout)
+  virtual unsigned long pulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs) { return 0; }
+};
+
+// Perangkat di bus I2C simulasi. Dipanggil di dalam transaksi i2c_bus (bus sudah dipegang).
+class HalHostI2cDevice {
+public:
+  virtual ~HalHostI2cDevice() {}
+  virtual bool write(const uint8_t* data, size_t length) = 0; // false = NACK data
+  virtual size_t read(uint8_t* data, size_t length) = 0;
+};
+
+// Perangkat di bus SPI simulasi
+class HalHostSpiDevice {
+public:
+  virtual ~HalHostSpiDevice() {}
+  virtual void transfer(const uint8_t* tx, uint8_t* rx, size_t length) = 0;
+};
+
+// --- Pemasangan Periferal ---
+void hal_host_attach_pin(uint8_t pin, HalHostPinModel* model);
+void hal_host_attach_i2c(uint8_t address, HalHostI2cDevice* device);
+void hal_host_attach_spi(uint8_t csPin, HalHostSpiDevice* device);
+
+// Level yang digerakkan periferal ke pin input; memanggil handler interrupt pada tepi
+// yang sesuai mode attachInterrupt (dari thread pemanggil, seperti ISR).
+void hal_host_set_input(uint8_t pin, uint8_t level);
+// Level terakhir yang ditulis firmware ke pin & duty PWM terakhir
+uint8_t hal_host_output(uint8_t pin);
+uint8_t hal_host_pwm(uint8_t pin);
+uint8_t hal_host_pin_mode(uint8_t pin);
+
+// Waktu sejak proses dimulai (µs, 64 bit, tidak wrap)
+uint64_t hal_host_now_us();
+
+// --- Clock Virtual (simulator) ---
+// Saat aktif, waktu hanya maju lewat hal_delay_us() (dan delay()/pulseIn() di atasnya)
+// serta hal_host_advance_us(): delay tidak benar-benar tidur, sehingga satu proses seduh
+// selesai secepat CPU menjalankan kodenya. Hanya untuk program berthread tunggal.
+void hal_host_use_virtual_clock(bool enabled);
+void hal_host_advance_us(uint64_t us);
+
+// Dipanggil main() host sebelum setup(): memasang periferal simulasi mesin kopi
+void hal_host_begin(int argc, char** argv);
+#endif // HAL_HOST
+
+#endif // HAL_HOST_H
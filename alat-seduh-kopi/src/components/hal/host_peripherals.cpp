@@ -0,0 +1,358 @@
+/*
+  src/components/hal/host_peripherals.cpp - Periferal Simulasi untuk Env 'native'
+  Model perangkat mesin kopi yang dipasang ke backend HAL host:
+    0x20  PCF8574 motor (latch IN1/IN2 LM298N)
+    0x21  PCF8574 front panel (PB1..PB4 pull-down, LED, INT ke GPIO39)
+    0x27  Backpack LCD HD44780 (isi layar bisa dibaca kembali)
+    GPIO  HC-SR04 x3 (trigger -> echo), relay pompa & ENA/ENB (dibaca dari output HAL)
+    DHT22 & RC522 dibaca lewat versi host library DHT_Unified & MFRC522.
+
+  Konsol stdin (thread terpisah) mengubah model saat firmware berjalan, mis.
+  "press 1", "release 1", "card 091CD54B", "distance 2 12", "dht 26.5 55", "wifi down",
+  "status". Opsi --no-console menonaktifkannya (mis. saat stdin bukan terminal).
+*/
+
+#include "host_peripherals.h"
+
+#if HAL_HOST
+#include <thread>
+#include <WiFi.h>
+#include "components/i2c_bus/i2c_bus.h"
+#include "components/order_coffee/order_coffee.h"
+#include "components/motor_control/motor_control.h"
+#include "components/storage_detector/storage_detector.h"
+#include "components/rfid_card_reader/rfid_card_reader.h"
+
+// Jarak awal sensor stok (cm): di bawah ambang 8 cm = stok tersedia
+#define HOST_DEFAULT_DISTANCE_CM 5
+#define HOST_DEFAULT_TEMPERATURE_C 27.5f
+#define HOST_DEFAULT_HUMIDITY_PCT 60.0f
+
+static const uint8_t FRONT_PANEL_BUTTON_MASK =
+    (1 << FP_PB1_PIN) | (1 << FP_PB2_PIN) | (1 << FP_PB3_PIN) | (1 << FP_PB4_PIN);
+
+// --- PCF8574 ---
+HostPcf8574::HostPcf8574(uint8_t intPin, uint8_t externalLevels)
+    : intPin(intPin), latchValue(0xFF), externalLevels(externalLevels), lastRead(0xFF & externalLevels) {}
+
+bool HostPcf8574::write(const uint8_t* data, size_t length) {
+  std::lock_guard<std::mutex> guard(lock);
+  latchValue = data[length - 1]; // Setiap byte langsung menjadi output port
+  updateInterrupt();
+  return true;
+}
+
+size_t HostPcf8574::read(uint8_t* data, size_t length) {
+  std::lock_guard<std::mutex> guard(lock);
+  for (size_t i = 0; i < length; i++) data[i] = port();
+  lastRead = port();
+  updateInterrupt();
+  return length;
+}
+
+void HostPcf8574::setExternalLevels(uint8_t levels) {
+  std::lock_guard<std::mutex> guard(lock);
+  externalLevels = levels;
+  updateInterrupt();
+}
+
+uint8_t HostPcf8574::latch() {
+  std::lock_guard<std::mutex> guard(lock);
+  return latchValue;
+}
+
+void HostPcf8574::updateInterrupt() {
+  if (intPin >= HAL_GPIO_COUNT) return;
+  hal_host_set_input(intPin, port() != lastRead ? LOW : HIGH);
+}
+
+// --- LCD HD44780 lewat PCF8574 ---
+// Bit backpack: P0 = RS, P1 = RW, P2 = EN, P3 = backlight, P4..P7 = D4..D7
+#define LCD_BIT_RS 0x01
+#define LCD_BIT_EN 0x04
+#define LCD_BIT_BACKLIGHT 0x08
+static const uint8_t LCD_ROW_OFFSETS[HOST_LCD_ROWS] = {0x00, 0x40, 0x14, 0x54};
+
+HostLcdBackpack::HostLcdBackpack()
+    : previous(0), fourBitMode(false), haveHighNibble(false), highNibble(0), address(0) {
+  memset(ddram, ' ', sizeof(ddram));
+}
+
+bool HostLcdBackpack::write(const uint8_t* data, size_t length) {
+  std::lock_guard<std::mutex> guard(lock);
+  for (size_t i = 0; i < length; i++) {
+    // Data D4..D7 & RS dikunci LCD pada tepi turun EN
+    if ((previous & LCD_BIT_EN) && !(data[i] & LCD_BIT_EN)) {
+      latchNibble(previous >> 4, previous & LCD_BIT_RS);
+    }
+    previous = data[i];
+  }
+  return true;
+}
+
+size_t HostLcdBackpack::read(uint8_t* data, size_t length) {
+  std::lock_guard<std::mutex> guard(lock);
+  for (size_t i = 0; i < length; i++) data[i] = previous;
+  return length;
+}
+
+void HostLcdBackpack::latchNibble(uint8_t nibble, bool isData) {
+  if (!fourBitMode) {
+    // Mode 8 bit saat inisialisasi: D0..D3 tidak terhubung, satu pulsa = satu instruksi
+    if (!isData) execute(nibble << 4);
+    return;
+  }
+  if (!haveHighNibble) {
+    highNibble = nibble;
+    haveHighNibble = true;
+    return;
+  }
+  haveHighNibble = false;
+  uint8_t value = (highNibble << 4) | nibble;
+  if (!isData) {
+    execute(value);
+    return;
+  }
+  ddram[address & 0x7F] = (char)value;
+  address++;
+  if (address == 0x28) address = 0x40; // Akhir baris DDRAM pertama lanjut ke baris kedua
+  if (address == 0x68) address = 0x00;
+}
+
+void HostLcdBackpack::execute(uint8_t command) {
+  if (command & 0x80) {
+    address = command & 0x7F;        // Set DDRAM address
+  } else if (command & 0x40) {
+    // Set CGRAM address: karakter kustom tidak dimodelkan
+  } else if (command & 0x20) {
+    fourBitMode = !(command & 0x10); // Function set, DL = 0 berarti antarmuka 4 bit
+    haveHighNibble = false;
+  } else if (command == 0x01) {
+    memset(ddram, ' ', sizeof(ddram));
+    address = 0;
+  } else if ((command & 0xFE) == 0x02) {
+    address = 0;                     // Return home
+  }
+}
+
+void HostLcdBackpack::text(char out[HOST_LCD_ROWS][HOST_LCD_COLUMNS + 1]) {
+  std::lock_guard<std::mutex> guard(lock);
+  for (int row = 0; row < HOST_LCD_ROWS; row++) {
+    for (int col = 0; col < HOST_LCD_COLUMNS; col++) {
+      char c = ddram[LCD_ROW_OFFSETS[row] + col];
+      out[row][col] = (c >= 32 && c < 127) ? c : '?';
+    }
+    out[row][HOST_LCD_COLUMNS] = '\0';
+  }
+}
+
+bool HostLcdBackpack::backlight() {
+  std::lock_guard<std::mutex> guard(lock);
+  return previous & LCD_BIT_BACKLIGHT;
+}
+
+// --- HC-SR04 ---
+HostUltrasonic::HostUltrasonic()
+    : trigPin(0xFF), echoPin(0xFF), trigLevel(LOW), triggered(false), distanceCm(HOST_DEFAULT_DISTANCE_CM) {}
+
+void HostUltrasonic::attach(uint8_t trig, uint8_t echo) {
+  trigPin = trig;
+  echoPin = echo;
+  hal_host_attach_pin(trig, this);
+  hal_host_attach_pin(echo, this);
+}
+
+void HostUltrasonic::onWrite(uint8_t pin, uint8_t level) {
+  // Burst ultrasonik dikirim pada tepi turun pulsa trigger
+  if (pin != trigPin) return;
+  if (trigLevel == HIGH && level == LOW) triggered = true;
+  trigLevel = level;
+}
+
+unsigned long HostUltrasonic::pulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs) {
+  int cm = distanceCm.load();
+  if (pin != echoPin || level != HIGH || !triggered.exchange(false) || cm < 0) {
+    hal_delay_us(timeoutUs);
+    return 0;
+  }
+  // Kebalikan rumus firmware (durasi * 0,034 / 2), dibulatkan ke tengah sentimeter
+  unsigned long durationUs = (unsigned long)((cm + 0.5f) / 0.017f);
+  if (durationUs > timeoutUs) {
+    hal_delay_us(timeoutUs);
+    return 0;
+  }
+  hal_delay_us(durationUs);
+  return durationUs;
+}
+
+void HostUltrasonic::setDistance(int cm) {
+  distanceCm = cm;
+}
+
+// --- DHT22 ---
+HostDht22::HostDht22()
+    : temperatureC(HOST_DEFAULT_TEMPERATURE_C), humidityPct(HOST_DEFAULT_HUMIDITY_PCT), failing(false) {}
+
+void HostDht22::set(float temperature, float humidity) {
+  std::lock_guard<std::mutex> guard(lock);
+  temperatureC = temperature;
+  humidityPct = humidity;
+  failing = false;
+}
+
+void HostDht22::setFailing(bool fail) {
+  std::lock_guard<std::mutex> guard(lock);
+  failing = fail;
+}
+
+bool HostDht22::read(float& temperature, float& humidity) {
+  std::lock_guard<std::mutex> guard(lock);
+  if (failing) return false;
+  temperature = temperatureC;
+  humidity = humidityPct;
+  return true;
+}
+
+// --- RC522 ---
+HostRc522::HostRc522() : state(CARD_ABSENT), uidSize(0) {}
+
+void HostRc522::tap(const uint8_t* cardUid, uint8_t size) {
+  std::lock_guard<std::mutex> guard(lock);
+  uidSize = size < HOST_RFID_UID_MAX ? size : HOST_RFID_UID_MAX;
+  memcpy(uid, cardUid, uidSize);
+  state = CARD_IDLE;
+}
+
+void HostRc522::remove() {
+  std::lock_guard<std::mutex> guard(lock);
+  state = CARD_ABSENT;
+}
+
+bool HostRc522::requestCard() {
+  std::lock_guard<std::mutex> guard(lock);
+  if (state != CARD_IDLE) return false;
+  state = CARD_READY;
+  return true;
+}
+
+bool HostRc522::selectCard(uint8_t* out, uint8_t& size) {
+  std::lock_guard<std::mutex> guard(lock);
+  if (state != CARD_READY) return false;
+  memcpy(out, uid, uidSize);
+  size = uidSize;
+  state = CARD_ACTIVE;
+  return true;
+}
+
+void HostRc522::haltCard() {
+  std::lock_guard<std::mutex> guard(lock);
+  if (state == CARD_ACTIVE || state == CARD_READY) state = CARD_HALTED;
+}
+
+// --- Instans Periferal ---
+static HostPcf8574 frontPanel(FP_INT_PIN, (uint8_t)~FRONT_PANEL_BUTTON_MASK);
+static HostPcf8574 motorPort(0xFF, 0xFF);
+static HostLcdBackpack lcdBackpack;
+static HostUltrasonic ultrasonic[HOST_ULTRASONIC_COUNT];
+static HostDht22 dht22;
+static HostRc522 rc522;
+static uint8_t pressedButtons = 0;
+static std::mutex buttonLock;
+
+HostPcf8574& host_front_panel() { return frontPanel; }
+HostPcf8574& host_motor_port() { return motorPort; }
+HostLcdBackpack& host_lcd() { return lcdBackpack; }
+HostUltrasonic& host_ultrasonic(uint8_t index) { return ultrasonic[index < HOST_ULTRASONIC_COUNT ? index : 0]; }
+HostDht22& host_dht22() { return dht22; }
+HostRc522& host_rc522() { return rc522; }
+
+void host_set_button(uint8_t index, bool pressed) {
+  if (index > 3) return;
+  std::lock_guard<std::mutex> guard(buttonLock);
+  uint8_t bit = 1 << (FP_PB1_PIN + index);
+  pressedButtons = pressed ? (pressedButtons | bit) : (pressedButtons & ~bit);
+  // Tombol pull-down: HIGH saat ditekan, pin lain (LED) tidak digerakkan dari luar
+  frontPanel.setExternalLevels((uint8_t)(~FRONT_PANEL_BUTTON_MASK | pressedButtons));
+}
+
+// Relay pompa aktif LOW, ENA/ENB sebagai duty PWM
+void host_print_status() {
+  char rows[HOST_LCD_ROWS][HOST_LCD_COLUMNS + 1];
+  lcdBackpack.text(rows);
+  printf("[HOST] LCD (backlight %s)\n", lcdBackpack.backlight() ? "on" : "off");
+  for (int row = 0; row < HOST_LCD_ROWS; row++) printf("[HOST]  |%s|\n", rows[row]);
+  printf("[HOST] Relay galon %s, air panas %s, seduh %s\n",
+         hal_host_output(MOTOR_PUMP_GALON_RELAY_PIN) == LOW ? "ON" : "off",
+         hal_host_output(MOTOR_PUMP_HOT_WATER_RELAY_PIN) == LOW ? "ON" : "off",
+         hal_host_output(MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN) == LOW ? "ON" : "off");
+  printf("[HOST] PWM ENA1 %u, ENB1 %u, ENA2 %u, ENB2 %u, port motor 0x%02x, port panel 0x%02x\n",
+         hal_host_pwm(LM298N1_ENA_PIN), hal_host_pwm(LM298N1_ENB_PIN), hal_host_pwm(LM298N2_ENA_PIN),
+         hal_host_pwm(LM298N2_ENB_PIN), motorPort.latch(), frontPanel.latch());
+  fflush(stdout);
+}
+
+// UID heksadesimal ("091CD54B") ke byte
+static uint8_t parseUid(const char* text, uint8_t* out) {
+  uint8_t size = 0;
+  while (size < HOST_RFID_UID_MAX && text[0] != '\0' && text[1] != '\0') {
+    char pair[3] = {text[0], text[1], '\0'};
+    out[size++] = (uint8_t)strtoul(pair, nullptr, 16);
+    text += 2;
+  }
+  return size;
+}
+
+static void runConsoleCommand(const char* line) {
+  char command[16] = "";
+  char arg[32] = "";
+  float a = 0;
+  float b = 0;
+  int n = sscanf(line, "%15s %31s", command, arg);
+  if (n < 1) return;
+
+  if ((strcmp(command, "press") == 0 || strcmp(command, "release") == 0) && n == 2) {
+    host_set_button((uint8_t)(atoi(arg) - 1), strcmp(command, "press") == 0);
+  } else if (strcmp(command, "card") == 0 && n == 2) {
+    if (strcmp(arg, "off") == 0) {
+      rc522.remove();
+    } else {
+      uint8_t uid[HOST_RFID_UID_MAX];
+      rc522.tap(uid, parseUid(arg, uid));
+    }
+  } else if (strcmp(command, "distance") == 0 && sscanf(line, "%*s %f %f", &a, &b) == 2) {
+    host_ultrasonic((uint8_t)(a - 1)).setDistance((int)b);
+  } else if (strcmp(command, "dht") == 0 && strcmp(arg, "fail") == 0) {
+    dht22.setFailing(true);
+  } else if (strcmp(command, "dht") == 0 && sscanf(line, "%*s %f %f", &a, &b) == 2) {
+    dht22.set(a, b);
+  } else if (strcmp(command, "wifi") == 0 && n == 2) {
+    WiFi.setHostLinkAvailable(strcmp(arg, "up") == 0);
+  } else if (strcmp(command, "status") == 0) {
+    host_print_status();
+  } else {
+    printf("[HOST] Perintah: press|release <1-4>, card <uid|off>, distance <1-3> <cm|-1>, "
+           "dht <suhu> <rh>|fail, wifi up|down, status\n");
+  }
+}
+
+static void consoleThreadMain() {
+  char line[128];
+  while (fgets(line, sizeof(line), stdin) != nullptr) runConsoleCommand(line);
+}
+
+void host_peripherals_begin(int argc, char** argv) {
+  hal_host_attach_i2c(I2C_MOTOR_ADDRESS, &motorPort);
+  hal_host_attach_i2c(I2C_FRONT_PANEL_ADDRESS, &frontPanel);
+  hal_host_attach_i2c(I2C_LCD_ADDRESS, &lcdBackpack);
+  ultrasonic[0].attach(SD_TRIG_PIN_1, SD_ECHO_PIN_1);
+  ultrasonic[1].attach(SD_TRIG_PIN_2, SD_ECHO_PIN_2);
+  ultrasonic[2].attach(SD_TRIG_PIN_3, SD_ECHO_PIN_3);
+  hal_host_set_input(FP_INT_PIN, HIGH); // Pull-up eksternal 10k
+
+  bool console = true;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--no-console") == 0) console = false;
+  }
+  if (console) std::thread(consoleThreadMain).detach();
+}
+#endif // HAL_HOST
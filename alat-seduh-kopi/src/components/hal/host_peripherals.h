@@ -0,0 +1,133 @@
+#ifndef HOST_PERIPHERALS_H
+#define HOST_PERIPHERALS_H
+
+#include "hal_host.h"
+
+#if HAL_HOST
+#include <atomic>
+#include <mutex>
+
+// --- Periferal Simulasi Mesin Kopi (env 'native') ---
+// Model perangkat dipasang ke pin & alamat yang sama dengan wiring di perangkat asli,
+// sehingga firmware berjalan tanpa perubahan. Semua model aman diubah dari thread lain
+// (konsol stdin atau simulator) selama firmware berjalan.
+
+#define HOST_LCD_COLUMNS 20
+#define HOST_LCD_ROWS 4
+#define HOST_ULTRASONIC_COUNT 3
+#define HOST_RFID_UID_MAX 10
+
+// Ekspander PCF8574: port quasi-bidirectional. Pin yang ditulis HIGH terbaca sesuai
+// level luar (tombol), INT (opsional) aktif LOW selama port berbeda dari pembacaan terakhir.
+class HostPcf8574 : public HalHostI2cDevice {
+public:
+  HostPcf8574(uint8_t intPin, uint8_t externalLevels);
+  bool write(const uint8_t* data, size_t length) override;
+  size_t read(uint8_t* data, size_t length) override;
+  void setExternalLevels(uint8_t levels);
+  uint8_t latch();
+
+private:
+  uint8_t port() const { return latchValue & externalLevels; }
+  void updateInterrupt();
+
+  std::mutex lock;
+  uint8_t intPin;
+  uint8_t latchValue;
+  uint8_t externalLevels;
+  uint8_t lastRead;
+};
+
+// LCD HD44780 di backpack PCF8574 (mode 4 bit): nibble diambil pada tepi turun EN
+class HostLcdBackpack : public HalHostI2cDevice {
+public:
+  HostLcdBackpack();
+  bool write(const uint8_t* data, size_t length) override;
+  size_t read(uint8_t* data, size_t length) override;
+  // Isi layar per baris (DDRAM 20x4), masing-masing HOST_LCD_COLUMNS karakter + '\0'
+  void text(char out[HOST_LCD_ROWS][HOST_LCD_COLUMNS + 1]);
+  bool backlight();
+
+private:
+  void latchNibble(uint8_t nibble, bool isData);
+  void execute(uint8_t command);
+
+  std::mutex lock;
+  uint8_t previous;
+  bool fourBitMode;
+  bool haveHighNibble;
+  uint8_t highNibble;
+  uint8_t address;
+  char ddram[128];
+};
+
+// Sensor ultrasonik HC-SR04: pulsa echo sesuai jarak setelah pulsa trigger
+class HostUltrasonic : public HalHostPinModel {
+public:
+  HostUltrasonic();
+  void attach(uint8_t trigPin, uint8_t echoPin);
+  void onWrite(uint8_t pin, uint8_t level) override;
+  unsigned long pulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs) override;
+  void setDistance(int cm); // -1 = tidak ada pantulan (timeout)
+  int distance() const { return distanceCm.load(); }
+
+private:
+  uint8_t trigPin;
+  uint8_t echoPin;
+  uint8_t trigLevel;
+  std::atomic<bool> triggered;
+  std::atomic<int> distanceCm;
+};
+
+// Sensor DHT22 (dibaca lewat library DHT_Unified versi host)
+class HostDht22 {
+public:
+  HostDht22();
+  void set(float temperature, float humidity);
+  void setFailing(bool failing);
+  bool read(float& temperature, float& humidity);
+
+private:
+  std::mutex lock;
+  float temperatureC;
+  float humidityPct;
+  bool failing;
+};
+
+// Pembaca RC522 (dibaca lewat library MFRC522 versi host). Kartu yang di-halt tidak
+// terbaca lagi sampai diangkat & ditempel ulang, seperti PICC sungguhan.
+class HostRc522 {
+public:
+  HostRc522();
+  void tap(const uint8_t* uid, uint8_t size);
+  void remove();
+  bool requestCard();                   // REQA: kartu idle di medan
+  bool selectCard(uint8_t* uid, uint8_t& size);
+  void haltCard();
+
+private:
+  enum CardState : uint8_t { CARD_ABSENT = 0, CARD_IDLE, CARD_READY, CARD_ACTIVE, CARD_HALTED };
+  std::mutex lock;
+  CardState state;
+  uint8_t uid[HOST_RFID_UID_MAX];
+  uint8_t uidSize;
+};
+
+// --- Akses Periferal ---
+HostPcf8574& host_front_panel();  // 0x21, INT ke FP_INT_PIN
+HostPcf8574& host_motor_port();   // 0x20
+HostLcdBackpack& host_lcd();      // 0x27
+HostUltrasonic& host_ultrasonic(uint8_t index); // 0..2 = storage 1..3
+HostDht22& host_dht22();
+HostRc522& host_rc522();
+
+// Menekan (true) / melepas tombol front panel PB1..PB4 (index 0..3)
+void host_set_button(uint8_t index, bool pressed);
+
+// Dipanggil hal_host_begin(): memasang model & memulai konsol stdin (kecuali --no-console)
+void host_peripherals_begin(int argc, char** argv);
+// Mencetak isi LCD, output relay/PWM & port motor ke stdout
+void host_print_status();
+#endif // HAL_HOST
+
+#endif // HOST_PERIPHERALS_H
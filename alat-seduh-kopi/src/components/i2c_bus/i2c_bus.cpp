@@ -0,0 +1,269 @@
+/*
+  src/components/i2c_bus/i2c_bus.cpp - Manajer Bus I2C Bersama
+  LCD (0x27), PCF8574 motor (0x20) dan PCF8574 front panel (0x21) berbagi satu Wire.
+  Modul ini memiliki bus: memanggil hal_i2c_begin() sekali dengan clock tertinggi yang
+  didukung semua perangkat, dan mengatur giliran transaksi antar task. Library perangkat
+  (PCF8574, LCD) tetap memakai Wire di dalam transaksi, yang di ESP32 adalah bus yang sama.
+
+  Transaksi dijalankan di task pemanggil (tanpa task bus terpisah, tanpa salinan data).
+  Task yang mendapati bus sedang dipakai masuk ke antrean tunggu; saat bus dilepas,
+  antrean dengan prioritas perangkat tertinggi langsung diberi bus, sehingga perintah
+  motor tidak pernah menunggu di belakang deretan perintah LCD.
+*/
+
+#include "i2c_bus.h"
+#include "components/hal/hal.h"
+
+I2cDeviceStats i2cDeviceStats[I2C_DEV_COUNT];
+
+struct I2cDeviceInfo {
+  const char* name;
+  uint8_t address;       // 0 = tidak ada alamat tetap (I2C_DEV_BUS)
+  I2cPriority priority;
+  uint32_t maxClockHz;
+};
+
+// Tabel perangkat (indeks = I2cDeviceId)
+static const I2cDeviceInfo I2C_DEVICES[I2C_DEV_COUNT] = {
+  {"motor", I2C_MOTOR_ADDRESS, I2C_PRIORITY_SAFETY, I2C_PCF8574_MAX_CLOCK_HZ},
+  {"frontPanel", I2C_FRONT_PANEL_ADDRESS, I2C_PRIORITY_PANEL, I2C_PCF8574_MAX_CLOCK_HZ},
+  {"lcd", I2C_LCD_ADDRESS, I2C_PRIORITY_DISPLAY, I2C_PCF8574_MAX_CLOCK_HZ},
+  {"bus", 0, I2C_PRIORITY_BACKGROUND, I2C_BUS_FAST_HZ}
+};
+
+// Slot antrean tunggu. Semaphore biner per slot dibuat sekali di setupI2cBus().
+// Slot baru kosong lagi setelah task penunggunya mengambil semaphore, agar token
+// giliran tidak pernah diambil task lain yang memakai slot yang sama.
+enum I2cWaiterState : uint8_t {
+  I2C_WAITER_FREE = 0,
+  I2C_WAITER_WAITING,
+  I2C_WAITER_GRANTED
+};
+struct I2cWaiter {
+  I2cWaiterState state;
+  TaskHandle_t task;
+  I2cDeviceId device;
+  uint32_t sequence;
+  SemaphoreHandle_t grant;
+};
+
+static portMUX_TYPE i2cBusMux = portMUX_INITIALIZER_UNLOCKED;
+static I2cWaiter waiters[I2C_BUS_MAX_WAITERS];
+static uint32_t waiterSequence = 0;
+static TaskHandle_t busOwner = nullptr;
+static uint8_t ownerDepth = 0;
+static I2cDeviceId ownerDevice = I2C_DEV_BUS;
+static bool ownerOk = true;
+static uint32_t ownerStartUs = 0;
+static uint32_t busClockHz = I2C_BUS_STANDARD_HZ;
+
+// Slot dengan prioritas tertinggi, lalu urutan kedatangan paling awal (dalam critical section)
+static int nextWaiter() {
+  int best = -1;
+  for (int i = 0; i < I2C_BUS_MAX_WAITERS; i++) {
+    if (waiters[i].state != I2C_WAITER_WAITING) continue;
+    if (best < 0) {
+      best = i;
+      continue;
+    }
+    I2cPriority priority = I2C_DEVICES[waiters[i].device].priority;
+    I2cPriority bestPriority = I2C_DEVICES[waiters[best].device].priority;
+    if (priority < bestPriority ||
+        (priority == bestPriority && (int32_t)(waiters[i].sequence - waiters[best].sequence) < 0)) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+// Dipanggil pemegang bus baru (setelah critical section): mulai hitung durasi transaksi
+static void beginOwnership(I2cDeviceId device, uint32_t requestedUs) {
+  ownerOk = true;
+  ownerStartUs = hal_micros();
+  uint32_t waitUs = ownerStartUs - requestedUs;
+  if (waitUs > i2cDeviceStats[device].maxWaitUs) i2cDeviceStats[device].maxWaitUs = waitUs;
+}
+
+/**
+ * @brief Memulai bus I2C di pin SDA/SCL dengan clock tertinggi yang didukung semua perangkat.
+ */
+void setupI2cBus() {
+  memset(i2cDeviceStats, 0, sizeof(i2cDeviceStats));
+
+  uint32_t clockHz = I2C_BUS_FAST_HZ;
+  for (int i = 0; i < I2C_DEV_COUNT; i++) {
+    if (I2C_DEVICES[i].maxClockHz < clockHz) clockHz = I2C_DEVICES[i].maxClockHz;
+  }
+  busClockHz = clockHz;
+
+  for (int i = 0; i < I2C_BUS_MAX_WAITERS; i++) {
+    waiters[i].state = I2C_WAITER_FREE;
+    waiters[i].grant = xSemaphoreCreateBinary();
+    if (waiters[i].grant == nullptr) {
+      Serial.println("[I2C_BUS] Gagal membuat semaphore antrean.");
+    }
+  }
+
+  hal_i2c_begin(I2C_BUS_SDA_PIN, I2C_BUS_SCL_PIN, busClockHz);
+  hal_i2c_set_timeout(I2C_BUS_TIMEOUT_MS);
+  Serial.printf("[I2C_BUS] Wire aktif (SDA %d, SCL %d) @ %lu kHz%s.\n", I2C_BUS_SDA_PIN, I2C_BUS_SCL_PIN,
+                (unsigned long)(busClockHz / 1000), busClockHz >= I2C_BUS_FAST_HZ ? " (fast-mode)" : "");
+}
+
+uint32_t i2c_bus_clock() {
+  return busClockHz;
+}
+
+const char* i2c_device_name(I2cDeviceId device) {
+  if (device >= I2C_DEV_COUNT) return "unknown";
+  return I2C_DEVICES[device].name;
+}
+
+/**
+ * @brief Memegang bus untuk transaksi perangkat. Jika bus sedang dipakai task lain,
+ * task pemanggil diblokir di antrean tunggu sampai diberi bus oleh i2c_bus_release().
+ */
+void i2c_bus_acquire(I2cDeviceId device) {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  uint32_t requestedUs = hal_micros();
+
+  for (;;) {
+    int slot = -1;
+    portENTER_CRITICAL(&i2cBusMux);
+    if (busOwner == self) {
+      ownerDepth++; // Transaksi bersarang tetap dihitung atas perangkat terluar
+      portEXIT_CRITICAL(&i2cBusMux);
+      return;
+    }
+    if (busOwner == nullptr) {
+      busOwner = self;
+      ownerDepth = 1;
+      ownerDevice = device;
+      portEXIT_CRITICAL(&i2cBusMux);
+      beginOwnership(device, requestedUs);
+      return;
+    }
+    for (int i = 0; i < I2C_BUS_MAX_WAITERS; i++) {
+      if (waiters[i].state == I2C_WAITER_FREE && waiters[i].grant != nullptr) {
+        slot = i;
+        break;
+      }
+    }
+    if (slot >= 0) {
+      waiters[slot].state = I2C_WAITER_WAITING;
+      waiters[slot].task = self;
+      waiters[slot].device = device;
+      waiters[slot].sequence = waiterSequence++;
+    }
+    portEXIT_CRITICAL(&i2cBusMux);
+
+    if (slot < 0) {
+      vTaskDelay(1); // Antrean penuh: coba lagi tick berikutnya
+      continue;
+    }
+
+    // release() sudah menjadikan task ini pemilik sebelum memberi semaphore
+    xSemaphoreTake(waiters[slot].grant, portMAX_DELAY);
+    portENTER_CRITICAL(&i2cBusMux);
+    waiters[slot].state = I2C_WAITER_FREE;
+    portEXIT_CRITICAL(&i2cBusMux);
+    beginOwnership(device, requestedUs);
+    return;
+  }
+}
+
+/**
+ * @brief Melepas bus, mencatat statistik transaksi, lalu menyerahkan bus ke antrean
+ * dengan prioritas tertinggi.
+ * @param ok false jika transfer gagal (NACK, timeout, atau library melapor gagal).
+ */
+void i2c_bus_release(bool ok) {
+  if (!ok) ownerOk = false;
+
+  portENTER_CRITICAL(&i2cBusMux);
+  if (ownerDepth > 1) {
+    ownerDepth--;
+    portEXIT_CRITICAL(&i2cBusMux);
+    return;
+  }
+  portEXIT_CRITICAL(&i2cBusMux);
+
+  uint32_t elapsedUs = hal_micros() - ownerStartUs;
+
+  SemaphoreHandle_t grant = nullptr;
+  portENTER_CRITICAL(&i2cBusMux);
+  // Statistik ditulis sebelum bus diserahkan, di dalam mux agar totalUs 64 bit tidak
+  // terbaca setengah jadi oleh writeI2cBusJson() di core lain
+  I2cDeviceStats& stats = i2cDeviceStats[ownerDevice];
+  stats.transactions++;
+  stats.totalUs += elapsedUs;
+  if (elapsedUs > stats.maxUs) stats.maxUs = elapsedUs;
+  if (!ownerOk) stats.errors++;
+
+  int next = nextWaiter();
+  if (next >= 0) {
+    busOwner = waiters[next].task;
+    ownerDevice = waiters[next].device;
+    ownerDepth = 1;
+    grant = waiters[next].grant;
+    waiters[next].state = I2C_WAITER_GRANTED;
+  } else {
+    busOwner = nullptr;
+    ownerDepth = 0;
+  }
+  portEXIT_CRITICAL(&i2cBusMux);
+
+  if (grant != nullptr) xSemaphoreGive(grant);
+}
+
+bool i2c_bus_write(I2cDeviceId device, const uint8_t* data, size_t length) {
+  i2c_bus_acquire(device);
+  bool ok = hal_i2c_write(I2C_DEVICES[device].address, data, length) == 0;
+  i2c_bus_release(ok);
+  return ok;
+}
+
+bool i2c_bus_read(I2cDeviceId device, uint8_t* data, size_t length) {
+  i2c_bus_acquire(device);
+  bool ok = hal_i2c_read(I2C_DEVICES[device].address, data, length) == length;
+  i2c_bus_release(ok);
+  return ok;
+}
+
+// NACK adalah hasil normal saat scan, sehingga hanya timeout/error bus yang dihitung error
+uint8_t i2c_bus_probe(uint8_t address, uint16_t timeoutMs) {
+  i2c_bus_acquire(I2C_DEV_BUS);
+  hal_i2c_set_timeout(timeoutMs);
+  uint8_t result = hal_i2c_write(address, nullptr, 0);
+  hal_i2c_set_timeout(I2C_BUS_TIMEOUT_MS);
+  i2c_bus_release(result == 0 || result == 2);
+  return result;
+}
+
+/**
+ * @brief Menulis {"clockHz", "devices":[...]} berisi jumlah transaksi, error, durasi
+ * rata-rata/maksimum dan antre terlama per perangkat.
+ */
+void writeI2cBusJson(JsonWriter& writer) {
+  writer.beginObject()
+    .field("clockHz", (unsigned long)busClockHz);
+  writer.beginArray("devices");
+  for (int i = 0; i < I2C_DEV_COUNT; i++) {
+    portENTER_CRITICAL(&i2cBusMux);
+    I2cDeviceStats stats = i2cDeviceStats[i];
+    portEXIT_CRITICAL(&i2cBusMux);
+    char address[5];
+    snprintf(address, sizeof(address), "0x%02x", I2C_DEVICES[i].address);
+    writer.beginObject()
+      .field("name", I2C_DEVICES[i].name)
+      .field("address", address)
+      .field("priority", (int)I2C_DEVICES[i].priority)
+      .field("transactions", (unsigned long)stats.transactions)
+      .field("errors", (unsigned long)stats.errors)
+      .field("avgUs", stats.transactions > 0 ? (unsigned long)(stats.totalUs / stats.transactions) : 0UL)
+      .field("maxUs", (unsigned long)stats.maxUs)
+      .field("maxWaitUs", (unsigned long)stats.maxWaitUs)
+      .endObject();
+  }
+  writer.endArray().endObject();
+}
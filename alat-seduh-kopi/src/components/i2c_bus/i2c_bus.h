@@ -0,0 +1,91 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+
+// --- Konfigurasi Bus I2C ---
+#define I2C_BUS_SDA_PIN 21
+#define I2C_BUS_SCL_PIN 22
+#define I2C_BUS_STANDARD_HZ 100000
+#define I2C_BUS_FAST_HZ 400000
+#define I2C_BUS_TIMEOUT_MS 20     // Batas satu transfer Wire, agar bus macet tidak menahan task kontrol
+#define I2C_BUS_MAX_WAITERS 6     // Jumlah task yang boleh menunggu bus sekaligus
+
+// Clock maksimum PCF8574 menurut datasheet (TI/NXP) adalah 100 kHz. Modul yang sudah
+// diuji stabil di fast-mode bisa dinaikkan lewat build_flags:
+//   -D I2C_PCF8574_MAX_CLOCK_HZ=400000
+#ifndef I2C_PCF8574_MAX_CLOCK_HZ
+#define I2C_PCF8574_MAX_CLOCK_HZ I2C_BUS_STANDARD_HZ
+#endif
+
+// --- Alamat Perangkat I2C ---
+#define I2C_MOTOR_ADDRESS 0x20       // PCF8574 motor & LM298N
+#define I2C_FRONT_PANEL_ADDRESS 0x21 // PCF8574 tombol & LED front panel
+#define I2C_LCD_ADDRESS 0x27         // Backpack PCF8574 LCD
+
+// Perangkat di bus. Statistik dicatat per perangkat.
+enum I2cDeviceId : uint8_t {
+  I2C_DEV_MOTOR = 0,
+  I2C_DEV_FRONT_PANEL,
+  I2C_DEV_LCD,
+  I2C_DEV_BUS,       // Operasi seluruh bus (scan alamat)
+  I2C_DEV_COUNT
+};
+
+// Prioritas transaksi. Saat bus dilepas, transaksi yang menunggu dengan prioritas
+// tertinggi (nilai terkecil) dijalankan lebih dulu; sesama prioritas urut kedatangan.
+enum I2cPriority : uint8_t {
+  I2C_PRIORITY_SAFETY = 0, // Motor & pompa (berhenti tepat waktu)
+  I2C_PRIORITY_PANEL,      // Tombol & LED front panel
+  I2C_PRIORITY_DISPLAY,    // LCD
+  I2C_PRIORITY_BACKGROUND  // Scan & diagnostik
+};
+
+// Statistik per perangkat. Hanya ditulis oleh pemegang bus; penghitung transaksi
+// (termasuk totalUs 64 bit) diperbarui di dalam i2cBusMux saat bus dilepas dan disalin
+// di bawah kunci yang sama oleh writeI2cBusJson().
+struct I2cDeviceStats {
+  uint32_t transactions;
+  uint32_t errors;
+  uint64_t totalUs;   // Total durasi transaksi (64 bit, tidak wrap selama uptime)
+  uint32_t maxUs;     // Durasi transaksi terlama
+  uint32_t maxWaitUs; // Antre terlama sebelum mendapat bus
+};
+extern I2cDeviceStats i2cDeviceStats[I2C_DEV_COUNT];
+
+// --- Prototipe Fungsi Bus I2C ---
+// Dipanggil sekali di setup(), sebelum perangkat I2C mana pun diinisialisasi.
+// hal_i2c_begin() hanya dipanggil di sini.
+void setupI2cBus();
+uint32_t i2c_bus_clock();
+const char* i2c_device_name(I2cDeviceId device);
+
+// Mengantre lalu memegang bus untuk satu transaksi perangkat. Boleh bersarang dari
+// task yang sama. Setiap acquire harus diakhiri release dari task yang sama.
+void i2c_bus_acquire(I2cDeviceId device);
+void i2c_bus_release(bool ok);
+
+// Transaksi satu byte/blok langsung lewat hal_i2c_* (bus dipegang selama transfer)
+bool i2c_bus_write(I2cDeviceId device, const uint8_t* data, size_t length);
+bool i2c_bus_read(I2cDeviceId device, uint8_t* data, size_t length);
+// Satu probe alamat (transmisi kosong) dengan timeout sendiri, dicatat pada I2C_DEV_BUS.
+// Mengembalikan kode Wire.endTransmission(): 0 = ACK, 2 = NACK alamat, lainnya = error bus.
+uint8_t i2c_bus_probe(uint8_t address, uint16_t timeoutMs);
+
+// Memegang bus selama scope untuk operasi library (Adafruit_PCF8574, LiquidCrystal_I2C).
+// Panggil fail() jika library melaporkan kegagalan, agar tercatat sebagai error.
+class I2cTransaction {
+public:
+  explicit I2cTransaction(I2cDeviceId device) : ok(true) { i2c_bus_acquire(device); }
+  ~I2cTransaction() { i2c_bus_release(ok); }
+  void fail() { ok = false; }
+  bool check(bool result) { if (!result) ok = false; return result; }
+
+private:
+  bool ok;
+};
+
+void writeI2cBusJson(JsonWriter& writer);
+
+#endif // I2C_BUS_H
@@ -0,0 +1,152 @@
+/*
+  src/components/i2c_scanner/i2c_scanner.cpp - Pemindai Alamat I2C
+  Scan berjalan bertahap di task "i2cScan" (loopTask), beberapa probe per putaran,
+  setiap probe sebagai transaksi I2C berprioritas terendah dengan timeout pendek.
+  Boot tidak lagi menunggu scan: setup() hanya menjadwalkan scan cepat, dan hasilnya
+  dikirim ke klien web oleh task jaringan begitu scan selesai.
+*/
+
+#include "i2c_scanner.h"
+#include <atomic>
+#include "components/i2c_bus/i2c_bus.h"
+#include "components/scheduler/scheduler.h"
+#include "components/rtos_tasks/seqlock.h"
+
+// Rentang alamat scan cepat: PCF8574 (motor, front panel, LCD) dan varian PCF8574A
+struct I2cAddressRange {
+  uint8_t first;
+  uint8_t last;
+};
+static const I2cAddressRange QUICK_SCAN_RANGES[] = {
+  {0x20, 0x27},
+  {0x38, 0x3F}
+};
+static const size_t QUICK_SCAN_RANGE_COUNT = sizeof(QUICK_SCAN_RANGES) / sizeof(QUICK_SCAN_RANGES[0]);
+
+static SeqLock<I2cScanResult> scanResult;
+static std::atomic<bool> fullScanRequested(false);
+static std::atomic<bool> scanActive(false);
+
+// --- State Scan Berjalan (hanya disentuh task "i2cScan") ---
+static I2cScanMode activeMode = I2C_SCAN_NONE;
+static I2cScanResult workingResult;
+static size_t rangeIndex = 0;
+static uint8_t nextAddress = 0;
+static unsigned long scanStartMillis = 0;
+
+static void beginScan(I2cScanMode mode, unsigned long currentMillis) {
+  activeMode = mode;
+  scanActive.store(true);
+  memset(&workingResult, 0, sizeof(workingResult));
+  workingResult.mode = mode;
+  rangeIndex = 0;
+  nextAddress = mode == I2C_SCAN_FULL ? I2C_SCAN_FULL_FIRST : QUICK_SCAN_RANGES[0].first;
+  scanStartMillis = currentMillis;
+}
+
+// Alamat berikutnya yang akan diprobe; false jika scan sudah mencakup semua alamat
+static bool advanceAddress(uint8_t& address) {
+  if (activeMode == I2C_SCAN_FULL) {
+    if (nextAddress > I2C_SCAN_FULL_LAST) return false;
+    address = nextAddress++;
+    return true;
+  }
+  while (rangeIndex < QUICK_SCAN_RANGE_COUNT) {
+    if (nextAddress <= QUICK_SCAN_RANGES[rangeIndex].last) {
+      address = nextAddress++;
+      return true;
+    }
+    rangeIndex++;
+    if (rangeIndex < QUICK_SCAN_RANGE_COUNT) nextAddress = QUICK_SCAN_RANGES[rangeIndex].first;
+  }
+  return false;
+}
+
+static void finishScan(unsigned long currentMillis) {
+  workingResult.durationMs = currentMillis - scanStartMillis;
+  scanResult.write(workingResult);
+  Serial.printf("[I2C_SCAN] Scan %s selesai dalam %lu ms: %u perangkat",
+                activeMode == I2C_SCAN_FULL ? "penuh" : "cepat",
+                (unsigned long)workingResult.durationMs, (unsigned)workingResult.count);
+  for (uint8_t i = 0; i < workingResult.count; i++) {
+    Serial.printf(" 0x%02x", workingResult.addresses[i]);
+  }
+  Serial.println(workingResult.errors > 0 ? " (ada error bus)." : ".");
+  activeMode = I2C_SCAN_NONE;
+  scanActive.store(false);
+}
+
+void setupI2cScanner() {
+  beginScan(I2C_SCAN_QUICK, millis());
+  scheduler_add_periodic("i2cScan", handleI2cScanner, I2C_SCAN_TASK_INTERVAL_MS, TASK_PRIORITY_LOW, SCHED_GROUP_IO);
+  Serial.println("[I2C_SCAN] Scan cepat dijadwalkan setelah boot.");
+}
+
+bool i2c_scan_request_full() {
+  return !fullScanRequested.exchange(true);
+}
+
+bool i2c_scan_running() {
+  return fullScanRequested.load() || scanActive.load();
+}
+
+I2cScanResult i2c_scan_result() {
+  return scanResult.read();
+}
+
+uint32_t i2c_scan_version() {
+  return scanResult.version();
+}
+
+/**
+ * @brief Task "i2cScan": memprobe maksimal I2C_SCAN_PROBES_PER_PASS alamat per putaran.
+ * Scan penuh yang diminta dimulai setelah scan yang sedang berjalan selesai.
+ */
+void handleI2cScanner(unsigned long currentMillis) {
+  if (activeMode == I2C_SCAN_NONE) {
+    if (!fullScanRequested.load()) return;
+    beginScan(I2C_SCAN_FULL, currentMillis);
+  }
+
+  for (int i = 0; i < I2C_SCAN_PROBES_PER_PASS; i++) {
+    uint8_t address;
+    if (!advanceAddress(address)) {
+      if (activeMode == I2C_SCAN_FULL) fullScanRequested.store(false);
+      finishScan(currentMillis);
+      return;
+    }
+    uint8_t error = i2c_bus_probe(address, I2C_SCAN_PROBE_TIMEOUT_MS);
+    if (error == 0) {
+      if (workingResult.count < I2C_SCAN_MAX_DEVICES) workingResult.addresses[workingResult.count++] = address;
+    } else if (error != 2 && workingResult.errors < 255) {
+      workingResult.errors++;
+    }
+  }
+}
+
+static void writeAddresses(JsonWriter& writer, const char* key, const I2cScanResult& result) {
+  char addrStr[5]; // "0x27"
+  writer.beginArray(key);
+  for (uint8_t i = 0; i < result.count; i++) {
+    snprintf(addrStr, sizeof(addrStr), "0x%02x", result.addresses[i]);
+    writer.value(addrStr);
+  }
+  writer.endArray();
+}
+
+void writeI2cAddressArray(JsonWriter& writer, const char* key) {
+  I2cScanResult result = scanResult.read();
+  writeAddresses(writer, key, result);
+}
+
+void writeI2cScanJson(JsonWriter& writer) {
+  I2cScanResult result = scanResult.read();
+  writer.beginObject()
+    .field("type", "i2cScan")
+    .field("full", result.mode == I2C_SCAN_FULL)
+    .field("running", i2c_scan_running())
+    .field("errors", (int)result.errors)
+    .field("durationMs", (unsigned long)result.durationMs);
+  writeAddresses(writer, "addresses", result);
+  writer.endObject();
+}
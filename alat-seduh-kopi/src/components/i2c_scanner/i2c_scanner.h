@@ -0,0 +1,48 @@
+#ifndef I2C_SCANNER_H
+#define I2C_SCANNER_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+
+// --- Konfigurasi I2C Scanner ---
+#define I2C_SCAN_MAX_DEVICES 16        // Jumlah maksimum alamat hasil scan yang disimpan
+#define I2C_SCAN_PROBE_TIMEOUT_MS 5    // Timeout per probe (bawaan Wire 50 ms)
+#define I2C_SCAN_PROBES_PER_PASS 8     // Probe per putaran task "i2cScan" (bus dilepas antar probe)
+#define I2C_SCAN_TASK_INTERVAL_MS 10
+#define I2C_SCAN_FULL_FIRST 0x08       // Rentang alamat 7-bit di luar alamat cadangan
+#define I2C_SCAN_FULL_LAST 0x77
+
+// Jenis scan
+enum I2cScanMode : uint8_t {
+  I2C_SCAN_NONE = 0,
+  I2C_SCAN_QUICK, // Rentang PCF8574 (0x20-0x27) & PCF8574A (0x38-0x3F), dijalankan saat boot
+  I2C_SCAN_FULL   // Semua alamat 0x08-0x77, atas permintaan dari halaman diagnostik
+};
+
+// Hasil scan terakhir yang selesai
+struct I2cScanResult {
+  I2cScanMode mode;
+  uint8_t count;
+  uint8_t errors;        // Probe yang gagal karena timeout/error bus (bukan NACK)
+  uint32_t durationMs;
+  uint8_t addresses[I2C_SCAN_MAX_DEVICES];
+};
+
+// --- Prototipe Fungsi I2C Scanner ---
+// Mendaftarkan task "i2cScan" (grup IO) dan menjadwalkan scan cepat. Scan tidak
+// berjalan di setup(), melainkan di loopTask setelah web server aktif.
+void setupI2cScanner();
+// Meminta scan penuh. Aman dari task mana pun; false jika scan penuh sudah berjalan/antre.
+bool i2c_scan_request_full();
+bool i2c_scan_running();
+
+// Hasil terakhir (salinan konsisten) & nomor versinya, berubah setiap scan selesai
+I2cScanResult i2c_scan_result();
+uint32_t i2c_scan_version();
+void handleI2cScanner(unsigned long currentMillis);
+
+// Pesan {"type":"i2cScan"} dan array alamat ("0x27") untuk pesan lain
+void writeI2cScanJson(JsonWriter& writer);
+void writeI2cAddressArray(JsonWriter& writer, const char* key);
+
+#endif // I2C_SCANNER_H
@@ -0,0 +1,170 @@
+/*
+  src/components/json_writer/json_writer.cpp - Implementasi Penulis JSON Tanpa Alokasi
+  Menggantikan penyusunan JSON dengan penggabungan String di jalur telemetri dan
+  WebSocket. Semua output ditulis ke buffer statis/stack milik pemanggil.
+*/
+
+#include "json_writer.h"
+#include <stdarg.h>
+
+JsonWriter::JsonWriter(char* buffer, size_t capacity)
+  : buffer(buffer), capacity(capacity) {
+  reset();
+}
+
+void JsonWriter::reset() {
+  len = 0;
+  overflow = false;
+  needComma = false;
+  if (capacity > 0) buffer[0] = '\0';
+}
+
+// --- Fungsi Helper Penulisan Mentah ---
+void JsonWriter::appendRaw(const char* text, size_t textLen) {
+  if (overflow) return;
+  if (len + textLen >= capacity) { // Sisakan 1 byte untuk '\0'
+    overflow = true;
+    return;
+  }
+  memcpy(buffer + len, text, textLen);
+  len += textLen;
+  buffer[len] = '\0';
+}
+
+void JsonWriter::appendChar(char c) {
+  appendRaw(&c, 1);
+}
+
+void JsonWriter::appendFormat(const char* format, ...) {
+  if (overflow) return;
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buffer + len, capacity - len, format, args);
+  va_end(args);
+  if (written < 0 || len + written >= capacity) {
+    overflow = true;
+    buffer[len] = '\0'; // Buang sisa tulisan yang terpotong
+    return;
+  }
+  len += written;
+}
+
+void JsonWriter::writeSeparator() {
+  if (needComma) appendChar(',');
+  needComma = true;
+}
+
+void JsonWriter::writeKey(const char* key) {
+  writeSeparator();
+  if (key != nullptr) {
+    writeString(key);
+    appendChar(':');
+  }
+}
+
+// Menulis string JSON dengan escape untuk karakter khusus
+void JsonWriter::writeString(const char* text) {
+  appendChar('"');
+  for (const char* p = text; *p != '\0' && !overflow; p++) {
+    char c = *p;
+    switch (c) {
+      case '"':  appendRaw("\\\"", 2); break;
+      case '\\': appendRaw("\\\\", 2); break;
+      case '\n': appendRaw("\\n", 2); break;
+      case '\r': appendRaw("\\r", 2); break;
+      case '\t': appendRaw("\\t", 2); break;
+      default:
+        if ((uint8_t)c < 0x20) {
+          appendFormat("\\u%04x", (unsigned int)(uint8_t)c);
+        } else {
+          appendChar(c);
+        }
+        break;
+    }
+  }
+  appendChar('"');
+}
+
+// --- Objek & Array ---
+JsonWriter& JsonWriter::beginObject(const char* key) {
+  writeKey(key);
+  appendChar('{');
+  needComma = false;
+  return *this;
+}
+
+JsonWriter& JsonWriter::endObject() {
+  appendChar('}');
+  needComma = true;
+  return *this;
+}
+
+JsonWriter& JsonWriter::beginArray(const char* key) {
+  writeKey(key);
+  appendChar('[');
+  needComma = false;
+  return *this;
+}
+
+JsonWriter& JsonWriter::endArray() {
+  appendChar(']');
+  needComma = true;
+  return *this;
+}
+
+// --- Pasangan Key-Value ---
+JsonWriter& JsonWriter::field(const char* key, const char* value) {
+  writeKey(key);
+  writeString(value != nullptr ? value : "");
+  return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* key, bool value) {
+  writeKey(key);
+  if (value) appendRaw("true", 4);
+  else appendRaw("false", 5);
+  return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* key, int value) {
+  return field(key, (long)value);
+}
+
+JsonWriter& JsonWriter::field(const char* key, unsigned int value) {
+  return field(key, (unsigned long)value);
+}
+
+JsonWriter& JsonWriter::field(const char* key, long value) {
+  writeKey(key);
+  appendFormat("%ld", value);
+  return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* key, unsigned long value) {
+  writeKey(key);
+  appendFormat("%lu", value);
+  return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* key, float value, uint8_t decimals) {
+  writeKey(key);
+  if (isnan(value) || isinf(value)) {
+    appendRaw("null", 4); // JSON tidak mengenal NaN
+  } else {
+    appendFormat("%.*f", (int)decimals, (double)value);
+  }
+  return *this;
+}
+
+// --- Elemen Array ---
+JsonWriter& JsonWriter::value(const char* value) {
+  writeSeparator();
+  writeString(value != nullptr ? value : "");
+  return *this;
+}
+
+JsonWriter& JsonWriter::value(long value) {
+  writeSeparator();
+  appendFormat("%ld", value);
+  return *this;
+}
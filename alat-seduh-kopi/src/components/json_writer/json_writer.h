@@ -0,0 +1,54 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Arduino.h>
+
+// JsonWriter menulis JSON langsung ke buffer char berukuran tetap milik pemanggil.
+// Tidak ada alokasi heap: jika buffer penuh, penulisan berhenti dan overflowed()
+// bernilai true sehingga pemanggil bisa membuang pesan yang terpotong.
+class JsonWriter {
+public:
+  JsonWriter(char* buffer, size_t capacity);
+
+  void reset();
+
+  JsonWriter& beginObject(const char* key = nullptr);
+  JsonWriter& endObject();
+  JsonWriter& beginArray(const char* key = nullptr);
+  JsonWriter& endArray();
+
+  // Pasangan key-value di dalam objek
+  JsonWriter& field(const char* key, const char* value);
+  JsonWriter& field(const char* key, bool value);
+  JsonWriter& field(const char* key, int value);
+  JsonWriter& field(const char* key, unsigned int value);
+  JsonWriter& field(const char* key, long value);
+  JsonWriter& field(const char* key, unsigned long value);
+  JsonWriter& field(const char* key, float value, uint8_t decimals); // NaN ditulis sebagai null
+
+  // Elemen di dalam array
+  JsonWriter& value(const char* value);
+  JsonWriter& value(long value);
+
+  const char* c_str() const { return buffer; }
+  size_t length() const { return len; }
+  bool overflowed() const { return overflow; }
+  // Sisa byte yang masih bisa ditulis (tanpa '\0'), untuk pesan yang diisi sampai penuh
+  size_t remaining() const { return overflow || len + 1 >= capacity ? 0 : capacity - len - 1; }
+
+private:
+  void appendRaw(const char* text, size_t textLen);
+  void appendChar(char c);
+  void appendFormat(const char* format, ...);
+  void writeSeparator();
+  void writeKey(const char* key);
+  void writeString(const char* text);
+
+  char* buffer;
+  size_t capacity;
+  size_t len;
+  bool overflow;
+  bool needComma; // true jika elemen berikutnya harus didahului ','
+};
+
+#endif // JSON_WRITER_H
@@ -1,12 +1,20 @@
 #include "lcd_display.h" // Sertakan header file ini
-#include <Wire.h>        // Library untuk komunikasi I2C
+#include "components/scheduler/scheduler.h"
+#include "components/i2c_bus/i2c_bus.h"
+#include "components/rtos_tasks/spsc_queue.h"
+#include "components/perf_probe/perf_probe.h"
 
 // Definisi objek LCD
 LiquidCrystal_I2C lcd(LCD_ADDRESS, LCD_COLUMNS, LCD_ROWS);
 
-// Fungsi untuk menginisialisasi LCD
+// Perintah dari task kontrol, dijalankan oleh task "lcd" di grup IO.
+// Menulis satu baris LCD lewat I2C memakan beberapa milidetik, sehingga task kontrol
+// hanya mengantrekan teks dan tidak pernah menunggu LCD.
+static SpscQueue<LcdCommand, LCD_QUEUE_SIZE + 1> lcdQueue;
+
+// Fungsi untuk menginisialisasi LCD. Wire sudah dimulai oleh setupI2cBus(); setup()
+// berjalan sebelum task lain dibuat, sehingga inisialisasi belum perlu mengantre bus.
 void setupLCD() {
-  Wire.begin(); // Memulai komunikasi I2C (penting untuk LCD I2C)
   lcd.init();   // Inisialisasi LCD
   lcd.backlight(); // Nyalakan lampu latar LCD
   lcd.clear();  // Bersihkan layar
@@ -14,5 +22,55 @@ void setupLCD() {
   lcd.print("Coffee Machine");
   lcd.setCursor(0, 1);
   lcd.print("Initializing...");
+  scheduler_add_periodic("lcd", handleLcdDisplay, LCD_REFRESH_INTERVAL_MS, TASK_PRIORITY_NORMAL, SCHED_GROUP_IO);
   Serial.println("LCD terinisialisasi.");
-}
\ No newline at end of file
+}
+
+bool lcd_post_clear() {
+  LcdCommand command;
+  command.op = LCD_OP_CLEAR;
+  command.col = 0;
+  command.row = 0;
+  command.text[0] = '\0';
+  return lcdQueue.push(command);
+}
+
+bool lcd_post_text(uint8_t col, uint8_t row, const char* text) {
+  LcdCommand command;
+  command.op = LCD_OP_TEXT;
+  command.col = col;
+  command.row = row;
+  strncpy(command.text, text, LCD_TEXT_MAX);
+  command.text[LCD_TEXT_MAX] = '\0';
+  return lcdQueue.push(command);
+}
+
+// Teks ditulis per potongan LCD_TX_CHUNK_CHARS karakter, satu transaksi I2C per
+// potongan, sehingga transaksi motor & tombol yang mengantre hanya menunggu satu potongan.
+// Kursor LCD maju sendiri, dan hanya task ini yang menulis LCD setelah setup().
+static void writeLcdText(const LcdCommand& command) {
+  {
+    I2cTransaction transaction(I2C_DEV_LCD);
+    lcd.setCursor(command.col, command.row);
+  }
+  size_t length = strlen(command.text);
+  for (size_t offset = 0; offset < length; offset += LCD_TX_CHUNK_CHARS) {
+    I2cTransaction transaction(I2C_DEV_LCD);
+    for (size_t i = offset; i < length && i < offset + LCD_TX_CHUNK_CHARS; i++) {
+      lcd.write((uint8_t)command.text[i]);
+    }
+  }
+}
+
+void handleLcdDisplay(unsigned long currentMillis) {
+  PERF_PROBE_SCOPE(PROBE_LCD);
+  LcdCommand command;
+  while (lcdQueue.pop(command)) {
+    if (command.op == LCD_OP_CLEAR) {
+      I2cTransaction transaction(I2C_DEV_LCD);
+      lcd.clear();
+    } else {
+      writeLcdText(command);
+    }
+  }
+}
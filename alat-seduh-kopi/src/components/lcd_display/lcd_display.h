@@ -3,19 +3,44 @@
 
 #include <Arduino.h>
 #include <LiquidCrystal_I2C.h> // Pastikan library ini sudah terinstal di platformio.ini
+#include "components/i2c_bus/i2c_bus.h"
 
 // --- Definisi Pin LCD I2C ---
-#define LCD_ADDRESS   0x27 // Alamat I2C umum untuk LCD 16x2 dengan modul PCF8574
+#define LCD_ADDRESS   I2C_LCD_ADDRESS // Alamat I2C umum untuk LCD 16x2 dengan modul PCF8574
 #define LCD_COLUMNS   16   // Jumlah kolom LCD Anda
 #define LCD_ROWS      2    // Jumlah baris LCD Anda
 
-// Deklarasi objek LCD sebagai 'extern' agar bisa diakses dari file lain
+#define LCD_TEXT_MAX  20   // Panjang teks maksimum per perintah (satu baris LCD 20x4)
+#define LCD_QUEUE_SIZE 32  // Antrean perintah LCD dari task kontrol ke task IO
+#define LCD_REFRESH_INTERVAL_MS 20 // Periode task "lcd" yang menjalankan antrean
+#define LCD_TX_CHUNK_CHARS 2 // Karakter per transaksi I2C (~2,5 ms @100 kHz: 12 transfer per karakter)
+
+// Deklarasi objek LCD sebagai 'extern' agar bisa diakses dari file lain.
+// Setelah setup() selesai, objek ini hanya disentuh oleh task "lcd" (grup IO).
+// Akses langsung harus di dalam I2cTransaction(I2C_DEV_LCD).
 extern LiquidCrystal_I2C lcd;
 
+// Perintah LCD yang diantrekan oleh task kontrol
+enum LcdOp : uint8_t {
+  LCD_OP_CLEAR = 0,
+  LCD_OP_TEXT
+};
+struct LcdCommand {
+  LcdOp op;
+  uint8_t col;
+  uint8_t row;
+  char text[LCD_TEXT_MAX + 1];
+};
+
 // Deklarasi fungsi inisialisasi LCD
 void setupLCD();
 void showWelcomeScene(); // Fungsi untuk menampilkan scene selamat datang
 void showConfirmationScene(int menuIndex);
 void showProcessingScene(); // Fungsi untuk menampilkan scene proses seduh
 
+// Antrekan perintah LCD. Hanya dari task kontrol (atau dari setup() sebelum task dibuat).
+bool lcd_post_clear();
+bool lcd_post_text(uint8_t col, uint8_t row, const char* text);
+void handleLcdDisplay(unsigned long currentMillis); // Task "lcd": jalankan antrean perintah
+
 #endif // LCD_DISPLAY_H
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*
+  src/components/log_stream/log_stream.cpp - Streaming Log ke Dashboard Web
+  Membaca ring buffer 'logger' dengan kursor nomor urut, tanpa kunci: producer log
+  tidak pernah menunggu pembaca, dan pembaca yang terlalu lambat hanya melihat bahwa
+  record lamanya sudah tertimpa (dilaporkan lewat selisih since & "from").
+
+  Topik WebSocket "logs": setiap putaran task jaringan, batch mulai dari kursor
+  terkecil pelanggan yang lancar diformat sekali ke buffer statis, lalu dikirim ke
+  semua pelanggan yang menunggu record tersebut (ws_clients_publish_cursor).
+  GET /api/logs?since=<seq> memakai format batch yang sama untuk polling/catch-up.
+*/
+
+#include "log_stream.h"
+#include "components/logger/logger.h"
+#include "components/ws_clients/ws_clients.h"
+
+// Ruang minimum untuk satu entri: pesan terformat (bisa membesar saat di-escape) & field
+#define LOG_STREAM_ENTRY_RESERVE (2 * LOG_LINE_SIZE + 64)
+
+static char logStreamJsonBuffer[LOG_STREAM_JSON_BUFFER_SIZE]; // Hanya dipakai task jaringan
+
+LogBatchRange writeLogBatchJson(JsonWriter& writer, uint32_t since, size_t maxEntries) {
+  uint32_t head = log_next_seq();
+  uint32_t window = head < LOG_BUFFER_RECORDS ? head : LOG_BUFFER_RECORDS;
+  uint32_t oldest = head - window;
+  if (since - oldest > window) since = oldest; // Sudah tertimpa, atau kursor dari boot sebelumnya
+
+  LogBatchRange range = {since, since};
+  writer.beginObject()
+    .field("type", "logs")
+    .field("from", (unsigned long)range.from)
+    .field("head", (unsigned long)head);
+
+  char message[LOG_LINE_SIZE];
+  size_t count = 0;
+  writer.beginArray("entries");
+  while (range.next != head && count < maxEntries && writer.remaining() >= LOG_STREAM_ENTRY_RESERVE) {
+    LogRecord record;
+    if (!log_read(range.next, record)) {
+      if (!log_expired(range.next)) break; // Masih ditulis producer: lanjut di batch berikutnya
+      range.next++;
+      continue;
+    }
+    log_format_message(record, message, sizeof(message));
+    writer.beginObject()
+      .field("seq", (unsigned long)range.next)
+      .field("t", (unsigned long)record.timestampMs)
+      .field("level", log_level_name(record.level))
+      .field("msg", message)
+      .endObject();
+    range.next++;
+    count++;
+  }
+  writer.endArray()
+    .field("next", (unsigned long)range.next)
+    .endObject();
+  return range;
+}
+
+/**
+ * @brief Mengirim satu batch topik logs. Pelanggan baru mulai dari LOG_STREAM_BACKLOG
+ * record terakhir; pelanggan yang kursornya lebih maju menyusul di putaran berikutnya.
+ */
+void publishLogStream(AsyncWebSocket& ws) {
+  uint32_t head = log_next_seq();
+  uint32_t backlog = head < LOG_STREAM_BACKLOG ? head : LOG_STREAM_BACKLOG;
+  uint32_t cursor;
+  if (!ws_clients_min_cursor(ws, WS_TOPIC_LOGS, head - backlog, cursor)) return;
+  if (cursor == head) return; // Semua pelanggan sudah mutakhir
+
+  JsonWriter writer(logStreamJsonBuffer, sizeof(logStreamJsonBuffer));
+  LogBatchRange range = writeLogBatchJson(writer, cursor, LOG_STREAM_BATCH_MAX);
+  if (range.next == range.from) return; // Record pertama masih ditulis producer
+  ws_clients_publish_cursor(ws, WS_TOPIC_LOGS, writer, range.from, range.next);
+}
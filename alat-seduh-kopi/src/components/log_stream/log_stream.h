@@ -0,0 +1,32 @@
+#ifndef LOG_STREAM_H
+#define LOG_STREAM_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "components/json_writer/json_writer.h"
+
+// --- Konfigurasi Streaming Log ---
+#define LOG_STREAM_JSON_BUFFER_SIZE 2048 // Buffer statis satu batch topik logs (task jaringan)
+#define LOG_STREAM_BATCH_MAX 16          // Record per batch topik logs
+#define LOG_STREAM_BACKLOG 32            // Record lama yang dikirim ke pelanggan baru
+#define LOG_API_BATCH_MAX 32             // Record per respons /api/logs
+
+// Rentang record dalam satu batch: [from, next)
+struct LogBatchRange {
+  uint32_t from;
+  uint32_t next;
+};
+
+// --- Prototipe Fungsi Streaming Log ---
+// Menulis {"type":"logs","from","head","entries":[{"seq","t","level","msg"}],"next"} mulai
+// dari record since. since yang sudah tertimpa (atau dari boot sebelumnya) dimajukan ke
+// record tertua yang masih ada, sehingga selisih since & "from" adalah jumlah yang hilang.
+// Berhenti sebelum buffer penuh, di record yang masih ditulis producer, atau setelah
+// maxEntries. "next" adalah kursor untuk pembacaan berikutnya.
+LogBatchRange writeLogBatchJson(JsonWriter& writer, uint32_t since, size_t maxEntries);
+
+// Dipanggil dari task jaringan: satu batch per putaran untuk pelanggan topik logs.
+// Hanya membaca ring buffer, tidak pernah menahan producer log.
+void publishLogStream(AsyncWebSocket& ws);
+
+#endif // LOG_STREAM_H
@@ -0,0 +1,63 @@
+#ifndef LOG_MESSAGES_H
+#define LOG_MESSAGES_H
+
+// --- Daftar Pesan Log ---
+// Record log hanya menyimpan ID pesan & argumen; teks format di bawah baru dipakai saat
+// record diformat oleh task "logDrain" (atau dibaca klien). Format yang didukung:
+// %d %i %u %x %X %c %s %% dengan flag '0' & lebar opsional (mis. %02x).
+// Argumen %s harus string statis (literal atau tabel const), bukan buffer sementara.
+#define LOG_MESSAGE_LIST(X) \
+  X(LOG_MSG_BUTTON_RELEASED,     "[OrderCoffee] Tombol PB%d dilepas.") \
+  X(LOG_MSG_BUTTON_PRESSED,      "[OrderCoffee] Tombol PB%d ditekan.") \
+  X(LOG_MSG_BUTTON_LONG_PRESS,   "[OrderCoffee] Tombol PB%d ditahan.") \
+  X(LOG_MSG_BUTTON_DOUBLE_PRESS, "[OrderCoffee] Tombol PB%d ditekan ganda.") \
+  X(LOG_MSG_IDLE_MENU,           "[LCD] Menampilkan menu idle...") \
+  X(LOG_MSG_IDLE_MENU_HIDDEN,    "[OrderCoffee] Aktivitas terdeteksi. Menyembunyikan Idle Menu.") \
+  X(LOG_MSG_LEDS_BLINK_START,    "[OrderCoffee] LEDs mulai blinking.") \
+  X(LOG_MSG_LEDS_BLINK_STOP,     "[OrderCoffee] LEDs berhenti blinking.") \
+  X(LOG_MSG_MENU_SELECTED,       "[OrderCoffee] Menu: Kopi %s dipilih.") \
+  X(LOG_MSG_MENU_INVALID,        "[OrderCoffee] Pilihan menu %d tidak valid.") \
+  X(LOG_MSG_MENU_LOCKED,         "[OrderCoffee] Sistem sedang dalam proses menu atau sudah dikonfirmasi. Tidak dapat memilih menu baru.") \
+  X(LOG_MSG_MENU_CONFIRMED,      "[OrderCoffee] Menu %d dikonfirmasi! Memulai proses kopi...") \
+  X(LOG_MSG_ORDER_FROM_WEB,      "[OrderCoffee] Pesanan dari web: tiket #%u, menu %u") \
+  X(LOG_MSG_ORDER_CANCEL_WEB,    "[OrderCoffee] Pesanan dibatalkan dari web.") \
+  X(LOG_MSG_ORDER_CANCEL_HOLD,   "[OrderCoffee] Pesanan dibatalkan (PB4 ditahan).") \
+  X(LOG_MSG_RFID_MENU_MODE,      "[OrderCoffee] Mode pemilihan menu RFID diaktifkan.") \
+  X(LOG_MSG_RFID_IGNORED,        "[OrderCoffee] Kartu RFID diabaikan, proses seduh sedang berjalan.") \
+  X(LOG_MSG_RFID_CARD_DETECTED,  "[RFID] Kartu RFID Terdeteksi! UID: %08X (%u byte)") \
+  X(LOG_MSG_RFID_TAP_QUEUE_FULL, "[RFID] Antrean tap kartu penuh, tap diabaikan.") \
+  X(LOG_MSG_RFID_CARD_SELECTED,  "[RFID] Kartu '%s' terdeteksi. Mengarahkan ke menu ID: %d") \
+  X(LOG_MSG_RFID_CARD_UNKNOWN,   "[RFID] Kartu RFID tidak dikenal: %08X. Menampilkan pesan error.") \
+  X(LOG_MSG_RFID_UID_RESET,      "[RFID] RFID UID direset setelah %ums.") \
+  X(LOG_MSG_RFID_ERROR_RESET,    "[RFID] Pesan error RFID direset setelah %ums.") \
+  X(LOG_MSG_BREW_PHASE,          "[OrderCoffee] Fase seduh: %s") \
+  X(LOG_MSG_BREW_DONE,           "[OrderCoffee] Kopi %s siap!") \
+  X(LOG_MSG_BREW_RESET,          "[OrderCoffee] Proses menu selesai. Mereset sistem ke mode idle.") \
+  X(LOG_MSG_BREW_SCHEDULE_FAIL,  "[OrderCoffee] ERROR: Langkah seduh tidak bisa dijadwalkan. Menghentikan semua motor.") \
+  X(LOG_MSG_ACTUATOR_ON,         "[MOTOR_CONTROL] %s ON (speed %d)") \
+  X(LOG_MSG_ACTUATOR_OFF,        "[MOTOR_CONTROL] %s OFF") \
+  X(LOG_MSG_ACTUATORS_STOPPED,   "[MOTOR_CONTROL] Semua motor dan pompa dihentikan.") \
+  X(LOG_MSG_DISTANCE,            "[STORAGE_DETECTOR] Sensor (Trig:%d, Echo:%d) Pengukuran: %d cm") \
+  X(LOG_MSG_DISTANCE_TIMEOUT,    "[STORAGE_DETECTOR] Sensor (Trig:%d, Echo:%d) Timeout: tidak ada objek dalam jangkauan.") \
+  X(LOG_MSG_DHT_TEMPERATURE,     "[DHT] Suhu: %s%d.%d C") \
+  X(LOG_MSG_DHT_HUMIDITY,        "[DHT] Kelembaban: %d %%") \
+  X(LOG_MSG_DHT_TEMPERATURE_FAIL, "[DHT] GAGAL membaca suhu dari sensor DHT!") \
+  X(LOG_MSG_DHT_HUMIDITY_FAIL,   "[DHT] GAGAL membaca kelembaban dari sensor DHT!") \
+  X(LOG_MSG_MEMORY_FRAGMENTED,   "[MEMORY] Fragmentasi heap %u%% (blok terbesar %u dari %u byte bebas)") \
+  X(LOG_MSG_MEMORY_RECOVERED,    "[MEMORY] Fragmentasi heap pulih ke %u%%") \
+  X(LOG_MSG_MEMORY_STACK_LOW,    "[MEMORY] Sisa stack task %s tinggal %u byte") \
+  X(LOG_MSG_WS_CONNECTED,        "[WS] WebSocket client #%u connected.") \
+  X(LOG_MSG_WS_CLIENTS_FULL,     "[WS] Klien WebSocket penuh, client #%u ditutup.") \
+  X(LOG_MSG_WS_DISCONNECTED,     "[WS] WebSocket client #%u disconnected.") \
+  X(LOG_MSG_WS_SNAPSHOT_OVERFLOW, "[WS] Snapshot melebihi ukuran buffer, tidak dikirim.") \
+  X(LOG_MSG_WS_COMMAND_REJECTED, "[WS] Perintah ditolak: %s (%u penolakan lain tidak dicatat)") \
+  X(LOG_MSG_RELAY_TOGGLED,       "[WS] Motor diubah ke: %s.")
+
+#define LOG_MESSAGE_ENUM(id, format) id,
+enum LogMessageId : uint16_t {
+  LOG_MESSAGE_LIST(LOG_MESSAGE_ENUM)
+  LOG_MSG_COUNT
+};
+#undef LOG_MESSAGE_ENUM
+
+#endif // LOG_MESSAGES_H
@@ -0,0 +1,230 @@
+/*
+  src/components/logger/logger.cpp - Logger Ring Buffer Biner
+  Producer (task kontrol, jaringan, IO, AsyncTCP) hanya mengambil nomor urut dengan
+  satu operasi atomik lalu menyalin record berukuran tetap ke slot ring buffer; tidak
+  ada String, snprintf, kunci, maupun tulis UART di jalur producer. Teks baru disusun
+  oleh task "logDrain" berprioritas terendah (grup IO), dan hanya selama buffer TX UART
+  masih cukup, sehingga task itu pun tidak pernah diblokir oleh Serial.
+
+  Setiap slot punya stamp = seq + 1 yang ditulis setelah record lengkap (0 = sedang
+  ditulis). Pembaca menyalin record lalu memeriksa stamp sebelum & sesudahnya, seperti
+  SeqLock per slot; record yang tertimpa producer ditolak, bukan dibaca setengah jadi.
+*/
+
+#include "logger.h"
+#include <atomic>
+#include "components/scheduler/scheduler.h"
+
+static_assert((LOG_BUFFER_RECORDS & (LOG_BUFFER_RECORDS - 1)) == 0, "LOG_BUFFER_RECORDS harus pangkat dua");
+
+struct LogSlot {
+  std::atomic<uint32_t> stamp;
+  LogRecord record;
+};
+
+static LogSlot logSlots[LOG_BUFFER_RECORDS];
+static std::atomic<uint32_t> nextSeq(0);
+
+// --- State Task "logDrain" ---
+static uint32_t drainSeq = 0;
+static uint32_t drainedCount = 0;
+static uint32_t overrunCount = 0;
+
+#define LOG_MESSAGE_FORMAT(id, format) format,
+static const char* const LOG_FORMATS[LOG_MSG_COUNT] = {
+  LOG_MESSAGE_LIST(LOG_MESSAGE_FORMAT)
+};
+#undef LOG_MESSAGE_FORMAT
+
+static const char LOG_LEVEL_CHARS[] = {'E', 'W', 'I', 'D'};
+static const char* const LOG_LEVEL_NAMES[] = {"error", "warn", "info", "debug"};
+
+void log_write_record(uint8_t level, LogMessageId id, const uintptr_t* args,
+                      uint8_t argCount, uint8_t stringMask) {
+  uint32_t seq = nextSeq.fetch_add(1, std::memory_order_relaxed);
+  LogSlot& slot = logSlots[seq & (LOG_BUFFER_RECORDS - 1)];
+
+  slot.stamp.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.record.timestampMs = millis();
+  slot.record.messageId = id;
+  slot.record.level = level;
+  slot.record.stringMask = stringMask;
+  for (uint8_t i = 0; i < LOG_MAX_ARGS; i++) {
+    slot.record.args[i] = i < argCount ? args[i] : 0;
+  }
+  slot.stamp.store(seq + 1, std::memory_order_release);
+}
+
+uint32_t log_next_seq() {
+  return nextSeq.load(std::memory_order_acquire);
+}
+
+bool log_read(uint32_t seq, LogRecord& out) {
+  const LogSlot& slot = logSlots[seq & (LOG_BUFFER_RECORDS - 1)];
+  uint32_t before = slot.stamp.load(std::memory_order_acquire);
+  if (before != seq + 1) return false;
+  memcpy(&out, (const void*)&slot.record, sizeof(LogRecord));
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return slot.stamp.load(std::memory_order_relaxed) == before;
+}
+
+// Slot record seq hanya bisa ditimpa oleh producer seq + LOG_BUFFER_RECORDS, yang
+// nomor urutnya sudah diambil sebelum mulai menulis
+bool log_expired(uint32_t seq) {
+  return log_next_seq() - seq > LOG_BUFFER_RECORDS;
+}
+
+const char* log_level_name(uint8_t level) {
+  if (level > LOG_LEVEL_DEBUG) return "unknown";
+  return LOG_LEVEL_NAMES[level];
+}
+
+// Menambahkan satu karakter, selalu menyisakan tempat untuk '\0'
+static inline void appendChar(char* buffer, size_t size, size_t& length, char c) {
+  if (length + 1 < size) buffer[length++] = c;
+}
+
+// Formatter kecil untuk subset printf yang dipakai daftar pesan (tanpa vsnprintf),
+// karena argumen disimpan seragam sebagai uintptr_t.
+size_t log_format_message(const LogRecord& record, char* buffer, size_t size) {
+  if (size == 0) return 0;
+  size_t length = 0;
+  const char* format = record.messageId < LOG_MSG_COUNT ? LOG_FORMATS[record.messageId] : "[LOG] Pesan tidak dikenal";
+  uint8_t argIndex = 0;
+
+  for (const char* p = format; *p != '\0'; p++) {
+    if (*p != '%') {
+      appendChar(buffer, size, length, *p);
+      continue;
+    }
+    p++;
+    if (*p == '%') {
+      appendChar(buffer, size, length, '%');
+      continue;
+    }
+    char pad = ' ';
+    if (*p == '0') {
+      pad = '0';
+      p++;
+    }
+    int width = 0;
+    while (*p >= '0' && *p <= '9') width = width * 10 + (*p++ - '0');
+    while (*p == 'l') p++;
+    if (*p == '\0') break;
+
+    uintptr_t raw = argIndex < LOG_MAX_ARGS ? record.args[argIndex] : 0;
+    bool isString = argIndex < LOG_MAX_ARGS && (record.stringMask & (1 << argIndex));
+    argIndex++;
+
+    char digits[12];
+    int digitCount = 0;
+    bool negative = false;
+    switch (*p) {
+      case 's': {
+        const char* text = isString && raw != 0 ? (const char*)raw : "(null)";
+        while (*text != '\0') appendChar(buffer, size, length, *text++);
+        continue;
+      }
+      case 'c':
+        appendChar(buffer, size, length, (char)raw);
+        continue;
+      case 'd':
+      case 'i': {
+        int32_t value = (int32_t)raw;
+        negative = value < 0;
+        uint32_t magnitude = negative ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+        do { digits[digitCount++] = '0' + magnitude % 10; magnitude /= 10; } while (magnitude);
+        break;
+      }
+      case 'u': {
+        uint32_t value = (uint32_t)raw;
+        do { digits[digitCount++] = '0' + value % 10; value /= 10; } while (value);
+        break;
+      }
+      case 'x':
+      case 'X': {
+        const char* hex = *p == 'x' ? "0123456789abcdef" : "0123456789ABCDEF";
+        uint32_t value = (uint32_t)raw;
+        do { digits[digitCount++] = hex[value & 0xF]; value >>= 4; } while (value);
+        break;
+      }
+      default:
+        appendChar(buffer, size, length, '?');
+        continue;
+    }
+    int total = digitCount + (negative ? 1 : 0);
+    if (negative && pad == '0') appendChar(buffer, size, length, '-');
+    for (int i = total; i < width; i++) appendChar(buffer, size, length, pad);
+    if (negative && pad != '0') appendChar(buffer, size, length, '-');
+    while (digitCount > 0) appendChar(buffer, size, length, digits[--digitCount]);
+  }
+  buffer[length] = '\0';
+  return length;
+}
+
+size_t log_format(const LogRecord& record, char* buffer, size_t size) {
+  char level = record.level <= LOG_LEVEL_DEBUG ? LOG_LEVEL_CHARS[record.level] : '?';
+  int prefix = snprintf(buffer, size, "[%6lu.%03lu] %c ", (unsigned long)(record.timestampMs / 1000),
+                        (unsigned long)(record.timestampMs % 1000), level);
+  if (prefix < 0 || (size_t)prefix >= size) return size > 0 ? size - 1 : 0;
+  return prefix + log_format_message(record, buffer + prefix, size - prefix);
+}
+
+LoggerStats logger_stats() {
+  LoggerStats stats;
+  stats.written = log_next_seq();
+  stats.drained = drainedCount;
+  stats.overrun = overrunCount;
+  return stats;
+}
+
+void writeLoggerJson(JsonWriter& writer, const char* key) {
+  LoggerStats stats = logger_stats();
+  writer.beginObject(key)
+    .field("written", (unsigned long)stats.written)
+    .field("drained", (unsigned long)stats.drained)
+    .field("overrun", (unsigned long)stats.overrun)
+    .field("level", log_level_name(LOG_LEVEL))
+    .endObject();
+}
+
+void setupLogger() {
+  scheduler_add_periodic("logDrain", handleLogDrain, LOG_DRAIN_INTERVAL_MS, TASK_PRIORITY_LOW, SCHED_GROUP_IO);
+}
+
+/**
+ * @brief Task "logDrain": memformat record baru ke Serial selama buffer TX UART masih
+ * cukup untuk satu baris penuh, maksimal LOG_DRAIN_MAX_PER_PASS record per putaran.
+ * Jika producer sudah menimpa record yang belum dicetak, jumlahnya dilaporkan sekali.
+ */
+void handleLogDrain(unsigned long currentMillis) {
+  uint32_t head = log_next_seq();
+  if (head - drainSeq > LOG_BUFFER_RECORDS) {
+    uint32_t lost = head - drainSeq - LOG_BUFFER_RECORDS;
+    overrunCount += lost;
+    drainSeq = head - LOG_BUFFER_RECORDS;
+    Serial.printf("[LOG] %lu record log hilang (buffer penuh).\n", (unsigned long)lost);
+  }
+
+  char line[LOG_LINE_SIZE];
+  for (int i = 0; i < LOG_DRAIN_MAX_PER_PASS && drainSeq != head; i++) {
+    if (Serial.availableForWrite() < LOG_LINE_SIZE) return; // UART penuh, coba putaran berikutnya
+
+    LogRecord record;
+    if (!log_read(drainSeq, record)) {
+      // Belum selesai ditulis producer: tunggu. Sudah tertimpa: lewati.
+      if (log_expired(drainSeq)) {
+        overrunCount++;
+        drainSeq++;
+        continue;
+      }
+      return;
+    }
+    size_t length = log_format(record, line, sizeof(line) - 1);
+    line[length++] = '\n';
+    Serial.write((const uint8_t*)line, length);
+    drainSeq++;
+    drainedCount++;
+  }
+}
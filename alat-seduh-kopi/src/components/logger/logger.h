@@ -0,0 +1,103 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+#include "log_messages.h"
+#include "components/json_writer/json_writer.h"
+
+// --- Level Log ---
+// Nilai #define (bukan enum) agar bisa dibandingkan di preprocessor & build_flags.
+#define LOG_LEVEL_ERROR 0
+#define LOG_LEVEL_WARN 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_DEBUG 3
+
+// Level tertinggi yang dikompilasi. Pemanggilan di atas level ini dihapus compiler
+// (argumennya tidak dievaluasi). Ubah lewat build_flags, mis. -D LOG_LEVEL=LOG_LEVEL_DEBUG
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// --- Konfigurasi Ring Buffer ---
+#define LOG_MAX_ARGS 4                // Argumen per record
+#define LOG_BUFFER_RECORDS 128        // Kapasitas ring (pangkat dua); record terlama ditimpa
+#define LOG_DRAIN_INTERVAL_MS 10      // Periode task "logDrain" (grup IO)
+#define LOG_DRAIN_MAX_PER_PASS 8      // Record yang diformat per putaran
+#define LOG_LINE_SIZE 128             // Buffer satu baris terformat
+#define LOG_SERIAL_TX_BUFFER 1024     // Buffer TX UART, diset sebelum Serial.begin()
+
+// Record biner berukuran tetap. Argumen string disimpan sebagai pointer (harus statis).
+struct LogRecord {
+  uint32_t timestampMs;
+  LogMessageId messageId;
+  uint8_t level;
+  uint8_t stringMask;           // Bit n = argumen n adalah const char*
+  uintptr_t args[LOG_MAX_ARGS];
+};
+
+struct LoggerStats {
+  uint32_t written;   // Record yang ditulis producer
+  uint32_t drained;   // Record yang sudah dicetak ke Serial
+  uint32_t overrun;   // Record yang tertimpa sebelum sempat dicetak
+};
+
+// --- Prototipe Fungsi Logger ---
+// Mendaftarkan task "logDrain". Record yang ditulis sebelumnya tetap dicetak.
+void setupLogger();
+void handleLogDrain(unsigned long currentMillis);
+
+// Menulis satu record tanpa kunci & tanpa I/O; aman dari task mana pun (bukan ISR).
+void log_write_record(uint8_t level, LogMessageId id, const uintptr_t* args,
+                      uint8_t argCount, uint8_t stringMask);
+
+// Nomor urut record berikutnya (record pertama = 0)
+uint32_t log_next_seq();
+// Menyalin record dengan nomor urut seq; false jika belum ditulis atau sudah tertimpa
+bool log_read(uint32_t seq, LogRecord& out);
+// true jika record seq sudah keluar dari jendela ring (tertimpa), bukan sedang ditulis
+bool log_expired(uint32_t seq);
+// Memformat record menjadi "[  12.345] I <pesan>", mengembalikan panjang teks
+size_t log_format(const LogRecord& record, char* buffer, size_t size);
+// Memformat hanya teks pesan (tanpa waktu & level)
+size_t log_format_message(const LogRecord& record, char* buffer, size_t size);
+const char* log_level_name(uint8_t level);
+
+LoggerStats logger_stats();
+// Objek statistik logger {"written","drained","overrun","level"} untuk /api/metrics
+void writeLoggerJson(JsonWriter& writer, const char* key);
+
+// --- Konversi Argumen (compile-time) ---
+namespace log_detail {
+inline uintptr_t toArg(const char* value) { return (uintptr_t)value; }
+inline uintptr_t toArg(char* value) { return (uintptr_t)value; }
+template <typename T>
+inline uintptr_t toArg(T value) { return (uintptr_t)(intptr_t)(int32_t)value; }
+
+template <typename T> struct IsString { static const uint8_t value = 0; };
+template <> struct IsString<const char*> { static const uint8_t value = 1; };
+template <> struct IsString<char*> { static const uint8_t value = 1; };
+
+inline uint8_t stringMask() { return 0; }
+template <typename T, typename... Rest>
+inline uint8_t stringMask(T, Rest... rest) {
+  return (uint8_t)(IsString<T>::value | (stringMask(rest...) << 1));
+}
+} // namespace log_detail
+
+template <typename... Args>
+inline void log_write(uint8_t level, LogMessageId id, Args... args) {
+  static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "Terlalu banyak argumen log");
+  const uintptr_t values[sizeof...(Args) + 1] = {log_detail::toArg(args)..., 0};
+  log_write_record(level, id, values, sizeof...(Args), log_detail::stringMask(args...));
+}
+
+// --- Makro Log ---
+// Kondisi konstan: di atas LOG_LEVEL seluruh pemanggilan dibuang saat kompilasi.
+#define LOG_AT(level, id, ...) \
+  do { if ((level) <= LOG_LEVEL) log_write((level), (id), ##__VA_ARGS__); } while (0)
+#define LOG_ERROR(id, ...) LOG_AT(LOG_LEVEL_ERROR, id, ##__VA_ARGS__)
+#define LOG_WARN(id, ...) LOG_AT(LOG_LEVEL_WARN, id, ##__VA_ARGS__)
+#define LOG_INFO(id, ...) LOG_AT(LOG_LEVEL_INFO, id, ##__VA_ARGS__)
+#define LOG_DEBUG(id, ...) LOG_AT(LOG_LEVEL_DEBUG, id, ##__VA_ARGS__)
+
+#endif // LOGGER_H
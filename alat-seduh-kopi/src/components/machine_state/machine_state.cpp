@@ -0,0 +1,45 @@
+/*
+  src/components/machine_state/machine_state.cpp - Snapshot State Lintas Task
+  Task kontrol dan task IO masing-masing memiliki state-nya sendiri (menu, fase seduh,
+  aktuator / sensor, UID RFID). Setelah setiap putaran scheduler, task pemilik menyalin
+  state itu ke SeqLock, dan task lain (jaringan, AsyncTCP) hanya membaca salinannya.
+  Pembaca tidak pernah melihat state setengah diperbarui dan penulis tidak pernah
+  menunggu pembaca.
+*/
+
+#include "machine_state.h"
+#include "components/rtos_tasks/seqlock.h"
+#include "components/telemetry/telemetry.h"
+#include "components/temperature_humidity/temperature_humidity.h"
+
+static SeqLock<ControlSnapshot> controlState;
+static SeqLock<SensorSnapshot> sensorState;
+
+void machine_state_publish_control() {
+  ControlSnapshot snapshot;
+  snapshot.brewPhase = currentBrewPhase;
+  snapshot.selectedMenu = selectedMenu;
+  snapshot.menuActive = menuActive;
+  snapshot.menuConfirmed = menuConfirmed;
+  memcpy(snapshot.actuatorSpeeds, actuatorSpeeds, sizeof(snapshot.actuatorSpeeds));
+  controlState.write(snapshot);
+}
+
+void machine_state_publish_sensors() {
+  SensorSnapshot snapshot;
+  snapshot.distance1 = telemetryDistance1;
+  snapshot.distance2 = telemetryDistance2;
+  snapshot.distance3 = telemetryDistance3;
+  snapshot.temperature = currentTemperature;
+  snapshot.humidity = currentHumidity;
+  memcpy(snapshot.rfidUid, currentRfidUid, RFID_UID_TEXT_LEN);
+  sensorState.write(snapshot);
+}
+
+ControlSnapshot machine_state_control() {
+  return controlState.read();
+}
+
+SensorSnapshot machine_state_sensors() {
+  return sensorState.read();
+}
@@ -0,0 +1,38 @@
+#ifndef MACHINE_STATE_H
+#define MACHINE_STATE_H
+
+#include <Arduino.h>
+#include "components/order_coffee/order_coffee.h"
+#include "components/motor_control/motor_control.h"
+#include "components/rfid_card_reader/rfid_card_reader.h"
+
+// --- Snapshot State Lintas Task ---
+// State milik task kontrol (ditulis hanya oleh task "control")
+struct ControlSnapshot {
+  BrewPhase brewPhase;
+  int selectedMenu;
+  bool menuActive;
+  bool menuConfirmed;
+  uint8_t actuatorSpeeds[ACT_COUNT];
+};
+
+// State milik task IO (ditulis hanya oleh loopTask)
+struct SensorSnapshot {
+  long distance1;
+  long distance2;
+  long distance3;
+  float temperature;
+  float humidity;
+  char rfidUid[RFID_UID_TEXT_LEN];
+};
+
+// --- Prototipe Fungsi Machine State ---
+// Publikasi dipanggil oleh task pemilik state setelah setiap putaran scheduler-nya
+void machine_state_publish_control();
+void machine_state_publish_sensors();
+
+// Aman dipanggil dari task mana pun (task jaringan, AsyncTCP, task IO)
+ControlSnapshot machine_state_control();
+SensorSnapshot machine_state_sensors();
+
+#endif // MACHINE_STATE_H
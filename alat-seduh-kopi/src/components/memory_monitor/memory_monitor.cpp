@@ -0,0 +1,159 @@
+/*
+  src/components/memory_monitor/memory_monitor.cpp - Pemantau Heap & Stack
+  Task "memory" (grup IO) mengambil sampel heap internal setiap detik: total bebas,
+  blok bebas terbesar, titik terendah sejak boot, dan sisa stack minimum task
+  control/network/io. Sampel dirangkum menjadi jendela min/max per menit di ring kecil,
+  sehingga kebocoran (heap turun terus antar jendela) dan fragmentasi (blok terbesar
+  menyusut walau total bebas tetap) terlihat dari dashboard sebelum alokasi gagal.
+
+  Fragmentasi yang melewati MEMORY_FRAG_ALERT_PCT dipublikasikan sebagai EVT_MEMORY
+  (dan sekali lagi saat pulih di bawah MEMORY_FRAG_CLEAR_PCT, agar tidak berkedip).
+  State ditulis hanya oleh task IO dan dibaca task jaringan lewat SeqLock.
+*/
+
+#include "memory_monitor.h"
+#include <esp_heap_caps.h>
+#include "components/scheduler/scheduler.h"
+#include "components/event_bus/event_bus.h"
+#include "components/logger/logger.h"
+#include "components/rtos_tasks/seqlock.h"
+
+// Task yang stack-nya dipantau (indeks = TaskRole)
+static const uint8_t MONITORED_TASK_COUNT = TASK_ROLE_OTHER;
+static const char* const MONITORED_TASK_NAMES[MONITORED_TASK_COUNT] = {"control", "network", "io"};
+
+struct MemoryState {
+  MemorySample latest;
+  bool fragmented;
+  uint32_t stackFree[MONITORED_TASK_COUNT]; // 0 = task belum berjalan
+  MemoryWindow history[MEMORY_HISTORY_SIZE];
+  uint8_t historyHead;                      // Jendela terbaru
+  uint8_t historyCount;
+};
+
+static MemoryState workingState;            // Hanya disentuh task "memory"
+static SeqLock<MemoryState> sharedState;
+static bool stackWarned[MONITORED_TASK_COUNT];
+
+static MemorySample takeSample() {
+  MemorySample sample;
+  sample.freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  sample.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  sample.minFreeHeap = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+  sample.fragmentationPct = sample.freeHeap > 0
+      ? (uint8_t)(100 - (uint64_t)sample.largestBlock * 100 / sample.freeHeap) : 0;
+  return sample;
+}
+
+// Memperbarui jendela terbaru, atau membuka jendela baru setiap MEMORY_WINDOW_MS
+static void recordWindow(const MemorySample& sample, unsigned long currentMillis) {
+  MemoryWindow* window = &workingState.history[workingState.historyHead];
+  if (workingState.historyCount == 0 || currentMillis - window->startMs >= MEMORY_WINDOW_MS) {
+    if (workingState.historyCount > 0) {
+      workingState.historyHead = (workingState.historyHead + 1) % MEMORY_HISTORY_SIZE;
+    }
+    if (workingState.historyCount < MEMORY_HISTORY_SIZE) workingState.historyCount++;
+    window = &workingState.history[workingState.historyHead];
+    window->startMs = currentMillis;
+    window->minFree = sample.freeHeap;
+    window->maxFree = sample.freeHeap;
+    window->minLargest = sample.largestBlock;
+    window->maxFragmentationPct = sample.fragmentationPct;
+    return;
+  }
+  if (sample.freeHeap < window->minFree) window->minFree = sample.freeHeap;
+  if (sample.freeHeap > window->maxFree) window->maxFree = sample.freeHeap;
+  if (sample.largestBlock < window->minLargest) window->minLargest = sample.largestBlock;
+  if (sample.fragmentationPct > window->maxFragmentationPct) window->maxFragmentationPct = sample.fragmentationPct;
+}
+
+static void sampleStacks() {
+  for (uint8_t role = 0; role < MONITORED_TASK_COUNT; role++) {
+    uint32_t bytes;
+    if (!rtos_task_stack_free((TaskRole)role, bytes)) continue;
+    workingState.stackFree[role] = bytes;
+    if (bytes < MEMORY_STACK_WARN_BYTES && !stackWarned[role]) {
+      stackWarned[role] = true; // High-water mark tidak pernah naik lagi, cukup sekali
+      LOG_WARN(LOG_MSG_MEMORY_STACK_LOW, MONITORED_TASK_NAMES[role], bytes);
+    }
+  }
+}
+
+// Event hanya saat melewati ambang, dengan histeresis antara ALERT & CLEAR
+static void checkFragmentation(const MemorySample& sample) {
+  if (!workingState.fragmented && sample.fragmentationPct >= MEMORY_FRAG_ALERT_PCT) {
+    workingState.fragmented = true;
+    LOG_WARN(LOG_MSG_MEMORY_FRAGMENTED, sample.fragmentationPct, sample.largestBlock, sample.freeHeap);
+    event_bus_publish(EVT_MEMORY, 1, sample.fragmentationPct);
+  } else if (workingState.fragmented && sample.fragmentationPct < MEMORY_FRAG_CLEAR_PCT) {
+    workingState.fragmented = false;
+    LOG_INFO(LOG_MSG_MEMORY_RECOVERED, sample.fragmentationPct);
+    event_bus_publish(EVT_MEMORY, 0, sample.fragmentationPct);
+  }
+}
+
+void setupMemoryMonitor() {
+  memset(&workingState, 0, sizeof(workingState));
+  memset(stackWarned, 0, sizeof(stackWarned));
+  handleMemoryMonitor(millis()); // Sampel pertama sebelum web server aktif
+  scheduler_add_periodic("memory", handleMemoryMonitor, MEMORY_SAMPLE_INTERVAL_MS, TASK_PRIORITY_LOW, SCHED_GROUP_IO);
+  Serial.println("[MEMORY] Pemantau heap & stack aktif.");
+}
+
+/**
+ * @brief Task "memory": satu sampel heap & stack, jendela riwayat, cek fragmentasi.
+ * Hanya membaca statistik allocator/FreeRTOS, tidak mengalokasikan apa pun.
+ */
+void handleMemoryMonitor(unsigned long currentMillis) {
+  MemorySample sample = takeSample();
+  workingState.latest = sample;
+  recordWindow(sample, currentMillis);
+  sampleStacks();
+  checkFragmentation(sample);
+  sharedState.write(workingState);
+}
+
+MemorySample memory_monitor_latest() {
+  return sharedState.read().latest;
+}
+
+bool memory_monitor_fragmented() {
+  return sharedState.read().fragmented;
+}
+
+void writeMemoryJson(JsonWriter& writer) {
+  MemoryState state = sharedState.read();
+  writer.beginObject()
+    .field("type", "memory")
+    .field("freeHeap", (unsigned long)state.latest.freeHeap)
+    .field("largestBlock", (unsigned long)state.latest.largestBlock)
+    .field("minFreeHeap", (unsigned long)state.latest.minFreeHeap)
+    .field("fragmentation", (int)state.latest.fragmentationPct)
+    .field("fragmented", state.fragmented);
+
+  writer.beginArray("stacks");
+  for (uint8_t role = 0; role < MONITORED_TASK_COUNT; role++) {
+    if (state.stackFree[role] == 0) continue;
+    writer.beginObject()
+      .field("task", MONITORED_TASK_NAMES[role])
+      .field("free", (unsigned long)state.stackFree[role])
+      .endObject();
+  }
+  writer.endArray();
+
+  // Riwayat dari jendela terlama ke terbaru
+  writer.beginArray("history");
+  for (uint8_t i = 0; i < state.historyCount; i++) {
+    uint8_t index = (state.historyHead + MEMORY_HISTORY_SIZE - state.historyCount + 1 + i) % MEMORY_HISTORY_SIZE;
+    const MemoryWindow& window = state.history[index];
+    writer.beginObject()
+      .field("t", (unsigned long)window.startMs)
+      .field("min", (unsigned long)window.minFree)
+      .field("max", (unsigned long)window.maxFree)
+      .field("largest", (unsigned long)window.minLargest)
+      .field("frag", (int)window.maxFragmentationPct)
+      .endObject();
+  }
+  writer.endArray();
+  writer.endObject();
+}
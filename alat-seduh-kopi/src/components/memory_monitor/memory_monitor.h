@@ -0,0 +1,46 @@
+#ifndef MEMORY_MONITOR_H
+#define MEMORY_MONITOR_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+#include "components/rtos_tasks/rtos_tasks.h"
+
+// --- Konfigurasi Memory Monitor ---
+#define MEMORY_SAMPLE_INTERVAL_MS 1000     // Periode task "memory" (grup IO)
+#define MEMORY_WINDOW_MS 60000             // Lebar satu jendela riwayat min/max
+#define MEMORY_HISTORY_SIZE 10             // Jumlah jendela riwayat (10 menit terakhir)
+#define MEMORY_FRAG_ALERT_PCT 50           // Event EVT_MEMORY saat fragmentasi mencapai ini
+#define MEMORY_FRAG_CLEAR_PCT 40           // ... dan event pulih setelah turun ke bawah ini
+#define MEMORY_STACK_WARN_BYTES 512        // Peringatan log jika sisa stack task di bawah ini
+#define MEMORY_JSON_BUFFER_SIZE 1024       // Buffer pesan "memory" (topik diagnostics)
+
+// Satu sampel heap (byte). Fragmentasi = 100 - blok terbesar / total bebas (persen).
+struct MemorySample {
+  uint32_t freeHeap;
+  uint32_t largestBlock;
+  uint32_t minFreeHeap;      // Titik terendah sejak boot (dari allocator)
+  uint8_t fragmentationPct;
+};
+
+// Min/max dalam satu jendela MEMORY_WINDOW_MS
+struct MemoryWindow {
+  uint32_t startMs;
+  uint32_t minFree;
+  uint32_t maxFree;
+  uint32_t minLargest;
+  uint8_t maxFragmentationPct;
+};
+
+// --- Prototipe Fungsi Memory Monitor ---
+// Mendaftarkan task "memory" dan mengambil sampel pertama
+void setupMemoryMonitor();
+void handleMemoryMonitor(unsigned long currentMillis);
+
+// Sampel terakhir; aman dibaca dari task mana pun (salinan konsisten)
+MemorySample memory_monitor_latest();
+bool memory_monitor_fragmented();
+
+// Pesan {"type":"memory"}: sampel terakhir, sisa stack per task & riwayat jendela
+void writeMemoryJson(JsonWriter& writer);
+
+#endif // MEMORY_MONITOR_H
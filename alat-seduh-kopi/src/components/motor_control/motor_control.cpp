@@ -1,5 +1,8 @@
 #include "motor_control.h"
 #include <Wire.h> // Diperlukan untuk komunikasi I2C
+#include "components/hal/hal.h" // Pin EN (PWM) & relay pompa lewat HAL
+#include "components/i2c_bus/i2c_bus.h"
+#include "components/logger/logger.h"
 
 // Definisi Objek PCF8574
 Adafruit_PCF8574 pcf;
@@ -16,6 +19,43 @@ bool motorStorage1Active = false;
 bool motorStorage2Active = false;
 bool motorStorage3Active = false;
 
+// Speed terakhir setiap aktuator, dipakai untuk snapshot state ke klien web
+uint8_t actuatorSpeeds[ACT_COUNT] = {0};
+
+// Nama aktuator (indeks = ActuatorId)
+static const char* const ACTUATOR_NAMES[ACT_COUNT] = {
+    "Storage 1",
+    "Storage 2",
+    "Storage 3",
+    "Mixer",
+    "Pompa Galon",
+    "Pompa Air Panas",
+    "Seduh Kopi"
+};
+
+const char* actuatorName(ActuatorId actuator) {
+    if (actuator >= ACT_COUNT) return "Unknown";
+    return ACTUATOR_NAMES[actuator];
+}
+
+// Simpan, catat & publikasikan perubahan state aktuator ke event bus
+static void publishActuatorState(ActuatorId actuator, int speed) {
+    actuatorSpeeds[actuator] = (uint8_t)speed;
+    if (speed > 0) {
+        LOG_INFO(LOG_MSG_ACTUATOR_ON, actuatorName(actuator), speed);
+    } else {
+        LOG_INFO(LOG_MSG_ACTUATOR_OFF, actuatorName(actuator));
+    }
+    event_bus_publish(EVT_ACTUATOR, actuator, speed, actuatorName(actuator));
+}
+
+// Menulis pasangan pin arah IN1/IN2 dalam satu transaksi I2C berprioritas tertinggi
+static void writeMotorDirection(uint8_t in1Pin, uint8_t in1State, uint8_t in2Pin, uint8_t in2State) {
+    I2cTransaction transaction(I2C_DEV_MOTOR);
+    transaction.check(pcf.digitalWrite(in1Pin, in1State));
+    transaction.check(pcf.digitalWrite(in2Pin, in2State));
+}
+
 /**
  * @brief Menginisialisasi pin-pin kontrol motor pada PCF8574 dan GPIO.
  * @param pcf_address Alamat I2C PCF8574 yang digunakan untuk motor control.
@@ -27,7 +67,7 @@ void setupMotorControl(uint8_t pcf_address) {
     Serial.println(" - Motor Control)... ");
 
     if (!pcf.begin(pcf_address, &Wire)) {
-        Serial.println("[MOTOR_CONTROL] FATAL ERROR: PCF8574 (0x" + String(pcf_address, HEX) + ") TIDAK DITEMUKAN. Cek alamat & koneksi!");
+        Serial.printf("[MOTOR_CONTROL] FATAL ERROR: PCF8574 (0x%02x) TIDAK DITEMUKAN. Cek alamat & koneksi!\n", pcf_address);
         while (true); // Hentikan program jika PCF8574 tidak ditemukan (fatal)
     }
     Serial.println("[MOTOR_CONTROL] PCF8574 (Motor Control) OK!");
@@ -37,51 +77,47 @@ void setupMotorControl(uint8_t pcf_address) {
     // LM298N #1 (Storage 2 & 3)
     pcf.pinMode(MOTOR_STORAGE_2_IN1_PIN, OUTPUT);
     pcf.pinMode(MOTOR_STORAGE_2_IN2_PIN, OUTPUT);
-    pcf.digitalWrite(MOTOR_STORAGE_2_IN1_PIN, LOW);
-    pcf.digitalWrite(MOTOR_STORAGE_2_IN2_PIN, LOW);
+    writeMotorDirection(MOTOR_STORAGE_2_IN1_PIN, LOW, MOTOR_STORAGE_2_IN2_PIN, LOW);
 
     pcf.pinMode(MOTOR_STORAGE_3_IN1_PIN, OUTPUT);
     pcf.pinMode(MOTOR_STORAGE_3_IN2_PIN, OUTPUT);
-    pcf.digitalWrite(MOTOR_STORAGE_3_IN1_PIN, LOW);
-    pcf.digitalWrite(MOTOR_STORAGE_3_IN2_PIN, LOW);
+    writeMotorDirection(MOTOR_STORAGE_3_IN1_PIN, LOW, MOTOR_STORAGE_3_IN2_PIN, LOW);
 
     // LM298N #2 (Storage 1 & Mixer)
     pcf.pinMode(MOTOR_STORAGE_1_IN1_PIN, OUTPUT);
     pcf.pinMode(MOTOR_STORAGE_1_IN2_PIN, OUTPUT);
-    pcf.digitalWrite(MOTOR_STORAGE_1_IN1_PIN, LOW);
-    pcf.digitalWrite(MOTOR_STORAGE_1_IN2_PIN, LOW);
+    writeMotorDirection(MOTOR_STORAGE_1_IN1_PIN, LOW, MOTOR_STORAGE_1_IN2_PIN, LOW);
 
     pcf.pinMode(MOTOR_MIXER_IN1_PIN, OUTPUT);
     pcf.pinMode(MOTOR_MIXER_IN2_PIN, OUTPUT);
-    pcf.digitalWrite(MOTOR_MIXER_IN1_PIN, LOW);
-    pcf.digitalWrite(MOTOR_MIXER_IN2_PIN, LOW);
+    writeMotorDirection(MOTOR_MIXER_IN1_PIN, LOW, MOTOR_MIXER_IN2_PIN, LOW);
     Serial.println("[MOTOR_CONTROL] Pin motor dinamo dikonfigurasi.");
 
     // --- Pin Setup untuk ENA/ENB LM298N (langsung ke GPIO ESP32) ---
     Serial.println("[MOTOR_CONTROL] Mengatur pin ENA/ENB LM298N via GPIO...");
-    pinMode(LM298N1_ENA_PIN, OUTPUT);
-    digitalWrite(LM298N1_ENA_PIN, LOW); // Pastikan OFF di awal
-    pinMode(LM298N1_ENB_PIN, OUTPUT);
-    digitalWrite(LM298N1_ENB_PIN, LOW); // Pastikan OFF di awal
-
-    pinMode(LM298N2_ENA_PIN, OUTPUT);
-    digitalWrite(LM298N2_ENA_PIN, LOW); // Pastikan OFF di awal
-    pinMode(LM298N2_ENB_PIN, OUTPUT);
-    digitalWrite(LM298N2_ENB_PIN, LOW); // Pastikan OFF di awal
+    hal_gpio_mode(LM298N1_ENA_PIN, OUTPUT);
+    hal_gpio_write(LM298N1_ENA_PIN, LOW); // Pastikan OFF di awal
+    hal_gpio_mode(LM298N1_ENB_PIN, OUTPUT);
+    hal_gpio_write(LM298N1_ENB_PIN, LOW); // Pastikan OFF di awal
+
+    hal_gpio_mode(LM298N2_ENA_PIN, OUTPUT);
+    hal_gpio_write(LM298N2_ENA_PIN, LOW); // Pastikan OFF di awal
+    hal_gpio_mode(LM298N2_ENB_PIN, OUTPUT);
+    hal_gpio_write(LM298N2_ENB_PIN, LOW); // Pastikan OFF di awal
     Serial.println("[MOTOR_CONTROL] Pin ENA/ENB LM298N dikonfigurasi.");
 
     // --- Pin Setup untuk Motor Pump (Relay langsung ke GPIO ESP32) ---
     Serial.println("[MOTOR_CONTROL] Mengatur pin pompa (relay) via GPIO...");
-    pinMode(MOTOR_PUMP_GALON_RELAY_PIN, OUTPUT);
-    digitalWrite(MOTOR_PUMP_GALON_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
+    hal_gpio_mode(MOTOR_PUMP_GALON_RELAY_PIN, OUTPUT);
+    hal_gpio_write(MOTOR_PUMP_GALON_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
     motorPumpGalonActive = false; // Inisialisasi status
 
-    pinMode(MOTOR_PUMP_HOT_WATER_RELAY_PIN, OUTPUT);
-    digitalWrite(MOTOR_PUMP_HOT_WATER_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
+    hal_gpio_mode(MOTOR_PUMP_HOT_WATER_RELAY_PIN, OUTPUT);
+    hal_gpio_write(MOTOR_PUMP_HOT_WATER_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
     motorPumpHotWaterActive = false; // Inisialisasi status
 
-    pinMode(MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN, OUTPUT);
-    digitalWrite(MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
+    hal_gpio_mode(MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN, OUTPUT);
+    hal_gpio_write(MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
     motorPumpSeduhKopiActive = false; // Inisialisasi status
     Serial.println("[MOTOR_CONTROL] Pin pompa dikonfigurasi.");
 
@@ -94,110 +130,102 @@ void setupMotorControl(uint8_t pcf_address) {
 // Motor Storage 1 (LM298N #2, ENA: GPIO17)
 void motor_storage_1_start(int speed) {
     speed = constrain(speed, 0, 255); // Pastikan speed dalam rentang 0-255
-    Serial.println("[MOTOR_CONTROL] Motor Storage 1 START (Speed: " + String(speed) + ") [ENA: GPIO17]");
-    pcf.digitalWrite(MOTOR_STORAGE_1_IN1_PIN, HIGH);
-    pcf.digitalWrite(MOTOR_STORAGE_1_IN2_PIN, LOW);
-    analogWrite(LM298N2_ENA_PIN, speed); // Kontrol kecepatan via ENA
+    writeMotorDirection(MOTOR_STORAGE_1_IN1_PIN, HIGH, MOTOR_STORAGE_1_IN2_PIN, LOW);
+    hal_pwm_write(LM298N2_ENA_PIN, speed); // Kontrol kecepatan via ENA
     motorStorage1Active = true; // Update status
+    publishActuatorState(ACT_STORAGE_1, speed);
 }
 
 void motor_storage_1_stop() {
-    Serial.println("[MOTOR_CONTROL] Motor Storage 1 STOP");
-    pcf.digitalWrite(MOTOR_STORAGE_1_IN1_PIN, LOW);
-    pcf.digitalWrite(MOTOR_STORAGE_1_IN2_PIN, LOW);
-    analogWrite(LM298N2_ENA_PIN, 0); // Matikan motor via ENA
+    writeMotorDirection(MOTOR_STORAGE_1_IN1_PIN, LOW, MOTOR_STORAGE_1_IN2_PIN, LOW);
+    hal_pwm_write(LM298N2_ENA_PIN, 0); // Matikan motor via ENA
     motorStorage1Active = false; // Update status
+    publishActuatorState(ACT_STORAGE_1, 0);
 }
 
 // Motor Storage 2 (LM298N #1, ENA: GPIO4)
 void motor_storage_2_start(int speed) {
     speed = constrain(speed, 0, 255);
-    Serial.println("[MOTOR_CONTROL] Motor Storage 2 START (Speed: " + String(speed) + ") [ENA: GPIO4]");
-    pcf.digitalWrite(MOTOR_STORAGE_2_IN1_PIN, HIGH);
-    pcf.digitalWrite(MOTOR_STORAGE_2_IN2_PIN, LOW);
-    analogWrite(LM298N1_ENA_PIN, speed); // Kontrol kecepatan via ENA
+    writeMotorDirection(MOTOR_STORAGE_2_IN1_PIN, HIGH, MOTOR_STORAGE_2_IN2_PIN, LOW);
+    hal_pwm_write(LM298N1_ENA_PIN, speed); // Kontrol kecepatan via ENA
     motorStorage2Active = true; // Update status
+    publishActuatorState(ACT_STORAGE_2, speed);
 }
 
 void motor_storage_2_stop() {
-    Serial.println("[MOTOR_CONTROL] Motor Storage 2 STOP");
-    pcf.digitalWrite(MOTOR_STORAGE_2_IN1_PIN, LOW);
-    pcf.digitalWrite(MOTOR_STORAGE_2_IN2_PIN, LOW);
-    analogWrite(LM298N1_ENA_PIN, 0); // Matikan motor via ENA
+    writeMotorDirection(MOTOR_STORAGE_2_IN1_PIN, LOW, MOTOR_STORAGE_2_IN2_PIN, LOW);
+    hal_pwm_write(LM298N1_ENA_PIN, 0); // Matikan motor via ENA
     motorStorage2Active = false; // Update status
+    publishActuatorState(ACT_STORAGE_2, 0);
 }
 
 // Motor Storage 3 (LM298N #1, ENB: GPIO16)
 void motor_storage_3_start(int speed) {
     speed = constrain(speed, 0, 255);
-    Serial.println("[MOTOR_CONTROL] Motor Storage 3 START (Speed: " + String(speed) + ") [ENB: GPIO16]");
-    pcf.digitalWrite(MOTOR_STORAGE_3_IN1_PIN, HIGH);
-    pcf.digitalWrite(MOTOR_STORAGE_3_IN2_PIN, LOW);
-    analogWrite(LM298N1_ENB_PIN, speed); // Kontrol kecepatan via ENB
+    writeMotorDirection(MOTOR_STORAGE_3_IN1_PIN, HIGH, MOTOR_STORAGE_3_IN2_PIN, LOW);
+    hal_pwm_write(LM298N1_ENB_PIN, speed); // Kontrol kecepatan via ENB
     motorStorage3Active = true; // Update status
+    publishActuatorState(ACT_STORAGE_3, speed);
 }
 
 void motor_storage_3_stop() {
-    Serial.println("[MOTOR_CONTROL] Motor Storage 3 STOP");
-    pcf.digitalWrite(MOTOR_STORAGE_3_IN1_PIN, LOW);
-    pcf.digitalWrite(MOTOR_STORAGE_3_IN2_PIN, LOW);
-    analogWrite(LM298N1_ENB_PIN, 0); // Matikan motor via ENB
+    writeMotorDirection(MOTOR_STORAGE_3_IN1_PIN, LOW, MOTOR_STORAGE_3_IN2_PIN, LOW);
+    hal_pwm_write(LM298N1_ENB_PIN, 0); // Matikan motor via ENB
     motorStorage3Active = false; // Update status
+    publishActuatorState(ACT_STORAGE_3, 0);
 }
 
 // Motor Mixer (LM298N #2, ENB: GPIO12)
 void motor_mixer_start(int speed) {
     speed = constrain(speed, 0, 200);
-    Serial.println("[MOTOR_CONTROL] Motor Mixer START (Speed: " + String(speed) + ") [ENB: GPIO12]");
-    pcf.digitalWrite(MOTOR_MIXER_IN1_PIN, HIGH);
-    pcf.digitalWrite(MOTOR_MIXER_IN2_PIN, LOW);
-    analogWrite(LM298N2_ENB_PIN, speed); // Kontrol kecepatan via ENB
+    writeMotorDirection(MOTOR_MIXER_IN1_PIN, HIGH, MOTOR_MIXER_IN2_PIN, LOW);
+    hal_pwm_write(LM298N2_ENB_PIN, speed); // Kontrol kecepatan via ENB
     motorMixerActive = true; // Update status
+    publishActuatorState(ACT_MIXER, speed);
 }
 
 void motor_mixer_stop() {
-    Serial.println("[MOTOR_CONTROL] Motor Mixer STOP");
-    pcf.digitalWrite(MOTOR_MIXER_IN1_PIN, LOW);
-    pcf.digitalWrite(MOTOR_MIXER_IN2_PIN, LOW);
-    analogWrite(LM298N2_ENB_PIN, 0); // Matikan motor via ENB
+    writeMotorDirection(MOTOR_MIXER_IN1_PIN, LOW, MOTOR_MIXER_IN2_PIN, LOW);
+    hal_pwm_write(LM298N2_ENB_PIN, 0); // Matikan motor via ENB
     motorMixerActive = false; // Update status
+    publishActuatorState(ACT_MIXER, 0);
 }
 
 // --- Implementasi Fungsi Kontrol Motor Pump (Relay langsung ke GPIO) ---
 void motor_pump_galon_start() {
-    Serial.println("[MOTOR_CONTROL] Pompa Galon ON (GPIO32)");
-    digitalWrite(MOTOR_PUMP_GALON_RELAY_PIN, LOW); // Asumsi LOW = ON untuk relay
+    hal_gpio_write(MOTOR_PUMP_GALON_RELAY_PIN, LOW); // Asumsi LOW = ON untuk relay
     motorPumpGalonActive = true; // Update status
+    publishActuatorState(ACT_PUMP_GALON, 255);
 }
 
 void motor_pump_galon_stop() {
-    Serial.println("[MOTOR_CONTROL] Pompa Galon OFF (GPIO32)");
-    digitalWrite(MOTOR_PUMP_GALON_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
+    hal_gpio_write(MOTOR_PUMP_GALON_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
     motorPumpGalonActive = false; // Update status
+    publishActuatorState(ACT_PUMP_GALON, 0);
 }
 
 void motor_pump_hot_water_start() {
-    Serial.println("[MOTOR_CONTROL] Pompa Air Panas ON (GPIO25)");
-    digitalWrite(MOTOR_PUMP_HOT_WATER_RELAY_PIN, LOW); // Asumsi LOW = ON untuk relay
+    hal_gpio_write(MOTOR_PUMP_HOT_WATER_RELAY_PIN, LOW); // Asumsi LOW = ON untuk relay
     motorPumpHotWaterActive = true; // Update status
+    publishActuatorState(ACT_PUMP_HOT_WATER, 255);
 }
 
 void motor_pump_hot_water_stop() {
-    Serial.println("[MOTOR_CONTROL] Pompa Air Panas OFF (GPIO25)");
-    digitalWrite(MOTOR_PUMP_HOT_WATER_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
+    hal_gpio_write(MOTOR_PUMP_HOT_WATER_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
     motorPumpHotWaterActive = false; // Update status
+    publishActuatorState(ACT_PUMP_HOT_WATER, 0);
 }
 
 void motor_pump_seduh_kopi_start() {
-    Serial.println("[MOTOR_CONTROL] Selenoid Seduh Kopi ON (GPIO33)");
-    digitalWrite(MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN, LOW); // Asumsi LOW = ON untuk relay
+    hal_gpio_write(MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN, LOW); // Asumsi LOW = ON untuk relay
     motorPumpSeduhKopiActive = true; // Update status
+    publishActuatorState(ACT_PUMP_SEDUH_KOPI, 255);
 }
 
 void motor_pump_seduh_kopi_stop() {
-    Serial.println("[MOTOR_CONTROL] Selenoid Seduh Kopi OFF (GPIO33)");
-    digitalWrite(MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
+    hal_gpio_write(MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN, HIGH); // Asumsi HIGH = OFF untuk relay
     motorPumpSeduhKopiActive = false; // Update status
+    publishActuatorState(ACT_PUMP_SEDUH_KOPI, 0);
 }
 
 void motor_all_stop() {
@@ -208,5 +236,5 @@ void motor_all_stop() {
     motor_pump_galon_stop();
     motor_pump_hot_water_stop();
     motor_pump_seduh_kopi_stop();
-    Serial.println("[MotorControl] Semua motor dan pompa dihentikan.");
+    LOG_INFO(LOG_MSG_ACTUATORS_STOPPED);
 }
\ No newline at end of file
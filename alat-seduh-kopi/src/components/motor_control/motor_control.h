@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include <Adafruit_PCF8574.h> // Asumsi menggunakan Adafruit_PCF8574 untuk motor control
+#include "components/event_bus/event_bus.h" // Untuk publikasi event ON/OFF aktuator
 
 // --- Definisi Pin Motor pada PCF8574 (0x20) ---
 // PCF8574 (0x20) & LM298N #1
@@ -27,6 +28,18 @@
 #define MOTOR_PUMP_HOT_WATER_RELAY_PIN 33  // IN2 - Pompa Air Panas - Water Heater
 #define MOTOR_PUMP_SEDUH_KOPI_RELAY_PIN 32 // IN4 - Pompa Air Seduh Kopi
 
+// --- Identitas Aktuator (dipakai sebagai id pada event EVT_ACTUATOR) ---
+enum ActuatorId : uint8_t {
+  ACT_STORAGE_1 = 0,     // Motor storage 1 (Torabika)
+  ACT_STORAGE_2,         // Motor storage 2 (Good Day)
+  ACT_STORAGE_3,         // Motor storage 3 (ABC Susu)
+  ACT_MIXER,             // Motor mixer
+  ACT_PUMP_GALON,        // Pompa air galon
+  ACT_PUMP_HOT_WATER,    // Pompa air panas
+  ACT_PUMP_SEDUH_KOPI,   // Selenoid seduh kopi
+  ACT_COUNT
+};
+
 // --- Deklarasi Objek PCF8574 sebagai extern ---
 extern Adafruit_PCF8574 pcf; // Objek PCF8574 global untuk motor control
 
@@ -44,6 +57,12 @@ extern bool pumpSeduhKopiIsActive; // Tambahan: status selenoid seduh kopi
 // Fungsi inisialisasi motor control
 void setupMotorControl(uint8_t pcf_address);
 
+// Nama aktuator untuk logging dan tampilan web
+const char* actuatorName(ActuatorId actuator);
+
+// Speed terakhir setiap aktuator (0 = OFF, pompa relay = 255 saat ON)
+extern uint8_t actuatorSpeeds[ACT_COUNT];
+
 // Fungsi untuk mengontrol motor storage 1 (terhubung ke LM298N #2)
 void motor_storage_1_start(int speed = 255); // Ditambah parameter speed, default full speed
 void motor_storage_1_stop();
@@ -72,4 +91,7 @@ void motor_pump_hot_water_stop();
 void motor_pump_seduh_kopi_start();
 void motor_pump_seduh_kopi_stop();
 
+// Menghentikan semua motor dan pompa
+void motor_all_stop();
+
 #endif // MOTOR_CONTROL_H
\ No newline at end of file
@@ -2,23 +2,36 @@
   src/components/order_coffee/order_coffee.cpp - Implementasi Komponen Order Kopi
   Mengelola input Push Button, output LED pada PCF8574 kedua (0x21),
   serta seluruh logika pemilihan dan pemrosesan menu kopi.
+  Panel depan dipoll oleh task scheduler "order", dan proses seduh dijalankan
+  sebagai rangkaian task one-shot "brew" (satu task per langkah) tanpa delay().
+  Semua fungsi di modul ini berjalan di task kontrol (grup SCHED_GROUP_CONTROL),
+  kecuali requestCoffeeOrder/requestCoffeeCancel/getOrderQueue yang dipanggil dari
+  task AsyncTCP. Tampilan LCD tidak ditulis langsung, melainkan diantrekan ke
+  task "lcd" (lcd_post_*).
 */
 
 #include "order_coffee.h"
-#include <Wire.h>
-#include <Arduino.h>
+#include "components/hal/hal.h"
 #include "components/lcd_display/lcd_display.h"
 #include "components/motor_control/motor_control.h"
 #include "components/rfid_card_reader/rfid_card_reader.h"
+#include "components/scheduler/scheduler.h"
+#include "components/machine_state/machine_state.h"
+#include "components/perf_probe/perf_probe.h"
+#include "components/i2c_bus/i2c_bus.h"
+#include "components/logger/logger.h"
+#include "port_debouncer.h"
+
+// --- Port PCF8574 Front Panel (0x21) ---
+// PCF8574 tidak punya register arah: pin input harus ditulis HIGH agar bisa dibaca.
+// Nilai output disimpan di shadow register sehingga state LED tidak perlu dibaca dari
+// bus, dan tombol hanya dibaca (satu byte untuk 8 pin) saat INT menandakan perubahan.
+static const uint8_t FP_BUTTON_MASK = (1 << FP_PB1_PIN) | (1 << FP_PB2_PIN) | (1 << FP_PB3_PIN) | (1 << FP_PB4_PIN);
+static const uint8_t FP_LED_MASK = (1 << FP_LED1_PIN) | (1 << FP_LED2_PIN);
+static uint8_t panelOutputShadow = 0xFF; // Semua HIGH: input terbaca & LED mati (common anode)
+static uint8_t panelInputs = 0;          // Pembacaan port terakhir (bit tombol saja)
+static volatile bool panelInterruptPending = false; // Diset ISR INT, dihapus sebelum port dibaca
 
-// --- Definisi Objek PCF8574 Kedua ---
-Adafruit_PCF8574 pcf2;
-
-// --- Definisi Variabel Global untuk Debounce ---
-unsigned long lastDebounceTime[4] = {0};
-unsigned long debounceDelay = 50;
-int lastButtonState[4] = {LOW, LOW, LOW, LOW};
-int currentButtonState[4] = {LOW, LOW, LOW, LOW};
 
 // --- Definisi Variabel Global untuk Logika Menu Kopi ---
 int selectedMenu = 0; // 0=none, 1=Torabika, 2=Good Day, 3=ABC Susu
@@ -34,18 +47,124 @@ bool blinkingStoppedMessagePrinted = false; // Untuk mencegah pesan berulang
 // --- Variabel Global untuk Mode Menu RFID ---
 bool rfidMenuMode = false; // True jika menu diaktifkan melalui RFID
 
+// --- Resep Seduh Default (sesuai durasi proses sebelumnya) ---
+// Diubah dari task AsyncTCP (perintah "recipe") dan disalin task kontrol saat seduhan
+// dimulai, jadi hanya diakses lewat getBrewRecipe()/setBrewRecipe() di bawah brewRecipeMux.
+// { galon, panas, air panas, tuang, speed tuang, speed mixer, mixing, seduh }
+static BrewRecipe brewRecipes[COFFEE_MENU_COUNT + 1] = {
+    {0,    0,     0,     0,    0,   0,   0,    0},     // 0: tidak dipakai
+    {6500, 16000, 10000, 4000, 250, 150, 7000, 10000}, // 1: Torabika
+    {6500, 16000, 10000, 4000, 250, 150, 7000, 10000}, // 2: Good Day
+    {6500, 16000, 10000, 4000, 250, 150, 7000, 10000}  // 3: ABC Susu
+};
+unsigned long coffeeOrdersServed[COFFEE_MENU_COUNT + 1] = {0};
+
+// --- Permintaan dari Klien Web (ditulis oleh task AsyncTCP) ---
+// Antrean pesanan berukuran tetap (ring buffer), dilindungi orderQueueMux karena
+// ditulis dari task AsyncTCP (WebSocket/REST) dan dibaca dari task kontrol.
+static QueuedOrder orderQueue[ORDER_QUEUE_SIZE];
+static uint8_t orderQueueHead = 0;   // Indeks pesanan terdepan
+static uint8_t orderQueueCount = 0;
+static uint32_t nextOrderTicket = 1; // Nomor tiket berikutnya (0 = ditolak)
+static portMUX_TYPE orderQueueMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool remoteCancelRequested = false;
+static portMUX_TYPE brewRecipeMux = portMUX_INITIALIZER_UNLOCKED;
+
+// --- Variabel Global untuk Fase Proses Seduh ---
+BrewPhase currentBrewPhase = BREW_IDLE;
+
+// --- Langkah Proses Seduh (task one-shot berantai) ---
+// Setiap langkah menyalakan/mematikan aktuator lalu menjadwalkan langkah berikutnya
+// setelah durasi resep, menggantikan rangkaian delay() yang dulu memblokir loop().
+enum BrewStep : uint8_t {
+  STEP_FILL_WATER = 0,  // Pompa galon ON
+  STEP_HEAT,            // Pompa galon OFF, tunggu air panas
+  STEP_HOT_WATER,       // Pompa air panas & mixer ON
+  STEP_HOT_WATER_STOP,  // Pompa air panas OFF, jeda sebelum menuang bubuk
+  STEP_DISPENSE,        // Motor storage sesuai menu ON
+  STEP_MIX,             // Motor storage OFF, mixing
+  STEP_POUR,            // Mixer OFF, selenoid seduh kopi ON
+  STEP_DONE,            // Selenoid OFF, kopi siap
+  STEP_RESET            // Kembali ke idle setelah pesan "Siap" ditampilkan
+};
+static BrewStep nextBrewStep = STEP_FILL_WATER;
+// Salinan resep saat seduhan dimulai. brewRecipes bisa diubah dari task AsyncTCP
+// (perintah "setRecipe"), jadi perubahan baru berlaku untuk seduhan berikutnya.
+static BrewRecipe activeRecipe;
+static const unsigned long BREW_SETTLE_MS = 1000;       // Jeda setelah pompa air panas berhenti
+static const unsigned long BREW_DONE_DISPLAY_MS = 5000; // Lama pesan "Kopi Siap" sebelum reset
+static const unsigned long ORDER_POLL_INTERVAL_MS = 10; // Periode polling panel depan
+
+// --- Debounce Tombol Front Panel ---
+// Satu sampel port per putaran task "order": debounce 4 sampel (40 ms), timer gestur dalam sampel
+static PortDebouncer panelButtons(FP_BUTTON_MASK,
+                                  PANEL_LONG_PRESS_MS / ORDER_POLL_INTERVAL_MS,
+                                  PANEL_DOUBLE_PRESS_MS / ORDER_POLL_INTERVAL_MS);
+// Nama menu untuk log (indeks = selectedMenu)
+static const char* const COFFEE_MENU_NAMES[COFFEE_MENU_COUNT + 1] = {"-", "Torabika", "Good Day", "ABC Susu"};
+
+// Nama fase seduh (indeks = BrewPhase)
+static const char* const BREW_PHASE_NAMES[BREW_PHASE_COUNT] = {
+    "Idle",
+    "Pilih Menu",
+    "Isi Air",
+    "Memanaskan",
+    "Air Panas",
+    "Tuang Kopi",
+    "Mengaduk",
+    "Seduh",
+    "Siap"
+};
+
+const char* brewPhaseName(BrewPhase phase) {
+    if (phase >= BREW_PHASE_COUNT) return "Unknown";
+    return BREW_PHASE_NAMES[phase];
+}
+
+// --- Implementasi Fungsi setBrewPhase ---
+// Hanya mempublikasikan event jika fase benar-benar berubah
+void setBrewPhase(BrewPhase phase) {
+    if (phase == currentBrewPhase) return;
+    currentBrewPhase = phase;
+    LOG_INFO(LOG_MSG_BREW_PHASE, brewPhaseName(phase));
+    event_bus_publish(EVT_BREW_PHASE, 0, phase, brewPhaseName(phase));
+}
+
 // --- Fungsi Baru: Menampilkan Tampilan Menu Idle/Awal ---
 void displayIdleMenu() {
-    Serial.println("[LCD] Menampilkan menu idle...");
-    lcd.clear();
-    lcd.setCursor(0, 0);
-    lcd.print("Coffee WD           "); // Baris 0
-    lcd.setCursor(0, 1);
-    lcd.print("                    "); // Baris 1 dikosongkan
-    lcd.setCursor(0, 2);
-    lcd.print("Silahkan Tap Kartu  "); // Baris 2
-    lcd.setCursor(0, 3);
-    lcd.print("                    "); // Baris 3 dikosongkan
+    LOG_INFO(LOG_MSG_IDLE_MENU);
+    lcd_post_clear();
+    lcd_post_text(0, 0, "Coffee WD           "); // Baris 0
+    lcd_post_text(0, 1, "                    "); // Baris 1 dikosongkan
+    lcd_post_text(0, 2, "Silahkan Tap Kartu  "); // Baris 2
+    lcd_post_text(0, 3, "                    "); // Baris 3 dikosongkan
+}
+
+// INT bisa kembali HIGH sendiri jika input kembali ke nilai sebelumnya sebelum port
+// dibaca, sehingga tepi turun dicatat di ISR dan tidak hanya mengandalkan level pin.
+static void IRAM_ATTR onPanelInterrupt() {
+    panelInterruptPending = true;
+}
+
+static bool writePanelPort() {
+    return i2c_bus_write(I2C_DEV_FRONT_PANEL, &panelOutputShadow, 1);
+}
+
+// Satu pembacaan I2C untuk seluruh 8 pin; sekaligus menghapus INT di PCF8574
+static void readPanelPort() {
+    panelInterruptPending = false; // Dihapus dulu agar perubahan selama pembacaan tidak hilang
+    uint8_t port;
+    if (i2c_bus_read(I2C_DEV_FRONT_PANEL, &port, 1)) {
+        panelInputs = port & FP_BUTTON_MASK;
+    }
+}
+
+// Menulis kedua LED front panel dalam satu transaksi I2C, hanya jika shadow berubah
+static void writePanelLeds(uint8_t state) {
+    uint8_t next = state ? (panelOutputShadow | FP_LED_MASK) : (panelOutputShadow & ~FP_LED_MASK);
+    if (next == panelOutputShadow) return;
+    panelOutputShadow = next;
+    writePanelPort();
 }
 
 // --- Implementasi Fungsi setupOrderCoffee ---
@@ -55,51 +174,52 @@ void setupOrderCoffee(uint8_t pcf2_address) {
     Serial.print(pcf2_address, HEX);
     Serial.println(" - Order Coffee Front Panel)... ");
 
-    if (!pcf2.begin(pcf2_address, &Wire)) {
-        Serial.println("[OrderCoffee] FATAL ERROR: PCF8574 (0x" + String(pcf2_address, HEX) + ") TIDAK DITEMUKAN. Cek alamat & koneksi!");
+    // Tulis semua pin HIGH: tombol menjadi input & LED mati (HIGH untuk Common Anode).
+    // Alamat perangkat diambil dari tabel modul 'i2c_bus' (I2C_FRONT_PANEL_ADDRESS).
+    panelOutputShadow = 0xFF;
+    if (!writePanelPort()) {
+        Serial.printf("[OrderCoffee] FATAL ERROR: PCF8574 (0x%02x) TIDAK DITEMUKAN. Cek alamat & koneksi!\n", pcf2_address);
         while(true); // Hentikan eksekusi jika PCF8574 tidak ditemukan
     }
     Serial.println("[OrderCoffee] PCF8574 (Order Coffee Front Panel) OK!");
 
-    // Set pinmode untuk Push Button (Input)
-    pcf2.pinMode(FP_PB1_PIN, INPUT);
-    pcf2.pinMode(FP_PB2_PIN, INPUT);
-    pcf2.pinMode(FP_PB3_PIN, INPUT);
-    pcf2.pinMode(FP_PB4_PIN, INPUT);
-
-    // Set pinmode untuk LED (Output)
-    pcf2.pinMode(FP_LED1_PIN, OUTPUT);
-    pcf2.pinMode(FP_LED2_PIN, OUTPUT);
+    // INT PCF8574 -> GPIO. Port dibaca sekali di awal untuk state awal tombol & menghapus INT.
+    hal_gpio_mode(FP_INT_PIN, INPUT);
+    hal_gpio_attach_interrupt(FP_INT_PIN, onPanelInterrupt, FALLING);
+    readPanelPort();
+    panelButtons.reset(panelInputs);
+    Serial.printf("[OrderCoffee] Order Coffee Front Panel pins configured (INT di GPIO%d).\n", FP_INT_PIN);
 
-    // Matikan semua LED di awal (HIGH untuk Common Anode)
-    pcf2.digitalWrite(FP_LED1_PIN, HIGH);
-    pcf2.digitalWrite(FP_LED2_PIN, HIGH);
-    Serial.println("[OrderCoffee] Order Coffee Front Panel pins configured.");
+    scheduler_add_periodic("order", handleOrderCoffee, ORDER_POLL_INTERVAL_MS, TASK_PRIORITY_HIGH, SCHED_GROUP_CONTROL);
 }
 
-// --- Implementasi Fungsi readPushButton ---
-bool readPushButton(int buttonPin, int buttonIndex) {
-    int reading = pcf2.digitalRead(buttonPin);
+uint8_t panelButtonState() {
+    return panelButtons.state();
+}
 
-    // Jika terjadi perubahan state, reset timer debounce
-    if (reading != lastButtonState[buttonIndex]) {
-        lastDebounceTime[buttonIndex] = millis();
+// Log & event untuk setiap tombol pada satu bitmask event (pin PB1..PB4 = index 0..3)
+static void publishButtonAction(uint8_t bits, PanelButtonAction action) {
+    for (int index = 0; bits != 0 && index < 4; index++) {
+        uint8_t bit = 1 << (FP_PB1_PIN + index);
+        if (!(bits & bit)) continue;
+        bits &= ~bit;
+        // ID pesan tombol berurutan sama dengan PanelButtonAction
+        LOG_INFO((LogMessageId)(LOG_MSG_BUTTON_RELEASED + action), index + 1);
+        event_bus_publish(EVT_BUTTON, index, action);
     }
+}
 
-    // Jika waktu debounce sudah lewat dan state masih sama
-    if ((millis() - lastDebounceTime[buttonIndex]) > debounceDelay) {
-        if (reading != currentButtonState[buttonIndex]) {
-            currentButtonState[buttonIndex] = reading; // Update state tombol
-            if (currentButtonState[buttonIndex] == HIGH) { // Asumsi Active HIGH
-                Serial.println("[OrderCoffee] Tombol PB" + String(buttonIndex + 1) + " ditekan.");
-                return true;
-            } else {
-                Serial.println("[OrderCoffee] Tombol PB" + String(buttonIndex + 1) + " dilepas.");
-            }
-        }
+// --- Sampel Tombol Front Panel ---
+// Semua tombol didebounce sekaligus dari port yang sudah dibaca (tanpa I2C)
+static ButtonEvents readPanelButtons() {
+    ButtonEvents events = panelButtons.update(panelInputs);
+    if (events.any()) {
+        publishButtonAction(events.pressed, BUTTON_PRESSED);
+        publishButtonAction(events.doublePressed, BUTTON_DOUBLE_PRESS);
+        publishButtonAction(events.longPressed, BUTTON_LONG_PRESS);
+        publishButtonAction(events.released, BUTTON_RELEASED);
     }
-    lastButtonState[buttonIndex] = reading; // Simpan state terakhir untuk debounce
-    return false;
+    return events;
 }
 
 // --- Implementasi Fungsi startBlinkingLEDs ---
@@ -107,22 +227,22 @@ void startBlinkingLEDs() {
     stopBlinkingLEDs(); // Pastikan LED mati sebelum mulai blinking
     lastBlinkMillis = millis();
     ledState = LOW; // LOW untuk ON pada common anode
-    pcf2.digitalWrite(FP_LED1_PIN, ledState);
-    pcf2.digitalWrite(FP_LED2_PIN, ledState);
-    Serial.println("[OrderCoffee] LEDs mulai blinking.");
+    writePanelLeds(ledState);
+    LOG_DEBUG(LOG_MSG_LEDS_BLINK_START);
     blinkingStoppedMessagePrinted = false; // Reset flag agar pesan "berhenti" bisa dicetak lagi
 }
 
 // --- Implementasi Fungsi stopBlinkingLEDs ---
 void stopBlinkingLEDs() {
-    // Hanya matikan LED jika mereka saat ini menyala (LOW) atau sedang blinking
-    if (pcf2.digitalRead(FP_LED1_PIN) == LOW || pcf2.digitalRead(FP_LED2_PIN) == LOW || !blinkingStoppedMessagePrinted) {
-        pcf2.digitalWrite(FP_LED1_PIN, HIGH); // Matikan LED (HIGH untuk common anode)
-        pcf2.digitalWrite(FP_LED2_PIN, HIGH);
+    // Hanya matikan LED jika mereka saat ini menyala (LOW) atau sedang blinking.
+    // State LED dibaca dari shadow register, bukan dari bus.
+    bool ledsOn = (panelOutputShadow & FP_LED_MASK) != FP_LED_MASK;
+    if (ledsOn || !blinkingStoppedMessagePrinted) {
+        writePanelLeds(HIGH); // Matikan LED (HIGH untuk common anode)
         ledState = HIGH; // Set status ke mati
 
         if (!blinkingStoppedMessagePrinted) {
-            Serial.println("[OrderCoffee] LEDs berhenti blinking.");
+            LOG_DEBUG(LOG_MSG_LEDS_BLINK_STOP);
             blinkingStoppedMessagePrinted = true; // Tandai bahwa pesan sudah dicetak
         }
     }
@@ -133,8 +253,7 @@ void updateBlinkingLEDs(unsigned long currentMillis) {
     if (currentMillis - lastBlinkMillis >= BLINK_INTERVAL) {
       lastBlinkMillis = currentMillis;
       ledState = !ledState; // Toggle LED state
-      pcf2.digitalWrite(FP_LED1_PIN, ledState);
-      pcf2.digitalWrite(FP_LED2_PIN, ledState);
+      writePanelLeds(ledState);
       blinkingStoppedMessagePrinted = false; // Reset agar pesan bisa dicetak lagi jika blinking berhenti
     }
 }
@@ -146,61 +265,241 @@ void selectCoffeeMenu(int menuId) {
         menuActive = true;
         startBlinkingLEDs(); // Mulai blinking LED saat menu dipilih
 
-        Serial.print("[OrderCoffee] Menu: ");
-        lcd.clear(); // Hapus tampilan sebelumnya
-        lcd.setCursor(0, 0);
+        lcd_post_clear(); // Hapus tampilan sebelumnya
 
         switch (menuId) {
             case 1:
-                Serial.println("Kopi Torabika dipilih.");
-                lcd.print("Kopi Torabika       ");
+                lcd_post_text(0, 0, "Kopi Torabika       ");
                 break;
             case 2:
-                Serial.println("Kopi Good Day dipilih.");
-                lcd.print("Kopi Good Day       ");
+                lcd_post_text(0, 0, "Kopi Good Day       ");
                 break;
             case 3:
-                Serial.println("Kopi ABC Susu dipilih.");
-                lcd.print("Kopi ABC Susu       ");
+                lcd_post_text(0, 0, "Kopi ABC Susu       ");
                 break;
             default:
-                Serial.println("Pilihan menu tidak valid.");
+                LOG_WARN(LOG_MSG_MENU_INVALID, menuId);
                 selectedMenu = 0;
                 menuActive = false;
                 stopBlinkingLEDs(); // Berhenti blinking jika pilihan tidak valid
-                lcd.print("Pilihan tidak valid!");
+                lcd_post_text(0, 0, "Pilihan tidak valid!");
                 break;
         }
 
+        if (selectedMenu != 0) LOG_INFO(LOG_MSG_MENU_SELECTED, COFFEE_MENU_NAMES[selectedMenu]);
+        event_bus_publish(EVT_MENU, 0, selectedMenu);
+        setBrewPhase(selectedMenu != 0 ? BREW_MENU_SELECT : BREW_IDLE);
+
         if (selectedMenu != 0) { // Jika pilihan valid, tampilkan "> Seduh kopi"
-            lcd.setCursor(0, 1);
-            lcd.print("> Seduh kopi        ");
-            lcd.setCursor(0, 2); lcd.print("                    "); // Bersihkan baris 2
-            lcd.setCursor(0, 3); lcd.print("                    "); // Bersihkan baris 3
+            lcd_post_text(0, 1, "> Seduh kopi        ");
+            lcd_post_text(0, 2, "                    "); // Bersihkan baris 2
+            lcd_post_text(0, 3, "                    "); // Bersihkan baris 3
         }
     } else {
-        Serial.println("[OrderCoffee] Sistem sedang dalam proses menu atau sudah dikonfirmasi. Tidak dapat memilih menu baru.");
+        LOG_WARN(LOG_MSG_MENU_LOCKED);
     }
 }
 
-// --- Implementasi Fungsi handleOrderCoffee ---
-void handleOrderCoffee() {
-  unsigned long currentMillis = millis();
-
-  // --- [1] Logika Reset Sistem Setelah Proses Menu Selesai ---
-  // Menu dikonfirmasi dan sudah 5 detik berlalu sejak proses dimulai
-  if (menuConfirmed && (currentMillis - menuProcessStartTime >= 5000)) {
-    Serial.println("[OrderCoffee] Proses menu selesai (5 detik). Mereset sistem ke mode idle.");
-
+// --- Fungsi Helper: Kembali ke Mode Idle ---
+static void resetOrderToIdle() {
     selectedMenu = 0;
     menuConfirmed = false;
     menuActive = false;
     rfidMenuMode = false; // Reset mode RFID
     rfidErrorActive = false; // Pastikan error RFID juga direset
+    event_bus_publish(EVT_MENU, 0, 0);
+    setBrewPhase(BREW_IDLE);
+
+    stopBlinkingLEDs();
+    displayIdleMenu();
+}
+
+// --- Implementasi Fungsi requestCoffeeOrder ---
+// Memasukkan pesanan ke antrean. Mengembalikan nomor tiket, atau 0 jika menu tidak valid
+// atau antrean penuh. Pesanan dieksekusi berurutan oleh handleOrderCoffee().
+uint32_t requestCoffeeOrder(int menuId) {
+    if (menuId < 1 || menuId > COFFEE_MENU_COUNT) return 0;
+    uint32_t ticket = 0;
+    portENTER_CRITICAL(&orderQueueMux);
+    if (orderQueueCount < ORDER_QUEUE_SIZE) {
+        QueuedOrder& order = orderQueue[(orderQueueHead + orderQueueCount) % ORDER_QUEUE_SIZE];
+        order.ticket = nextOrderTicket++;
+        order.menuId = (uint8_t)menuId;
+        order.queuedAt = millis();
+        orderQueueCount++;
+        ticket = order.ticket;
+    }
+    portEXIT_CRITICAL(&orderQueueMux);
+    return ticket;
+}
+
+// --- Implementasi Fungsi getOrderQueue ---
+// Menyalin isi antrean (urut dari yang terdepan), aman dipanggil dari task mana pun.
+size_t getOrderQueue(QueuedOrder* out, size_t maxOrders) {
+    portENTER_CRITICAL(&orderQueueMux);
+    size_t count = orderQueueCount < maxOrders ? orderQueueCount : maxOrders;
+    for (size_t i = 0; i < count; i++) {
+        out[i] = orderQueue[(orderQueueHead + i) % ORDER_QUEUE_SIZE];
+    }
+    portEXIT_CRITICAL(&orderQueueMux);
+    return count;
+}
+
+// Mengambil pesanan terdepan dari antrean, false jika antrean kosong
+static bool popQueuedOrder(QueuedOrder& order) {
+    bool available = false;
+    portENTER_CRITICAL(&orderQueueMux);
+    if (orderQueueCount > 0) {
+        order = orderQueue[orderQueueHead];
+        orderQueueHead = (orderQueueHead + 1) % ORDER_QUEUE_SIZE;
+        orderQueueCount--;
+        available = true;
+    }
+    portEXIT_CRITICAL(&orderQueueMux);
+    return available;
+}
 
-    stopBlinkingLEDs();   // Berhenti blinking setelah proses selesai
-    displayIdleMenu();    // Kembali ke tampilan idle setelah proses selesai
+// --- Akses Resep (aman dari task AsyncTCP & task kontrol) ---
+// Resep disalin utuh di dalam critical section, sehingga task kontrol tidak pernah
+// memakai resep yang baru sebagian diubah.
+BrewRecipe getBrewRecipe(int menuId) {
+    BrewRecipe recipe = {};
+    if (menuId < 1 || menuId > COFFEE_MENU_COUNT) return recipe;
+    portENTER_CRITICAL(&brewRecipeMux);
+    recipe = brewRecipes[menuId];
+    portEXIT_CRITICAL(&brewRecipeMux);
+    return recipe;
+}
+
+bool setBrewRecipe(int menuId, const BrewRecipe& recipe) {
+    if (menuId < 1 || menuId > COFFEE_MENU_COUNT) return false;
+    portENTER_CRITICAL(&brewRecipeMux);
+    brewRecipes[menuId] = recipe;
+    portEXIT_CRITICAL(&brewRecipeMux);
+    return true;
+}
+
+// --- Implementasi Fungsi requestCoffeeCancel ---
+// Pembatalan hanya berlaku sebelum menu dikonfirmasi (proses seduh tidak bisa dihentikan).
+// Dipanggil dari task AsyncTCP, jadi state menu dibaca dari snapshot task kontrol.
+bool requestCoffeeCancel() {
+    ControlSnapshot state = machine_state_control();
+    if (state.menuConfirmed || !state.menuActive) return false;
+    remoteCancelRequested = true;
+    return true;
+}
+
+// --- Fungsi Helper Motor Storage per Menu ---
+// Nyala/mati aktuator dicatat oleh motor_control, jadi helper ini tidak mencetak log sendiri
+static void startStorageMotor(int menuId, uint8_t speed) {
+  switch (menuId) {
+    case 1: motor_storage_1_start(speed); break; // Torabika
+    case 2: motor_storage_2_start(speed); break; // Good Day
+    case 3: motor_storage_3_start(speed); break; // ABC Susu
+    default: break;
   }
+}
+
+static void stopStorageMotor(int menuId) {
+  switch (menuId) {
+    case 1: motor_storage_1_stop(); break;
+    case 2: motor_storage_2_stop(); break;
+    case 3: motor_storage_3_stop(); break;
+    default: break;
+  }
+}
+
+static void showCoffeeReady() {
+  switch (selectedMenu) {
+    case 1: lcd_post_text(0, 0, "Kopi Torabika   "); break;
+    case 2: lcd_post_text(0, 0, "Kopi Good Day   "); break;
+    case 3: lcd_post_text(0, 0, "Kopi ABC Susu   "); break;
+    default: lcd_post_text(0, 0, "Kopi Siap!      "); break;
+  }
+  bool knownMenu = selectedMenu > 0 && selectedMenu <= COFFEE_MENU_COUNT;
+  LOG_INFO(LOG_MSG_BREW_DONE, COFFEE_MENU_NAMES[knownMenu ? selectedMenu : 0]);
+  lcd_post_text(0, 1, "Siap!           ");
+  lcd_post_text(0, 2, "                    ");
+  lcd_post_text(0, 3, "                    ");
+}
+
+// Menjalankan satu langkah seduh, mengembalikan jeda (ms) sampai langkah berikutnya
+static unsigned long runBrewStep(BrewStep step) {
+  const BrewRecipe& recipe = activeRecipe;
+  switch (step) {
+    case STEP_FILL_WATER:
+      setBrewPhase(BREW_FILL_WATER);
+      motor_pump_galon_start();
+      return recipe.fillWaterMs; // Default aktif selama 6.5 detik
+    case STEP_HEAT:
+      motor_pump_galon_stop();
+      setBrewPhase(BREW_HEATING);
+      return recipe.heatMs; // Default tunggu 16 detik untuk masak air panas
+    case STEP_HOT_WATER:
+      setBrewPhase(BREW_HOT_WATER);
+      motor_pump_hot_water_start();
+      motor_mixer_start(recipe.mixerSpeed); // Default mixer dengan kecepatan 150
+      return recipe.hotWaterMs; // Default aktif selama 10 detik air panas turun ke mixer
+    case STEP_HOT_WATER_STOP:
+      motor_pump_hot_water_stop();
+      return BREW_SETTLE_MS;
+    case STEP_DISPENSE:
+      setBrewPhase(BREW_DISPENSE);
+      startStorageMotor(selectedMenu, recipe.dispenseSpeed); // Default 250 (kecepatan/PWM)
+      return recipe.dispenseMs; // Default aktif selama 4 detik
+    case STEP_MIX:
+      stopStorageMotor(selectedMenu);
+      setBrewPhase(BREW_MIXING);
+      return recipe.mixMs; // Default proses mixing 7 detik
+    case STEP_POUR:
+      motor_mixer_stop();
+      // Mengingat "Selenoid valve GPIO33 adalah 'Selenoid seduh kopi'."
+      setBrewPhase(BREW_POUR);
+      motor_pump_seduh_kopi_start();
+      return recipe.pourMs; // Default aktif selama 10 detik kopi turun dari mixer ke gelas
+    case STEP_DONE:
+      motor_pump_seduh_kopi_stop();
+      coffeeOrdersServed[selectedMenu]++;
+      setBrewPhase(BREW_DONE);
+      showCoffeeReady();
+      return BREW_DONE_DISPLAY_MS;
+    case STEP_RESET:
+    default:
+      LOG_INFO(LOG_MSG_BREW_RESET);
+      resetOrderToIdle(); // Berhenti blinking & kembali ke tampilan idle
+      return 0;
+  }
+}
+
+// Task one-shot "brew": jalankan langkah saat ini lalu jadwalkan langkah berikutnya
+static void brewStepTask(unsigned long currentMillis) {
+  PERF_PROBE_SCOPE(PROBE_BREW_STEP);
+  BrewStep step = nextBrewStep;
+  unsigned long delayMs = runBrewStep(step);
+  if (step == STEP_RESET) return;
+
+  nextBrewStep = (BrewStep)(step + 1);
+  if (scheduler_add_oneshot("brew", brewStepTask, delayMs, TASK_PRIORITY_HIGH, SCHED_GROUP_CONTROL) < 0) {
+    // Tanpa langkah berikutnya aktuator bisa menyala terus, jadi hentikan semuanya
+    LOG_ERROR(LOG_MSG_BREW_SCHEDULE_FAIL);
+    motor_all_stop();
+    resetOrderToIdle();
+  }
+}
+
+static void startBrewSequence() {
+  activeRecipe = getBrewRecipe(selectedMenu);
+  nextBrewStep = STEP_FILL_WATER;
+  brewStepTask(millis());
+}
+
+// --- Implementasi Fungsi handleOrderCoffee ---
+// Task periodik "order": polling panel depan & antrean pesanan
+void handleOrderCoffee(unsigned long currentMillis) {
+  PERF_PROBE_SCOPE(PROBE_ORDER);
+
+  // --- [1] Reset ke Idle Setelah Kopi Siap ---
+  // Ditangani oleh langkah STEP_RESET pada task "brew"
 
   // --- [2] Update Status LED Blinking ---
   // LED hanya blinking saat menu aktif tapi belum dikonfirmasi
@@ -211,41 +510,50 @@ void handleOrderCoffee() {
   }
 
   // --- [3] Pembacaan Tombol Front Panel ---
-  bool pb1Pressed = readPushButton(FP_PB1_PIN, 0); // Tombol menu 1
-  bool pb2Pressed = readPushButton(FP_PB2_PIN, 1); // Tombol menu 2
-  bool pb3Pressed = readPushButton(FP_PB3_PIN, 2); // Tombol menu 3
-  bool pb4Pressed = readPushButton(FP_PB4_PIN, 3); // Tombol konfirmasi
-
-  // --- [4] Logika Deteksi Kartu RFID dan Masuk Mode Pemilihan Menu ---
-  // Masuk mode pemilihan kopi HANYA jika kartu RFID terdeteksi DAN sistem benar-benar idle
-  // (Tidak ada menu aktif, belum dikonfirmasi, bukan mode menu RFID yang sedang berlangsung,
-  // dan tidak ada error RFID aktif)
-  if (!currentRfidUid.isEmpty() && !menuActive && !menuConfirmed && !rfidMenuMode && !rfidErrorActive) {
-      // Serial.println("[OrderCoffee] Kartu RFID terdeteksi: " + currentRfidUid + ". Memproses kartu...");
-
-      // processRfidMenuSelection akan mengecek apakah kartu terdaftar
-      // Fungsi ini yang akan mengeset rfidMenuMode dan menuActive jika kartu terdaftar
-      processRfidMenuSelection(currentRfidUid);
-
-      // Jika processRfidMenuSelection berhasil mengaktifkan mode menu RFID
-      if (rfidMenuMode) {
-        Serial.println("[OrderCoffee] Mode pemilihan menu RFID diaktifkan. Tampilkan pilihan kopi di LCD.");
-        lcd.clear();
-        lcd.setCursor(0, 0);
-        lcd.print("Pilih Kopi:");
-        lcd.setCursor(0, 1);
-        lcd.print("1. Torabika");
-        lcd.setCursor(0, 2);
-        lcd.print("2. Good Day");
-        lcd.setCursor(0, 3);
-        lcd.print("3. ABC Susu");
-        startBlinkingLEDs(); // Mulai blinking LED saat masuk mode pemilihan
+  // Port hanya dibaca saat INT menandakan perubahan (tepi yang dicatat ISR, atau INT
+  // masih LOW). Tanpa penekanan tombol, front panel tidak menimbulkan lalu lintas I2C.
+  if (panelInterruptPending || hal_gpio_read(FP_INT_PIN) == LOW) {
+      readPanelPort();
+  }
+  ButtonEvents buttons = readPanelButtons();
+  bool pb1Pressed = buttons.pressed & (1 << FP_PB1_PIN); // Tombol menu 1
+  bool pb2Pressed = buttons.pressed & (1 << FP_PB2_PIN); // Tombol menu 2
+  bool pb3Pressed = buttons.pressed & (1 << FP_PB3_PIN); // Tombol menu 3
+  // Tombol konfirmasi: konfirmasi saat PB4 dilepas sebelum batas long-press,
+  // ditahan PANEL_LONG_PRESS_MS membatalkan menu yang dipilih
+  bool pb4Confirm = buttons.clicked & (1 << FP_PB4_PIN);
+  bool pb4Cancel = buttons.longPressed & (1 << FP_PB4_PIN);
+
+  // --- [3b] Pesanan & Pembatalan dari Klien Web ---
+  // Diset dari task AsyncTCP, dieksekusi di sini agar akses LCD & motor tetap di task kontrol
+  if (remoteCancelRequested) {
+      remoteCancelRequested = false;
+      if (menuActive && !menuConfirmed) {
+          LOG_INFO(LOG_MSG_ORDER_CANCEL_WEB);
+          resetOrderToIdle();
+      }
+  }
+  if (pb4Cancel && menuActive && !menuConfirmed) {
+      LOG_INFO(LOG_MSG_ORDER_CANCEL_HOLD);
+      resetOrderToIdle();
+  }
+  // --- [4] Tap Kartu RFID dari Task IO ---
+  // Task "rfid" hanya membaca kartu dan mengantrekan UID baru; pemilihan menu dari
+  // kartu diproses di sini agar state menu, LED & LCD hanya diubah oleh task kontrol.
+  // Seperti tombol menu, tap kartu diabaikan selama proses seduh berlangsung.
+  RfidCardTap cardTap;
+  if (takeRfidCardTap(cardTap)) {
+      if (!menuConfirmed) {
+          // processRfidMenuSelection mengecek apakah kartu terdaftar, lalu memilih menu
+          // dan mengeset rfidMenuMode, atau mengaktifkan pesan error RFID
+          processRfidMenuSelection(cardTap.uid);
+          if (rfidMenuMode) {
+              LOG_INFO(LOG_MSG_RFID_MENU_MODE);
+          }
       } else {
-        // Jika kartu terdeteksi tapi tidak valid/terdaftar
-        // Serial.println("[OrderCoffee] Kartu RFID terdeteksi, tapi tidak terdaftar atau tidak valid.");
-        // Logika untuk menampilkan pesan error di LCD untuk durasi tertentu ada di rfid_card_reader.cpp
+          LOG_WARN(LOG_MSG_RFID_IGNORED);
       }
-      // currentRfidUid tidak direset di sini; akan direset oleh rfid_card_reader.cpp setelah durasi tampil.
+      event_bus_publish(EVT_CARD_TAP, 0, rfidErrorActive ? 0 : 1, cardTap.uid);
   }
 
   // --- [5] Logika Pemilihan Menu oleh Pengguna (Tombol 1, 2, 3) ---
@@ -263,97 +571,34 @@ void handleOrderCoffee() {
       }
   }
 
+  // --- [5b] Pesanan Berikutnya dari Antrean Web ---
+  // Diambil hanya saat mesin benar-benar idle: seduhan sebelumnya selesai dan tidak ada
+  // pilihan lokal (kartu/tombol) yang sedang berjalan. Dicek setelah tap kartu & tombol
+  // di putaran ini, agar pilihan lokal yang baru masuk tidak ditimpa pesanan web.
+  QueuedOrder queuedOrder;
+  if (!menuActive && !menuConfirmed && popQueuedOrder(queuedOrder)) {
+      LOG_INFO(LOG_MSG_ORDER_FROM_WEB, queuedOrder.ticket, queuedOrder.menuId);
+      selectCoffeeMenu(queuedOrder.menuId);
+      pb4Confirm = true; // Langsung dikonfirmasi seperti menekan PB4
+  }
+
   // --- [6] Logika Konfirmasi Menu (Tombol 4) ---
   // Konfirmasi hanya jika menu aktif, belum dikonfirmasi, dan ada menu yang sudah dipilih
-  if (menuActive && !menuConfirmed && pb4Pressed && selectedMenu != 0) {
+  if (menuActive && !menuConfirmed && pb4Confirm && selectedMenu != 0) {
     menuConfirmed = true;
     menuProcessStartTime = currentMillis;
     stopBlinkingLEDs(); // Berhenti blinking setelah konfirmasi
 
-    Serial.println("--- [OrderCoffee] Menu " + String(selectedMenu) + " dikonfirmasi! Memulai proses kopi... ---");
-    lcd.clear();
-    lcd.setCursor(0, 0);
-    lcd.print("Memproses Kopi...");
-    lcd.setCursor(0, 1); lcd.print("                    ");
-    lcd.setCursor(0, 2); lcd.print("                    ");
-    lcd.setCursor(0, 3); lcd.print("                    ");
+    LOG_INFO(LOG_MSG_MENU_CONFIRMED, selectedMenu);
+    lcd_post_clear();
+    lcd_post_text(0, 0, "Memproses Kopi...");
+    lcd_post_text(0, 1, "                    ");
+    lcd_post_text(0, 2, "                    ");
+    lcd_post_text(0, 3, "                    ");
 
     // --- [6.1] Proses Kontrol Motor Sesuai Pilihan Kopi ---
-    Serial.println("[MotorControl] Memulai pompa galon...");
-    motor_pump_galon_start();
-    delay(6500); // Aktif selama 6.5 detik
-    motor_pump_galon_stop();
-    Serial.println("[MotorControl] Pompa galon selesai.");
-    delay(16000); // Tunggu 16 detik untuk masak air panas
-
-    Serial.println("[MotorControl] Memulai pompa air panas...");
-    motor_pump_hot_water_start();
-    Serial.println("[MotorControl] Memulai mixer...");
-
-    motor_mixer_start(150); // Mulai mixer dengan kecepatan 250
-    delay(10000);    // Aktif selama 10 detik air panas turun ke mixer
-    motor_pump_hot_water_stop();
-    Serial.println("[MotorControl] Pompa air panas selesai.");
-    delay(1000);
-
-    // Kontrol motor storage berdasarkan pilihan kopi
-    switch (selectedMenu) {
-        case 1: // Torabika
-            Serial.println("[MotorControl] Mengaktifkan motor_storage_1 (Torabika) selama 6 detik...");
-            motor_storage_1_start(250); // Asumsi 250 adalah kecepatan/PWM
-            delay(4000); // Aktif selama 7 detik
-            motor_storage_1_stop();
-            Serial.println("[MotorControl] motor_storage_1 (Torabika) selesai.");
-            break;
-        case 2: // Good Day
-            Serial.println("[MotorControl] Mengaktifkan motor_storage_2 (Good Day) selama 2 detik...");
-            motor_storage_2_start(250); // Asumsi 250 adalah kecepatan/PWM
-            delay(4000); // Aktif selama 3 detik
-            motor_storage_2_stop();
-            Serial.println("[MotorControl] motor_storage_2 (Good Day) selesai.");
-            break;
-        case 3: // ABC Susu
-            Serial.println("[MotorControl] Mengaktifkan motor_storage_3 (ABC Susu) selama 6 detik...");
-            motor_storage_3_start(250); // Asumsi 250 adalah kecepatan/PWM
-            delay(4000); // Aktif selama 7 detik
-            motor_storage_3_stop();
-            Serial.println("[MotorControl] motor_storage_3 (ABC Susu) selesai.");
-            break;
-        default:
-            Serial.println("[MotorControl] Tidak ada motor storage yang diaktifkan untuk pilihan menu ini.");
-            break;
-    }
-
-    delay(7000); // proses mixing 7 detik
-    motor_mixer_stop();
-    Serial.println("[MotorControl] Mixer selesai.");
-
-    // Mengingat "Selenoid valve GPIO33 adalah 'Selenoid seduh kopi'."
-    Serial.println("[MotorControl] Memulai Selenoid seduh kopi (GPIO33)...");
-    motor_pump_seduh_kopi_start();
-    delay(10000); // Aktif selama 20 detik kopi turun dari mixer ke gelas
-    motor_pump_seduh_kopi_stop();
-    Serial.println("[MotorControl] seduh kopi selesai.");
-
-    // Setelah proses selesai, tampilkan "Kopi Siap!" di LCD
-    Serial.print("[OrderCoffee] Kopi ");
-    switch (selectedMenu) {
-      case 1:
-        lcd.setCursor(0, 0); lcd.print("Kopi Torabika   ");
-        Serial.println("Torabika Siap!"); break;
-      case 2:
-        lcd.setCursor(0, 0); lcd.print("Kopi Good Day   ");
-        Serial.println("Good Day Siap!"); break;
-      case 3:
-        lcd.setCursor(0, 0); lcd.print("Kopi ABC Susu   ");
-        Serial.println("ABC Susu Siap!"); break;
-      default:
-        lcd.setCursor(0, 0); lcd.print("Kopi Siap!      ");
-        Serial.println("Siap! (Menu tidak diketahui)"); break;
-    }
-    lcd.setCursor(0, 1); lcd.print("Siap!           ");
-    lcd.setCursor(0, 2); lcd.print("                    ");
-    lcd.setCursor(0, 3); lcd.print("                    ");
+    // Dijalankan bertahap oleh task "brew", task kontrol tetap polling panel selama proses seduh
+    startBrewSequence();
   }
 
   // --- [7] Kontrol Tampilan Idle Menu ---
@@ -367,7 +612,7 @@ void handleOrderCoffee() {
       idleMenuDisplayed = true;
   } else if (menuActive || menuConfirmed || rfidErrorActive) {
       if (idleMenuDisplayed) { // Hanya log jika flag direset
-          Serial.println("[OrderCoffee] Aktivitas terdeteksi. Menyembunyikan Idle Menu.");
+          LOG_DEBUG(LOG_MSG_IDLE_MENU_HIDDEN);
       }
       idleMenuDisplayed = false; // Reset flag saat ada aktivitas
   }
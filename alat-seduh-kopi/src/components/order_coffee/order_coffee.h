@@ -2,9 +2,9 @@
 #define ORDER_COFFEE_H
 
 #include <Arduino.h>
-#include <Adafruit_PCF8574.h>
 #include <LiquidCrystal_I2C.h> // Untuk akses ke objek lcd
 #include "components/motor_control/motor_control.h" // Untuk kontrol dinamo
+#include "components/event_bus/event_bus.h" // Untuk publikasi event tombol, menu & fase seduh
 
 // --- Definisi Pin PCF8574 untuk Front Panel (0x21) ---
 // PIN ANDA DARI SCRIPT YANG DIBERIKAN
@@ -17,6 +17,23 @@ const int FP_PB4_PIN = 3; // P3 = Push button 4
 const int FP_LED1_PIN = 4; // P4 = LED 1
 const int FP_LED2_PIN = 5; // P5 = LED 2
 
+// --- Gestur Tombol Front Panel ---
+#define PANEL_LONG_PRESS_MS 1000   // Tahan PB4 selama ini untuk membatalkan menu yang dipilih
+#define PANEL_DOUBLE_PRESS_MS 400  // Jendela tekan ganda setelah tombol dilepas
+
+// Nilai EVT_BUTTON (id = index tombol)
+enum PanelButtonAction : uint8_t {
+  BUTTON_RELEASED = 0,
+  BUTTON_PRESSED,
+  BUTTON_LONG_PRESS,
+  BUTTON_DOUBLE_PRESS
+};
+
+// --- Pin INT PCF8574 Front Panel (0x21) ---
+// INT open-drain, aktif LOW selama ada input yang berubah sejak pembacaan port terakhir.
+// GPIO39 hanya input & tanpa pull-up internal: pasang pull-up 10k ke 3V3.
+const int FP_INT_PIN = 39;
+
 // --- Deklarasi Variabel Global untuk Logika Menu Kopi ---
 extern int selectedMenu;
 extern bool menuConfirmed; // True jika tombol konfirmasi ditekan
@@ -37,12 +54,45 @@ enum CoffeeScene {
 };
 extern CoffeeScene currentScene; // Variabel global untuk state scene saat ini
 
-// --- Deklarasi objek LCD dan PCF8574 sebagai extern ---
-extern LiquidCrystal_I2C lcd;
-extern Adafruit_PCF8574 pcf2; // Objek PCF8574 yang digunakan oleh modul ini
+// --- Fase Proses Seduh (dipublikasikan sebagai EVT_BREW_PHASE) ---
+enum BrewPhase : uint8_t {
+  BREW_IDLE = 0,        // Menunggu kartu/tombol
+  BREW_MENU_SELECT,     // Menu dipilih, menunggu konfirmasi
+  BREW_FILL_WATER,      // Pompa galon mengisi pemanas
+  BREW_HEATING,         // Menunggu air panas
+  BREW_HOT_WATER,       // Pompa air panas ke mixer
+  BREW_DISPENSE,        // Motor storage menuang bubuk kopi
+  BREW_MIXING,          // Mixer mengaduk
+  BREW_POUR,            // Selenoid seduh kopi ke gelas
+  BREW_DONE,            // Kopi siap
+  BREW_PHASE_COUNT
+};
+extern BrewPhase currentBrewPhase;
+
+// --- Resep Seduh per Menu (durasi dalam ms, speed PWM 0-255) ---
+struct BrewRecipe {
+  unsigned long fillWaterMs;   // Pompa galon mengisi pemanas
+  unsigned long heatMs;        // Menunggu air panas
+  unsigned long hotWaterMs;    // Pompa air panas ke mixer
+  unsigned long dispenseMs;    // Motor storage menuang bubuk kopi
+  uint8_t dispenseSpeed;       // Kecepatan motor storage
+  uint8_t mixerSpeed;          // Kecepatan motor mixer
+  unsigned long mixMs;         // Mixing setelah bubuk kopi dituang
+  unsigned long pourMs;        // Selenoid seduh kopi ke gelas
+};
+#define COFFEE_MENU_COUNT 3
+extern unsigned long coffeeOrdersServed[COFFEE_MENU_COUNT + 1]; // Jumlah kopi selesai per menu
+
+// --- Antrean Pesanan dari Klien Web/REST ---
+#define ORDER_QUEUE_SIZE 4 // Jumlah maksimum pesanan yang menunggu
+struct QueuedOrder {
+  uint32_t ticket;          // Nomor tiket yang dikembalikan ke pemesan
+  uint8_t menuId;
+  unsigned long queuedAt;   // millis() saat pesanan masuk antrean
+};
 
-// --- DEKLARASI EKSTERN UNTUK currentButtonState ---
-extern int currentButtonState[4];
+// --- Deklarasi objek LCD sebagai extern ---
+extern LiquidCrystal_I2C lcd;
 
 // --- Variabel Global untuk Kontrol Dinamo (baru) ---
 extern bool dynamoActive;           // Status dinamo (true=ON, false=OFF)
@@ -52,12 +102,12 @@ extern bool rfidMenuMode;
 
 // --- Prototipe Fungsi Order Coffee ---
 void setupOrderCoffee(uint8_t pcf2_address);
-void handleOrderCoffee();
+void handleOrderCoffee(unsigned long currentMillis); // Dipanggil oleh task scheduler "order"
 void selectCoffeeMenu(int menuId);
 void displayIdleMenu(); // <--- Tambahkan baris ini
 
 // Fungsi helper yang tetap di dalam modul ini
-bool readPushButton(int buttonPin, int buttonIndex);
+uint8_t panelButtonState(); // Bitmask tombol stabil (bit = pin PCF8574), dari task kontrol
 void startBlinkingLEDs();
 void stopBlinkingLEDs();
 void updateBlinkingLEDs(unsigned long currentMillis);
@@ -67,4 +117,17 @@ void updateBlinkingLEDs(unsigned long currentMillis);
 void selectCoffeeMenu(int menuId);
 void setRfidMenuMode(bool mode);
 
+// Pesanan dari klien web (aman dipanggil dari task AsyncTCP, dieksekusi di handleOrderCoffee)
+uint32_t requestCoffeeOrder(int menuId); // Nomor tiket, 0 jika ditolak
+bool requestCoffeeCancel();
+size_t getOrderQueue(QueuedOrder* out, size_t maxOrders);
+
+// Resep per menu (aman dipanggil dari task AsyncTCP; seduhan yang sedang berjalan memakai salinannya)
+BrewRecipe getBrewRecipe(int menuId);
+bool setBrewRecipe(int menuId, const BrewRecipe& recipe); // false jika menuId tidak valid
+
+// Fungsi untuk fase proses seduh
+void setBrewPhase(BrewPhase phase);
+const char* brewPhaseName(BrewPhase phase);
+
 #endif // ORDER_COFFEE_H
\ No newline at end of file
@@ -0,0 +1,114 @@
+#ifndef PORT_DEBOUNCER_H
+#define PORT_DEBOUNCER_H
+
+#include <Arduino.h>
+
+// --- Event Tombol per Sampel (bitmask, bit = pin port) ---
+struct ButtonEvents {
+  uint8_t pressed;       // Baru stabil ditekan
+  uint8_t released;      // Baru stabil dilepas
+  uint8_t longPressed;   // Ditahan mencapai batas long-press (sekali per penekanan)
+  uint8_t doublePressed; // Ditekan lagi dalam jendela double-press setelah pelepasan singkat
+  uint8_t clicked;       // Dilepas sebelum mencapai long-press
+
+  bool any() const { return (pressed | released | longPressed | doublePressed) != 0; }
+};
+
+// --- Debounce Bit-Paralel untuk Satu Port 8 Bit ---
+// Setiap bit punya counter vertikal 2 bit (bit ke-0 di count0, bit ke-1 di count1), jadi
+// kedelapan tombol didebounce bersamaan dengan beberapa operasi bitwise per sampel.
+// Perubahan baru diterima setelah 4 sampel berturut-turut berbeda dari state stabil.
+// Timer long/double press dihitung dalam sampel dan hanya disentuh untuk bit yang
+// sedang ditekan atau baru dilepas, sehingga panel diam tidak menambah biaya.
+// Input aktif HIGH (bit 1 = ditekan). Dipanggil dari satu task saja.
+class PortDebouncer {
+public:
+  PortDebouncer(uint8_t mask, uint16_t longTicks, uint16_t doubleTicks)
+    : mask(mask), longTicks(longTicks), doubleTicks(doubleTicks) {
+    reset(0);
+  }
+
+  // State awal tanpa event (mis. tombol yang sudah tertahan saat boot)
+  void reset(uint8_t raw) {
+    stable = raw & mask;
+    count0 = 0xFF;
+    count1 = 0xFF;
+    ticks = 0;
+    longFired = stable; // Tombol yang tertahan saat boot tidak memicu long-press
+    doubleArmed = 0;
+    doubleFired = 0;
+    memset(pressTick, 0, sizeof(pressTick));
+    memset(releaseTick, 0, sizeof(releaseTick));
+  }
+
+  // Satu sampel port mentah, dipanggil dengan periode tetap
+  ButtonEvents update(uint8_t raw) {
+    ButtonEvents events = {0, 0, 0, 0, 0};
+    ticks++;
+
+    uint8_t delta = (raw & mask) ^ stable;
+    count0 = ~(count0 & delta);
+    count1 = count0 ^ (count1 & delta);
+    uint8_t toggled = delta & count0 & count1; // Counter bit ini habis: perubahan diterima
+    stable ^= toggled;
+
+    events.pressed = toggled & stable;
+    events.released = toggled & ~stable;
+
+    if (events.pressed) {
+      events.doublePressed = events.pressed & doubleArmed;
+      doubleArmed &= ~events.pressed;
+      doubleFired = (doubleFired & ~events.pressed) | events.doublePressed;
+      longFired &= ~events.pressed;
+      forEachBit(events.pressed, [this](uint8_t bit) { pressTick[bit] = ticks; });
+    }
+    if (events.released) {
+      events.clicked = events.released & ~longFired;
+      // Hanya klik tunggal yang membuka jendela double-press (bukan tekan ganda/tahan)
+      uint8_t arm = events.clicked & ~doubleFired;
+      doubleArmed |= arm;
+      forEachBit(arm, [this](uint8_t bit) { releaseTick[bit] = ticks; });
+    }
+
+    uint8_t holding = stable & ~longFired;
+    if (holding) {
+      forEachBit(holding, [this, &events](uint8_t bit) {
+        if ((uint16_t)(ticks - pressTick[bit]) >= longTicks) events.longPressed |= (1 << bit);
+      });
+      longFired |= events.longPressed;
+    }
+    if (doubleArmed) {
+      forEachBit(doubleArmed, [this](uint8_t bit) {
+        if ((uint16_t)(ticks - releaseTick[bit]) > doubleTicks) doubleArmed &= ~(1 << bit);
+      });
+    }
+    return events;
+  }
+
+  uint8_t state() const { return stable; }
+
+private:
+  template <typename F>
+  static void forEachBit(uint8_t bits, F fn) {
+    while (bits) {
+      uint8_t bit = __builtin_ctz(bits);
+      fn(bit);
+      bits &= bits - 1;
+    }
+  }
+
+  uint8_t mask;
+  uint16_t longTicks;
+  uint16_t doubleTicks;
+  uint8_t stable;      // State stabil hasil debounce
+  uint8_t count0;      // Counter vertikal, bit rendah
+  uint8_t count1;      // Counter vertikal, bit tinggi
+  uint16_t ticks;      // Jumlah sampel (wrap aman, selisih dibanding sebagai uint16_t)
+  uint8_t longFired;   // Long-press sudah dilaporkan untuk penekanan ini
+  uint8_t doubleArmed; // Jendela double-press terbuka
+  uint8_t doubleFired; // Penekanan ini adalah tekan ganda
+  uint16_t pressTick[8];
+  uint16_t releaseTick[8];
+};
+
+#endif // PORT_DEBOUNCER_H
@@ -0,0 +1,145 @@
+/*
+  src/components/perf_probe/perf_probe.cpp - Instrumentasi Waktu Eksekusi Komponen
+  Setiap handler komponen dibungkus PERF_PROBE_SCOPE(), yang membaca CCOUNT
+  (hal_cycle_count()) di awal & akhir dan memasukkan selisihnya ke histogram
+  bucket tetap di RAM. Persentil (p50/p99) dan maksimum dihitung saat dilaporkan,
+  bukan saat direkam, sehingga biaya per probe hanya beberapa ratus cycle.
+  Ringkasan dikirim sebagai pesan "perf" pada topik WebSocket diagnostics dan
+  dicetak berkala ke Serial.
+*/
+
+#include "perf_probe.h"
+#include "components/scheduler/scheduler.h"
+
+#if PERF_PROBE_ENABLED
+// Nama probe (indeks = PerfProbeId)
+static const char* const PERF_PROBE_NAMES[PROBE_COUNT] = {
+  "order",
+  "brewStep",
+  "rfid",
+  "dht",
+  "distance",
+  "lcd",
+  "ws",
+  "topics",
+  "webApi",
+  "passControl",
+  "passNetwork",
+  "passIo"
+};
+
+PerfHistogram perfHistograms[PROBE_COUNT];
+
+// Batas bawah (cycle) bucket ke-b, kebalikan dari perf_bucket_for()
+static uint32_t bucketLowerBound(int bucket) {
+  if (bucket == 0) return 0;
+  int octave = bucket / 2;
+  int half = bucket % 2;
+  return (uint32_t)(2 + half) << (octave + PERF_HIST_MIN_SHIFT - 1);
+}
+
+// Batas atas bucket yang memuat persentil; tidak pernah melebihi maksimum terukur
+static uint32_t percentileCycles(const PerfHistogram& histogram, uint32_t permille) {
+  if (histogram.count == 0) return 0;
+  uint32_t rank = (uint32_t)(((uint64_t)histogram.count * permille + 999) / 1000);
+  uint32_t seen = 0;
+  for (int b = 0; b < PERF_HIST_BUCKETS; b++) {
+    seen += histogram.buckets[b];
+    if (seen >= rank) {
+      if (b == PERF_HIST_BUCKETS - 1) break;
+      uint32_t upper = bucketLowerBound(b + 1);
+      return upper < histogram.maxCycles ? upper : histogram.maxCycles;
+    }
+  }
+  return histogram.maxCycles;
+}
+
+/**
+ * @brief Menyalin ringkasan semua probe yang sudah merekam minimal satu sampel.
+ * Histogram disalin dulu karena bisa sedang ditulis task lain; nilai yang sedikit
+ * tidak konsisten antar field diterima karena hanya untuk pemantauan.
+ */
+size_t perf_probe_summaries(PerfProbeSummary* out, size_t maxProbes) {
+  size_t count = 0;
+  for (int i = 0; i < PROBE_COUNT && count < maxProbes; i++) {
+    PerfHistogram histogram;
+    memcpy(&histogram, &perfHistograms[i], sizeof(histogram));
+    if (histogram.count == 0) continue;
+
+    PerfProbeSummary& summary = out[count++];
+    summary.name = PERF_PROBE_NAMES[i];
+    summary.count = histogram.count;
+    summary.avgCycles = (uint32_t)(histogram.totalCycles / histogram.count);
+    summary.p50Cycles = percentileCycles(histogram, 500);
+    summary.p99Cycles = percentileCycles(histogram, 990);
+    summary.maxCycles = histogram.maxCycles;
+  }
+  return count;
+}
+
+static void perfSerialTask(unsigned long currentMillis) {
+  perf_probe_print_summary();
+}
+
+void setupPerfProbe() {
+  memset(perfHistograms, 0, sizeof(perfHistograms));
+  if (PERF_PROBE_SERIAL_INTERVAL_MS > 0) {
+    scheduler_add_periodic("perfLog", perfSerialTask, PERF_PROBE_SERIAL_INTERVAL_MS,
+                           TASK_PRIORITY_LOW, SCHED_GROUP_IO);
+  }
+  Serial.println("[PERF] Probe waktu eksekusi aktif.");
+}
+#else
+size_t perf_probe_summaries(PerfProbeSummary* out, size_t maxProbes) {
+  return 0;
+}
+
+void setupPerfProbe() {
+}
+#endif // PERF_PROBE_ENABLED
+
+// Konversi cycle ke mikrodetik sesuai frekuensi CPU saat ini
+static float cyclesToUs(uint32_t cycles) {
+  return (float)cycles / (float)hal_cpu_mhz();
+}
+
+/**
+ * @brief Menyusun pesan {"type":"perf"} berisi n, rata-rata, p50, p99 & maksimum (µs).
+ */
+void writePerfJson(JsonWriter& writer) {
+  PerfProbeSummary summaries[PROBE_COUNT];
+  size_t count = perf_probe_summaries(summaries, PROBE_COUNT);
+
+  writer.beginObject()
+    .field("type", "perf")
+    .field("enabled", PERF_PROBE_ENABLED != 0)
+    .field("cpuMHz", (unsigned long)hal_cpu_mhz());
+  writer.beginArray("probes");
+  for (size_t i = 0; i < count; i++) {
+    const PerfProbeSummary& summary = summaries[i];
+    writer.beginObject()
+      .field("name", summary.name)
+      .field("n", (unsigned long)summary.count)
+      .field("avgUs", cyclesToUs(summary.avgCycles), 1)
+      .field("p50Us", cyclesToUs(summary.p50Cycles), 1)
+      .field("p99Us", cyclesToUs(summary.p99Cycles), 1)
+      .field("maxUs", cyclesToUs(summary.maxCycles), 1)
+      .endObject();
+  }
+  writer.endArray().endObject();
+}
+
+void perf_probe_print_summary() {
+  PerfProbeSummary summaries[PROBE_COUNT];
+  size_t count = perf_probe_summaries(summaries, PROBE_COUNT);
+  if (count == 0) return;
+
+  Serial.println("[PERF] probe          n        avg(us)  p50(us)  p99(us)  max(us)");
+  for (size_t i = 0; i < count; i++) {
+    const PerfProbeSummary& summary = summaries[i];
+    Serial.printf("[PERF] %-12s %8lu %8.1f %8.1f %8.1f %8.1f\n", summary.name,
+                  (unsigned long)summary.count, cyclesToUs(summary.avgCycles),
+                  cyclesToUs(summary.p50Cycles), cyclesToUs(summary.p99Cycles),
+                  cyclesToUs(summary.maxCycles));
+  }
+}
@@ -0,0 +1,101 @@
+#ifndef PERF_PROBE_H
+#define PERF_PROBE_H
+
+#include "components/hal/hal.h"
+#include "components/json_writer/json_writer.h"
+
+// --- Saklar Compile-Time ---
+// Tambahkan -D PERF_PROBE_ENABLED=0 di build_flags untuk menghapus semua probe:
+// PERF_PROBE_SCOPE() menjadi kosong dan tidak ada histogram di RAM.
+#ifndef PERF_PROBE_ENABLED
+#define PERF_PROBE_ENABLED 1
+#endif
+
+// --- Konfigurasi Histogram ---
+// Bucket logaritmik: dua bucket per kelipatan dua (resolusi ~±25%), mulai dari
+// 2^PERF_HIST_MIN_SHIFT cycle. 48 bucket mencakup 128 cycle sampai ~9 detik @240 MHz.
+#define PERF_HIST_BUCKETS 48
+#define PERF_HIST_MIN_SHIFT 7
+#define PERF_PROBE_SERIAL_INTERVAL_MS 30000 // Ringkasan ke Serial (0 = nonaktif)
+#define PERF_JSON_BUFFER_SIZE 1024          // Buffer pesan "perf" (topik diagnostics)
+
+// --- Titik Ukur ---
+// Setiap probe hanya direkam dari satu task (task grupnya), sehingga histogram
+// ditulis tanpa kunci. Task dipasang di satu core, jadi CCOUNT awal & akhir
+// selalu dari core yang sama.
+enum PerfProbeId : uint8_t {
+  PROBE_ORDER = 0,    // handleOrderCoffee (kontrol)
+  PROBE_BREW_STEP,    // Langkah seduh one-shot (kontrol)
+  PROBE_RFID,         // handleRfidCardReader (IO)
+  PROBE_DHT,          // handleTemperatureHumidity (IO)
+  PROBE_DISTANCE,     // readTelemetrySensors, 3 sensor jarak (IO)
+  PROBE_LCD,          // handleLcdDisplay (IO)
+  PROBE_WS,           // Event, resync & snapshot WebSocket (jaringan)
+  PROBE_TOPICS,       // Serialisasi & kirim topik periodik (jaringan)
+  PROBE_WEB_API,      // Cache /api/status (jaringan)
+  PROBE_PASS_CONTROL, // Satu putaran scheduler grup kontrol
+  PROBE_PASS_NETWORK, // Satu putaran scheduler grup jaringan
+  PROBE_PASS_IO,      // Satu putaran scheduler grup IO (latensi loop())
+  PROBE_COUNT
+};
+
+struct PerfHistogram {
+  uint32_t count;
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  uint32_t buckets[PERF_HIST_BUCKETS];
+};
+
+// Ringkasan satu probe (dalam cycle CPU)
+struct PerfProbeSummary {
+  const char* name;
+  uint32_t count;
+  uint32_t avgCycles;
+  uint32_t p50Cycles;  // Batas atas bucket persentil ke-50
+  uint32_t p99Cycles;  // Batas atas bucket persentil ke-99
+  uint32_t maxCycles;
+};
+
+#if PERF_PROBE_ENABLED
+extern PerfHistogram perfHistograms[PROBE_COUNT];
+
+static inline uint8_t perf_bucket_for(uint32_t cycles) {
+  if (cycles < (1u << PERF_HIST_MIN_SHIFT)) return 0;
+  int msb = 31 - __builtin_clz(cycles);
+  int bucket = (msb - PERF_HIST_MIN_SHIFT) * 2 + ((cycles >> (msb - 1)) & 1);
+  return bucket < PERF_HIST_BUCKETS ? bucket : PERF_HIST_BUCKETS - 1;
+}
+
+// Jalur panas: beberapa penjumlahan & satu NSAU, tanpa pembagian maupun kunci
+static inline void perf_probe_record(PerfProbeId id, uint32_t cycles) {
+  PerfHistogram& histogram = perfHistograms[id];
+  histogram.count++;
+  histogram.totalCycles += cycles;
+  if (cycles > histogram.maxCycles) histogram.maxCycles = cycles;
+  histogram.buckets[perf_bucket_for(cycles)]++;
+}
+
+// Mengukur durasi scope (konstruktor sampai destruktor) dengan hal_cycle_count()
+class PerfProbeScope {
+public:
+  explicit PerfProbeScope(PerfProbeId id) : probeId(id), startCycles(hal_cycle_count()) {}
+  ~PerfProbeScope() { perf_probe_record(probeId, hal_cycle_count() - startCycles); }
+
+private:
+  PerfProbeId probeId;
+  uint32_t startCycles;
+};
+
+#define PERF_PROBE_SCOPE(id) PerfProbeScope perfProbeScope(id)
+#else
+#define PERF_PROBE_SCOPE(id) do {} while (0)
+#endif
+
+// --- Prototipe Fungsi Perf Probe ---
+// Tetap tersedia saat probe dinonaktifkan (tidak melakukan apa pun / daftar kosong)
+void setupPerfProbe(); // Mendaftarkan task ringkasan Serial (grup IO)
+size_t perf_probe_summaries(PerfProbeSummary* out, size_t maxProbes);
+void writePerfJson(JsonWriter& writer); // Pesan {"type":"perf"} untuk topik diagnostics
+void perf_probe_print_summary();
+
+#endif // PERF_PROBE_H
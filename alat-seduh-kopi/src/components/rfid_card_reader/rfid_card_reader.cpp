@@ -1,66 +1,115 @@
 #include "rfid_card_reader.h"
 #include "components/lcd_display/lcd_display.h" // Untuk update LCD
 #include "components/order_coffee/order_coffee.h" // Untuk memanggil fungsi pemilihan menu
+#include "components/event_bus/event_bus.h" // Untuk publikasi event tap kartu
+#include "components/scheduler/scheduler.h" // Untuk polling kartu & timer reset UID/error
+#include "components/rtos_tasks/spsc_queue.h" // Untuk antrean tap kartu ke task kontrol
+#include "components/perf_probe/perf_probe.h" // Untuk mengukur waktu polling kartu
+#include "components/logger/logger.h" // Log runtime tanpa menulis UART di task IO/kontrol
 
 MFRC522 mfrc522(SS_PIN, RST_PIN); // Buat objek MFRC522
 
 // Definisi global variables (deklarasi extern di .h)
-String currentRfidUid = "Belum Terbaca"; // Default value
+char currentRfidUid[RFID_UID_TEXT_LEN] = RFID_UID_NONE; // Buffer tetap, tanpa alokasi heap
 unsigned long lastRfidReadMillis = 0;
 const long RFID_DISPLAY_DURATION_MS = 5000; // UID akan ditampilkan selama 5 detik
 
 bool rfidErrorActive = false; // Flag untuk menunjukkan pesan error RFID aktif
 unsigned long rfidErrorStartTime = 0;
 const long RFID_ERROR_DISPLAY_DURATION_MS = 3000; // Durasi tampilan pesan error RFID
+const unsigned long RFID_POLL_INTERVAL_MS = 50;    // Periode polling kartu oleh task "rfid"
+
+// ID task one-shot reset (-1 = tidak terjadwal)
+static int uidResetTaskId = -1;   // Grup IO, bersama pembacaan kartu
+static int errorResetTaskId = -1; // Grup kontrol, bersama logika menu
+
+// Tap kartu baru: producer = task "rfid" (IO), consumer = handleOrderCoffee (kontrol)
+static SpscQueue<RfidCardTap, RFID_TAP_QUEUE_SIZE + 1> cardTapQueue;
+
+// --- Task One-Shot Reset UID & Pesan Error ---
+// Menggantikan pengecekan durasi + delay(1000) yang dulu dilakukan setiap loop()
+static void resetUidTask(unsigned long currentMillis) {
+    uidResetTaskId = -1;
+    LOG_INFO(LOG_MSG_RFID_UID_RESET, (unsigned)RFID_DISPLAY_DURATION_MS);
+    strcpy(currentRfidUid, RFID_UID_NONE);
+    // Tidak langsung update LCD di sini karena displayIdleMenu() di handleOrderCoffee() akan menanganinya
+}
+
+static void resetErrorTask(unsigned long currentMillis) {
+    errorResetTaskId = -1;
+    LOG_INFO(LOG_MSG_RFID_ERROR_RESET, (unsigned)RFID_ERROR_DISPLAY_DURATION_MS);
+    rfidErrorActive = false;
+    // LCD akan kembali ke idle menu melalui handleOrderCoffee()
+}
+
+// Menulis UID kartu sebagai heksadesimal huruf besar ("091CD54B") ke buffer tetap
+void formatRfidUid(const uint8_t* uidBytes, uint8_t uidSize, char* out, size_t size) {
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+    size_t len = 0;
+    for (byte i = 0; i < uidSize && len + 2 < size; i++) {
+        out[len++] = HEX_DIGITS[uidBytes[i] >> 4];
+        out[len++] = HEX_DIGITS[uidBytes[i] & 0x0F];
+    }
+    out[len] = '\0';
+}
+
+// Empat byte pertama UID sebagai angka, untuk log. Record log hanya menyimpan pointer
+// argumen %s, sedangkan buffer UID berubah, jadi UID tidak dikirim sebagai teks.
+static uint32_t uidLogValue(const char* uidText) {
+    char prefix[9];
+    strncpy(prefix, uidText, sizeof(prefix) - 1);
+    prefix[sizeof(prefix) - 1] = '\0';
+    return (uint32_t)strtoul(prefix, nullptr, 16);
+}
+
+// Menjadwalkan (ulang) task one-shot, durasi dihitung dari sekarang
+static void armResetTask(int& taskId, const char* name, TaskCallback callback, unsigned long delayMs,
+                         SchedulerGroup group) {
+    if (!scheduler_reschedule(taskId, delayMs)) {
+        taskId = scheduler_add_oneshot(name, callback, delayMs, TASK_PRIORITY_NORMAL, group);
+    }
+}
 
 void setupRfidCardReader() {
     mfrc522.PCD_Init(); // Inisialisasi MFRC522
+    scheduler_add_periodic("rfid", handleRfidCardReader, RFID_POLL_INTERVAL_MS, TASK_PRIORITY_NORMAL, SCHED_GROUP_IO);
     Serial.println("[RFID] Inisialisasi RFID RC522 selesai.");
 }
 
+// Task periodik "rfid": polling kartu setiap RFID_POLL_INTERVAL_MS
 void handleRfidCardReader(unsigned long currentMillis) {
-    // --- [1] Logika Reset UID dan Pesan Error RFID ---
-    // Reset UID setelah durasi tertentu jika tidak ada kartu yang terdeteksi lagi
-    if (currentRfidUid != "Belum Terbaca" && (currentMillis - lastRfidReadMillis > RFID_DISPLAY_DURATION_MS)) {
-        Serial.println("[RFID] RFID UID direset ke 'Belum Terbaca' setelah " + String(RFID_DISPLAY_DURATION_MS) + "ms.");
-        delay(1000); // Delay untuk memberi waktu pembaca kartu
-        currentRfidUid = "Belum Terbaca";
-        // Tidak langsung update LCD di sini karena displayIdleMenu() di handleOrderCoffee() akan menanganinya
-    }
+    PERF_PROBE_SCOPE(PROBE_RFID);
 
-    // Reset pesan error RFID setelah durasi tertentu
-    if (rfidErrorActive && (currentMillis - rfidErrorStartTime > RFID_ERROR_DISPLAY_DURATION_MS)) {
-        Serial.println("[RFID] Pesan error RFID direset setelah " + String(RFID_ERROR_DISPLAY_DURATION_MS) + "ms.");
-        delay(1000); // Delay untuk memberi waktu pembaca kartu
-        rfidErrorActive = false;
-        // LCD akan kembali ke idle menu melalui handleOrderCoffee()
-    }
+    // --- [1] Logika Reset UID dan Pesan Error RFID ---
+    // Ditangani oleh task one-shot resetUidTask & resetErrorTask
 
     // --- [2] Deteksi dan Pembacaan Kartu RFID ---
     // Periksa apakah ada kartu baru yang hadir atau kartu yang sama masih ada
     if (mfrc522.PICC_IsNewCardPresent() || mfrc522.PICC_ReadCardSerial()) {
         if (mfrc522.PICC_ReadCardSerial()) {
-            String uidString = "";
-            for (byte i = 0; i < mfrc522.uid.size; i++) {
-                uidString += (mfrc522.uid.uidByte[i] < 0x10 ? "0" : "");
-                uidString += String(mfrc522.uid.uidByte[i], HEX);
-            }
-            uidString.toUpperCase();
+            char uidText[RFID_UID_TEXT_LEN];
+            formatRfidUid(mfrc522.uid.uidByte, mfrc522.uid.size, uidText, sizeof(uidText));
 
             // Hanya proses jika UID yang terbaca berbeda dari yang terakhir
-            // atau jika currentRfidUid sudah direset ("Belum Terbaca")
-            if (currentRfidUid != uidString || currentRfidUid == "Belum Terbaca") {
-                currentRfidUid = uidString;
+            // atau jika currentRfidUid sudah direset (RFID_UID_NONE)
+            if (strcmp(currentRfidUid, uidText) != 0) {
+                strcpy(currentRfidUid, uidText);
                 lastRfidReadMillis = currentMillis; // Perbarui waktu terakhir baca
-                Serial.println("[RFID] Kartu RFID Terdeteksi! UID: " + currentRfidUid);
+                armResetTask(uidResetTaskId, "rfidUid", resetUidTask, RFID_DISPLAY_DURATION_MS, SCHED_GROUP_IO);
+                LOG_INFO(LOG_MSG_RFID_CARD_DETECTED, uidLogValue(uidText), (unsigned)mfrc522.uid.size);
 
-                // Panggil fungsi untuk memproses pilihan menu dari RFID.
-                // Fungsi inilah yang sekarang akan menangani lcd.clear() dan tampilan ID.
-                processRfidMenuSelection(currentRfidUid);
+                // Pemilihan menu dari RFID diproses oleh task kontrol (handleOrderCoffee),
+                // yang memiliki state menu, LCD & LED. Di sini tap hanya diantrekan.
+                RfidCardTap tap;
+                memcpy(tap.uid, currentRfidUid, RFID_UID_TEXT_LEN);
+                if (!cardTapQueue.push(tap)) {
+                    LOG_WARN(LOG_MSG_RFID_TAP_QUEUE_FULL);
+                }
 
             } else {
                 // Kartu yang sama masih terdeteksi, perbarui waktu baca agar tidak direset
                 lastRfidReadMillis = currentMillis;
+                armResetTask(uidResetTaskId, "rfidUid", resetUidTask, RFID_DISPLAY_DURATION_MS, SCHED_GROUP_IO);
             }
 
             mfrc522.PICC_HaltA(); // Hentikan PICC untuk mencegah pembacaan ganda
@@ -69,28 +118,34 @@ void handleRfidCardReader(unsigned long currentMillis) {
     }
 }
 
+// Mengambil tap kartu berikutnya, false jika tidak ada. Dipanggil dari task kontrol.
+bool takeRfidCardTap(RfidCardTap& tap) {
+    return cardTapQueue.pop(tap);
+}
+
 // --- Implementasi fungsi untuk memproses pilihan menu dari RFID ---
-void processRfidMenuSelection(String rfidUid) {
+void processRfidMenuSelection(const char* rfidUid) {
     bool isCardRegistered = false; // Flag untuk mengecek apakah kartu terdaftar
     int menuId = -1; // Variabel untuk menyimpan ID menu yang dipilih
+    const char* cardName = nullptr; // Nama kartu terdaftar (string statis, aman untuk log)
 
-    if (rfidUid == "091CD54B") { // Ganti dengan UID Kartu Torabika Anda
-        Serial.println("[RFID] Kartu 'Torabika' terdeteksi. Memilih menu 1.");
+    if (strcmp(rfidUid, "091CD54B") == 0) { // Ganti dengan UID Kartu Torabika Anda
+        cardName = "Torabika";
         menuId = 1;
         isCardRegistered = true;
-    } else if (rfidUid == "A903E84B") { // Ganti dengan UID Kartu Good Day Anda
-        Serial.println("[RFID] Kartu 'Good Day' terdeteksi. Memilih menu 2.");
+    } else if (strcmp(rfidUid, "A903E84B") == 0) { // Ganti dengan UID Kartu Good Day Anda
+        cardName = "Good Day";
         menuId = 1;
         isCardRegistered = true;
-    } else if (rfidUid == "C915EAA3") { // Ganti dengan UID Kartu ABC Susu Anda
-        Serial.println("[RFID] Kartu 'ABC Susu' terdeteksi. Memilih menu 3.");
+    } else if (strcmp(rfidUid, "C915EAA3") == 0) { // Ganti dengan UID Kartu ABC Susu Anda
+        cardName = "ABC Susu";
         menuId = 1;
         isCardRegistered = true;
     } else {
-        Serial.println("[RFID] Kartu RFID tidak dikenal: " + rfidUid + ". Menampilkan pesan error.");
-        delay(1000); // Delay untuk memberi waktu pembaca kartu
+        LOG_WARN(LOG_MSG_RFID_CARD_UNKNOWN, uidLogValue(rfidUid));
         rfidErrorActive = true; // Aktifkan flag error
         rfidErrorStartTime = millis(); // Catat waktu mulai error
+        armResetTask(errorResetTaskId, "rfidError", resetErrorTask, RFID_ERROR_DISPLAY_DURATION_MS, SCHED_GROUP_CONTROL);
         isCardRegistered = false; // Kartu tidak terdaftar
     }
 
@@ -104,7 +159,7 @@ void processRfidMenuSelection(String rfidUid) {
     if (isCardRegistered) {
         // KARTU TERDAFTAR: JANGAN LAKUKAN lcd.clear()
         // Langsung panggil fungsi selectCoffeeMenu dan atur mode RFID
-        Serial.println("[RFID] Mengarahkan ke menu ID: " + String(menuId));
+        LOG_INFO(LOG_MSG_RFID_CARD_SELECTED, cardName, menuId);
         selectCoffeeMenu(menuId); // Memilih menu dan menampilkan di LCD
         setRfidMenuMode(true); // Mengatur flag agar sistem tahu menu dipilih via RFID
     } else {
@@ -9,16 +9,27 @@
 #define SS_PIN 5  // SDA (Slave Select) pin for RC522
 #define RST_PIN 26 // RST (Reset) pin for RC522
 
+#define RFID_UID_TEXT_LEN 24   // Panjang maksimum UID heksadesimal (termasuk '\0')
+#define RFID_UID_NONE "Belum Terbaca" // Isi currentRfidUid saat tidak ada kartu
+#define RFID_TAP_QUEUE_SIZE 4  // Antrean tap kartu dari task IO ke task kontrol
+
+// Tap kartu baru yang diteruskan ke task kontrol
+struct RfidCardTap {
+  char uid[RFID_UID_TEXT_LEN];
+};
+
 // Deklarasi global variable untuk menyimpan UID kartu yang terbaca
-extern String currentRfidUid;
-extern bool rfidErrorActive;
+extern char currentRfidUid[RFID_UID_TEXT_LEN]; // Milik task IO (dibaca task lain lewat machine_state)
+extern bool rfidErrorActive;  // Milik task kontrol
 extern unsigned long lastRfidReadMillis;
 // extern const long RFID_DISPLAY_DURATION_MS; // <-- Ini TIDAK perlu extern karena dia adalah const
 
 // Deklarasi fungsi
 void setupRfidCardReader();
 void handleRfidCardReader(unsigned long currentMillis);
-void processRfidMenuSelection(String rfidUid);
+void processRfidMenuSelection(const char* rfidUid); // Hanya dari task kontrol
+bool takeRfidCardTap(RfidCardTap& tap);             // Hanya dari task kontrol
+void formatRfidUid(const uint8_t* uidBytes, uint8_t uidSize, char* out, size_t size); // Heksadesimal huruf besar
 
 #endif // RFID_CARD_READER_H
 
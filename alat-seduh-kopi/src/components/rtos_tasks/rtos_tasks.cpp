@@ -0,0 +1,138 @@
+/*
+  src/components/rtos_tasks/rtos_tasks.cpp - Model Threading Mesin Kopi
+  Setiap grup scheduler dijalankan oleh satu task FreeRTOS:
+    control  (core 1, prioritas 5) - tombol, menu, proses seduh, motor & LED PCF8574
+    network  (core 0, prioritas 2) - event & topik WebSocket, cache /api/status
+    loopTask (core 1, prioritas 1) - sensor jarak, DHT, RFID, LCD
+  Antar task tidak ada state bersama yang ditulis dua arah: data mengalir lewat
+  antrean SpscQueue (perintah LCD, tap kartu, event bus) dan state dibaca lewat
+  snapshot SeqLock (modul 'machine_state'). Satu-satunya titik tunggu adalah bus
+  I2C bersama, yang giliran transaksinya diatur modul 'i2c_bus' menurut prioritas.
+*/
+
+#include "rtos_tasks.h"
+#include "components/machine_state/machine_state.h"
+#include "components/perf_probe/perf_probe.h"
+
+static TaskHandle_t controlTaskHandle = nullptr;
+static TaskHandle_t networkTaskHandle = nullptr;
+static TaskHandle_t ioTaskHandle = nullptr;
+
+// Tidur sampai task grup berikutnya jatuh tempo. Minimal satu tick, agar task
+// berprioritas lebih rendah di core yang sama tetap mendapat giliran.
+static void sleepUntilNextTask(SchedulerGroup group) {
+  unsigned long waitMs = scheduler_next_wait(group, millis(), RTOS_MAX_IDLE_MS);
+  TickType_t ticks = pdMS_TO_TICKS(waitMs);
+  vTaskDelay(ticks > 0 ? ticks : 1);
+}
+
+static void controlTaskMain(void* param) {
+  for (;;) {
+    {
+      PERF_PROBE_SCOPE(PROBE_PASS_CONTROL);
+      scheduler_run(SCHED_GROUP_CONTROL, millis());
+    }
+    machine_state_publish_control();
+    sleepUntilNextTask(SCHED_GROUP_CONTROL);
+  }
+}
+
+static void networkTaskMain(void* param) {
+  for (;;) {
+    {
+      PERF_PROBE_SCOPE(PROBE_PASS_NETWORK);
+      scheduler_run(SCHED_GROUP_NETWORK, millis());
+    }
+    sleepUntilNextTask(SCHED_GROUP_NETWORK);
+  }
+}
+
+/**
+ * @brief Mencatat loopTask sebagai task IO.
+ * Dipanggil paling awal di setup(), sebelum komponen mendaftarkan task atau event.
+ */
+void setupRtosTasks() {
+  ioTaskHandle = xTaskGetCurrentTaskHandle();
+}
+
+/**
+ * @brief Mempublikasikan snapshot awal lalu membuat task kontrol & jaringan.
+ * Dipanggil di akhir setup(), setelah semua komponen selesai diinisialisasi.
+ * @return false jika salah satu task gagal dibuat.
+ */
+bool startRtosTasks() {
+  machine_state_publish_control();
+  machine_state_publish_sensors();
+
+  bool ok = true;
+  if (xTaskCreatePinnedToCore(controlTaskMain, "control", RTOS_CONTROL_STACK_SIZE, nullptr,
+                              RTOS_CONTROL_PRIORITY, &controlTaskHandle, RTOS_CONTROL_CORE) != pdPASS) {
+    Serial.println("[RTOS] FATAL: Task kontrol gagal dibuat.");
+    ok = false;
+  }
+  if (xTaskCreatePinnedToCore(networkTaskMain, "network", RTOS_NETWORK_STACK_SIZE, nullptr,
+                              RTOS_NETWORK_PRIORITY, &networkTaskHandle, RTOS_NETWORK_CORE) != pdPASS) {
+    Serial.println("[RTOS] Task jaringan gagal dibuat.");
+    ok = false;
+  }
+  if (ok) {
+    Serial.printf("[RTOS] Task kontrol (core %d) & jaringan (core %d) berjalan.\n",
+                  RTOS_CONTROL_CORE, RTOS_NETWORK_CORE);
+  }
+  return ok;
+}
+
+void runIoTaskPass() {
+  {
+    PERF_PROBE_SCOPE(PROBE_PASS_IO);
+    scheduler_run(SCHED_GROUP_IO, millis());
+  }
+  machine_state_publish_sensors();
+  sleepUntilNextTask(SCHED_GROUP_IO);
+}
+
+TaskRole rtos_current_role() {
+  TaskHandle_t current = xTaskGetCurrentTaskHandle();
+  if (current == controlTaskHandle && current != nullptr) return TASK_ROLE_CONTROL;
+  if (current == networkTaskHandle && current != nullptr) return TASK_ROLE_NETWORK;
+  if (current == ioTaskHandle && current != nullptr) return TASK_ROLE_IO;
+  return TASK_ROLE_OTHER;
+}
+
+bool rtos_task_stack_free(TaskRole role, uint32_t& bytes) {
+  TaskHandle_t handle = nullptr;
+  switch (role) {
+    case TASK_ROLE_CONTROL: handle = controlTaskHandle; break;
+    case TASK_ROLE_NETWORK: handle = networkTaskHandle; break;
+    case TASK_ROLE_IO: handle = ioTaskHandle; break;
+    default: break;
+  }
+  if (handle == nullptr) return false;
+  bytes = uxTaskGetStackHighWaterMark(handle);
+  return true;
+}
+
+/**
+ * @brief Menulis sisa stack minimum (byte) setiap task sebagai array JSON.
+ * @param key Nama field array di objek induk.
+ */
+void writeRtosTasksJson(JsonWriter& writer, const char* key) {
+  struct TaskInfo { const char* name; TaskHandle_t handle; int core; int priority; };
+  const TaskInfo tasks[] = {
+    {"control", controlTaskHandle, RTOS_CONTROL_CORE, RTOS_CONTROL_PRIORITY},
+    {"network", networkTaskHandle, RTOS_NETWORK_CORE, RTOS_NETWORK_PRIORITY},
+    {"io", ioTaskHandle, 1, 1}
+  };
+
+  writer.beginArray(key);
+  for (const TaskInfo& task : tasks) {
+    if (task.handle == nullptr) continue;
+    writer.beginObject()
+      .field("name", task.name)
+      .field("core", task.core)
+      .field("priority", task.priority)
+      .field("stackFree", (unsigned long)uxTaskGetStackHighWaterMark(task.handle))
+      .endObject();
+  }
+  writer.endArray();
+}
@@ -0,0 +1,46 @@
+#ifndef RTOS_TASKS_H
+#define RTOS_TASKS_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+#include "components/scheduler/scheduler.h"
+
+// --- Konfigurasi Task FreeRTOS ---
+// Core 1 (APP_CPU) menjalankan loopTask Arduino; WiFi & lwIP berjalan di core 0 (PRO_CPU).
+// Task kontrol dipasang di core 1 dengan prioritas di atas loopTask, sehingga I/O lambat
+// (pulseIn sensor jarak, DHT, SPI RFID, LCD) tidak pernah menunda polling tombol & motor.
+// Task jaringan dipasang di core 0 bersama stack WiFi, sehingga beban jaringan tidak
+// mengambil waktu CPU dari core kontrol.
+#define RTOS_CONTROL_CORE 1
+#define RTOS_CONTROL_PRIORITY 5       // loopTask = 1, AsyncTCP = 3
+#define RTOS_CONTROL_STACK_SIZE 4096
+#define RTOS_NETWORK_CORE 0
+#define RTOS_NETWORK_PRIORITY 2
+#define RTOS_NETWORK_STACK_SIZE 6144  // Serialisasi JSON memakai buffer stack event/balasan
+#define RTOS_MAX_IDLE_MS 20           // Batas tidur task grup, agar task one-shot yang
+                                      // didaftarkan dari task lain tetap cepat terlihat
+
+// Peran task pemanggil, dipakai untuk memilih antrean SPSC milik producer
+enum TaskRole : uint8_t {
+  TASK_ROLE_CONTROL = 0, // Task "control" (SCHED_GROUP_CONTROL)
+  TASK_ROLE_NETWORK,     // Task "network" (SCHED_GROUP_NETWORK)
+  TASK_ROLE_IO,          // loopTask Arduino (SCHED_GROUP_IO, termasuk setup())
+  TASK_ROLE_OTHER,       // Task lain, mis. AsyncTCP (handler WebSocket & REST)
+  TASK_ROLE_COUNT
+};
+
+// --- Prototipe Fungsi Task RTOS ---
+// Dipanggil di awal setup(): mencatat loopTask sebagai task IO
+void setupRtosTasks();
+// Dipanggil di akhir setup(): membuat task kontrol & jaringan
+bool startRtosTasks();
+// Dipanggil dari loop(): satu putaran grup IO lalu tidur sampai task berikutnya jatuh tempo
+void runIoTaskPass();
+
+TaskRole rtos_current_role();
+// Sisa stack minimum (byte) task control/network/io; false jika task belum dibuat
+bool rtos_task_stack_free(TaskRole role, uint32_t& bytes);
+
+void writeRtosTasksJson(JsonWriter& writer, const char* key);
+
+#endif // RTOS_TASKS_H
@@ -0,0 +1,47 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// --- Snapshot Atomik dengan Sequence Lock ---
+// Satu task penulis mempublikasikan salinan lengkap sebuah struct; task lain membaca
+// salinan yang konsisten tanpa pernah memblokir penulis. Nomor urut ganjil berarti
+// penulisan sedang berlangsung, sehingga pembaca mengulang jika nomor urut ganjil
+// atau berubah selama penyalinan. T harus trivially copyable (tanpa String/pointer heap).
+template <typename T>
+class SeqLock {
+public:
+  SeqLock() : sequence(0), value() {}
+
+  // Dipanggil hanya oleh satu task penulis
+  void write(const T& next) {
+    uint32_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy((void*)&value, &next, sizeof(T));
+    sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  // Aman dari task mana pun, mengembalikan salinan dari satu publikasi yang utuh
+  T read() const {
+    T copy;
+    uint32_t before, after;
+    do {
+      before = sequence.load(std::memory_order_acquire);
+      memcpy(&copy, (const void*)&value, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      after = sequence.load(std::memory_order_relaxed);
+    } while ((before & 1) != 0 || before != after);
+    return copy;
+  }
+
+  // Jumlah publikasi sejak boot (berguna untuk mendeteksi perubahan)
+  uint32_t version() const { return sequence.load(std::memory_order_acquire) / 2; }
+
+private:
+  std::atomic<uint32_t> sequence;
+  volatile T value;
+};
+
+#endif // SEQLOCK_H
@@ -0,0 +1,58 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// --- Antrean Lock-Free Single-Producer/Single-Consumer ---
+// Ring buffer berkapasitas tetap untuk mengirim data antar task FreeRTOS tanpa
+// critical section. Aman hanya jika push() selalu dipanggil dari satu task yang
+// sama dan pop() dari satu task lain yang sama. Satu slot dikorbankan untuk
+// membedakan antrean penuh dan kosong, sehingga kapasitas efektif = N - 1.
+template <typename T, size_t N>
+class SpscQueue {
+  static_assert(N >= 2, "SpscQueue membutuhkan minimal 2 slot");
+
+public:
+  SpscQueue() : head(0), tail(0), dropped(0) {}
+
+  // Dipanggil hanya oleh producer. false (dan dihitung) jika antrean penuh.
+  bool push(const T& item) {
+    size_t currentTail = tail.load(std::memory_order_relaxed);
+    size_t nextTail = (currentTail + 1) % N;
+    if (nextTail == head.load(std::memory_order_acquire)) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    items[currentTail] = item;
+    tail.store(nextTail, std::memory_order_release); // Item terlihat oleh consumer setelah ini
+    return true;
+  }
+
+  // Dipanggil hanya oleh consumer. false jika antrean kosong.
+  bool pop(T& item) {
+    size_t currentHead = head.load(std::memory_order_relaxed);
+    if (currentHead == tail.load(std::memory_order_acquire)) return false;
+    item = items[currentHead];
+    head.store((currentHead + 1) % N, std::memory_order_release); // Slot boleh ditulis ulang
+    return true;
+  }
+
+  // Perkiraan jumlah item (tepat jika dipanggil dari producer atau consumer)
+  size_t size() const {
+    size_t h = head.load(std::memory_order_acquire);
+    size_t t = tail.load(std::memory_order_acquire);
+    return (t + N - h) % N;
+  }
+
+  size_t capacity() const { return N - 1; }
+  unsigned long droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+  T items[N];
+  std::atomic<size_t> head;   // Indeks item berikutnya yang dibaca (milik consumer)
+  std::atomic<size_t> tail;   // Indeks slot berikutnya yang ditulis (milik producer)
+  std::atomic<unsigned long> dropped;
+};
+
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,285 @@
+/*
+  src/components/scheduler/scheduler.cpp - Implementasi Scheduler Kooperatif
+  Menggantikan pengecekan interval millis() yang tersebar di loop() dan komponen.
+  Setiap komponen mendaftarkan task periodik di fungsi setup-nya, dan proses yang
+  dulu memakai delay() (proses seduh, reset UID RFID) dipecah menjadi task one-shot.
+  Task dikelompokkan per grup eksekusi; setiap grup dijalankan oleh satu task FreeRTOS
+  yang memanggil scheduler_run(group) dan menjalankan task jatuh tempo menurut
+  prioritas & deadline sambil mencatat waktu eksekusi dan keterlambatan tiap task.
+  Tabel task dipakai bersama oleh semua grup, sehingga setiap akses ke tabel dilindungi
+  schedulerMux. Callback sendiri selalu dijalankan di luar critical section.
+*/
+
+#include "scheduler.h"
+
+SchedulerLoopStats schedulerLoopStats[SCHED_GROUP_COUNT] = {};
+
+// Nama grup (indeks = SchedulerGroup)
+static const char* const SCHEDULER_GROUP_NAMES[SCHED_GROUP_COUNT] = {
+  "control",
+  "network",
+  "io"
+};
+
+// --- Tabel Task ---
+struct SchedulerSlot {
+  bool used;
+  uint8_t generation;        // Bertambah setiap slot dipakai ulang, agar ID lama tidak valid
+  TaskCallback callback;
+  unsigned long nextRunMs;   // Jadwal mulai berikutnya
+  unsigned long deadlineMs;  // Batas keterlambatan mulai sebelum dihitung sebagai miss
+  SchedulerTaskStats stats;
+};
+static SchedulerSlot taskSlots[SCHEDULER_MAX_TASKS];
+static portMUX_TYPE schedulerMux = portMUX_INITIALIZER_UNLOCKED;
+
+// ID task = generation << 8 | indeks slot
+static int makeTaskId(int index) {
+  return (taskSlots[index].generation << 8) | index;
+}
+
+// Harus dipanggil di dalam schedulerMux
+static SchedulerSlot* findTask(int taskId) {
+  if (taskId < 0) return nullptr;
+  int index = taskId & 0xFF;
+  if (index >= SCHEDULER_MAX_TASKS) return nullptr;
+  SchedulerSlot& slot = taskSlots[index];
+  if (!slot.used || slot.generation != (uint8_t)(taskId >> 8)) return nullptr;
+  return &slot;
+}
+
+static int addTask(const char* name, TaskCallback callback, unsigned long periodMs, unsigned long delayMs,
+                   TaskPriority priority, SchedulerGroup group, bool oneShot, unsigned long deadlineMs) {
+  if (callback == nullptr || group >= SCHED_GROUP_COUNT) return -1;
+  int taskId = -1;
+  portENTER_CRITICAL(&schedulerMux);
+  for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+    SchedulerSlot& slot = taskSlots[i];
+    if (slot.used) continue;
+
+    uint8_t generation = slot.generation + 1;
+    slot = SchedulerSlot();
+    slot.used = true;
+    slot.generation = generation;
+    slot.callback = callback;
+    slot.nextRunMs = millis() + delayMs;
+    slot.deadlineMs = deadlineMs != 0 ? deadlineMs : periodMs;
+    slot.stats.name = name;
+    slot.stats.priority = priority;
+    slot.stats.group = group;
+    slot.stats.oneShot = oneShot;
+    slot.stats.periodMs = periodMs;
+    taskId = makeTaskId(i);
+    break;
+  }
+  portEXIT_CRITICAL(&schedulerMux);
+
+  if (taskId < 0) Serial.printf("[SCHEDULER] Tabel task penuh, task '%s' tidak didaftarkan.\n", name);
+  return taskId;
+}
+
+/**
+ * @brief Mendaftarkan task periodik. Eksekusi pertama pada putaran grup berikutnya.
+ * @param periodMs Periode task, 0 = dijalankan setiap putaran.
+ * @param group Grup (task FreeRTOS) yang menjalankan callback.
+ * @param deadlineMs Keterlambatan mulai maksimum yang diterima (0 = satu periode).
+ * @return ID task, atau -1 jika tabel penuh.
+ */
+int scheduler_add_periodic(const char* name, TaskCallback callback, unsigned long periodMs,
+                           TaskPriority priority, SchedulerGroup group, unsigned long deadlineMs) {
+  return addTask(name, callback, periodMs, 0, priority, group, false, deadlineMs);
+}
+
+/**
+ * @brief Mendaftarkan task yang dijalankan sekali setelah delayMs, lalu dihapus.
+ * @return ID task, atau -1 jika tabel penuh.
+ */
+int scheduler_add_oneshot(const char* name, TaskCallback callback, unsigned long delayMs,
+                          TaskPriority priority, SchedulerGroup group) {
+  return addTask(name, callback, 0, delayMs, priority, group, true, 0);
+}
+
+bool scheduler_cancel(int taskId) {
+  portENTER_CRITICAL(&schedulerMux);
+  SchedulerSlot* slot = findTask(taskId);
+  if (slot != nullptr) slot->used = false;
+  portEXIT_CRITICAL(&schedulerMux);
+  return slot != nullptr;
+}
+
+bool scheduler_reschedule(int taskId, unsigned long delayMs) {
+  portENTER_CRITICAL(&schedulerMux);
+  SchedulerSlot* slot = findTask(taskId);
+  if (slot != nullptr) slot->nextRunMs = millis() + delayMs;
+  portEXIT_CRITICAL(&schedulerMux);
+  return slot != nullptr;
+}
+
+bool scheduler_set_period(int taskId, unsigned long periodMs) {
+  bool ok = false;
+  portENTER_CRITICAL(&schedulerMux);
+  SchedulerSlot* slot = findTask(taskId);
+  if (slot != nullptr && !slot->stats.oneShot) {
+    if (slot->stats.periodMs != periodMs) {
+      // Jadwal berikutnya dihitung ulang dari eksekusi terakhir dengan periode baru
+      slot->nextRunMs = slot->nextRunMs - slot->stats.periodMs + periodMs;
+      if (slot->deadlineMs == slot->stats.periodMs) slot->deadlineMs = periodMs;
+      slot->stats.periodMs = periodMs;
+    }
+    ok = true;
+  }
+  portEXIT_CRITICAL(&schedulerMux);
+  return ok;
+}
+
+// Urutan eksekusi: prioritas tertinggi dulu, lalu jadwal paling awal
+static bool runsBefore(const SchedulerSlot& a, const SchedulerSlot& b) {
+  if (a.stats.priority != b.stats.priority) return a.stats.priority < b.stats.priority;
+  return (long)(a.nextRunMs - b.nextRunMs) < 0;
+}
+
+/**
+ * @brief Menjalankan setiap task grup yang jatuh tempo tepat satu kali.
+ * Task yang ditambahkan selama putaran ini baru dijalankan pada putaran berikutnya.
+ * @param group Grup milik task FreeRTOS pemanggil.
+ * @param currentMillis Waktu awal putaran (millis()).
+ */
+void scheduler_run(SchedulerGroup group, unsigned long currentMillis) {
+  if (group >= SCHED_GROUP_COUNT) return;
+  uint32_t passStartUs = micros();
+
+  // Kumpulkan task jatuh tempo, diurutkan dengan insertion sort (tabel kecil)
+  int dueIds[SCHEDULER_MAX_TASKS];
+  int dueCount = 0;
+  portENTER_CRITICAL(&schedulerMux);
+  for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+    const SchedulerSlot& slot = taskSlots[i];
+    if (!slot.used || slot.stats.group != group || (long)(currentMillis - slot.nextRunMs) < 0) continue;
+    int pos = dueCount++;
+    while (pos > 0 && runsBefore(slot, taskSlots[dueIds[pos - 1] & 0xFF])) {
+      dueIds[pos] = dueIds[pos - 1];
+      pos--;
+    }
+    dueIds[pos] = makeTaskId(i);
+  }
+  portEXIT_CRITICAL(&schedulerMux);
+
+  for (int i = 0; i < dueCount; i++) {
+    unsigned long startMillis = millis();
+    unsigned long lateness = 0;
+    TaskCallback callback = nullptr;
+
+    portENTER_CRITICAL(&schedulerMux);
+    SchedulerSlot* slot = findTask(dueIds[i]);
+    if (slot != nullptr) { // nullptr = dibatalkan oleh task sebelumnya atau task lain
+      lateness = startMillis - slot->nextRunMs;
+      callback = slot->callback;
+      if (slot->stats.oneShot) {
+        slot->used = false; // Slot bebas sebelum callback, agar callback bisa menjadwalkan lanjutan
+      } else {
+        slot->nextRunMs += slot->stats.periodMs;
+        // Jika tertinggal lebih dari satu periode, lewati eksekusi yang terlewat (tanpa burst)
+        if ((long)(startMillis - slot->nextRunMs) >= 0) slot->nextRunMs = startMillis + slot->stats.periodMs;
+      }
+    }
+    portEXIT_CRITICAL(&schedulerMux);
+    if (callback == nullptr) continue;
+
+    uint32_t startUs = micros();
+    callback(startMillis);
+    uint32_t elapsedUs = micros() - startUs;
+
+    // One-shot tetap dicatat di putaran terakhirnya selama slotnya belum dipakai ulang
+    portENTER_CRITICAL(&schedulerMux);
+    SchedulerSlot& stats = taskSlots[dueIds[i] & 0xFF];
+    if (stats.generation == (uint8_t)(dueIds[i] >> 8)) {
+      stats.stats.runs++;
+      stats.stats.totalUs += elapsedUs;
+      if (elapsedUs > stats.stats.maxUs) stats.stats.maxUs = elapsedUs;
+      if (lateness > stats.stats.maxLatenessMs) stats.stats.maxLatenessMs = lateness;
+      if (stats.deadlineMs > 0 && lateness > stats.deadlineMs) stats.stats.deadlineMisses++;
+    }
+    portEXIT_CRITICAL(&schedulerMux);
+  }
+
+  // Statistik putaran hanya ditulis oleh task pemilik grup
+  uint32_t passUs = micros() - passStartUs;
+  SchedulerLoopStats& loopStats = schedulerLoopStats[group];
+  loopStats.passes++;
+  if (passUs > loopStats.maxPassUs) loopStats.maxPassUs = passUs;
+}
+
+/**
+ * @brief Menghitung berapa lama task pemilik grup boleh tidur sebelum putaran berikutnya.
+ * Task yang dijadwalkan dari task lain selama tidur baru terlihat setelah tidur selesai,
+ * sehingga maxWaitMs sekaligus menjadi batas latensi untuk task baru tersebut.
+ * @return 0 jika ada task yang sudah jatuh tempo.
+ */
+unsigned long scheduler_next_wait(SchedulerGroup group, unsigned long currentMillis, unsigned long maxWaitMs) {
+  unsigned long wait = maxWaitMs;
+  portENTER_CRITICAL(&schedulerMux);
+  for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+    const SchedulerSlot& slot = taskSlots[i];
+    if (!slot.used || slot.stats.group != group) continue;
+    long remaining = (long)(slot.nextRunMs - currentMillis);
+    if (remaining <= 0) {
+      wait = 0;
+      break;
+    }
+    if ((unsigned long)remaining < wait) wait = (unsigned long)remaining;
+  }
+  portEXIT_CRITICAL(&schedulerMux);
+  return wait;
+}
+
+const char* scheduler_group_name(SchedulerGroup group) {
+  if (group >= SCHED_GROUP_COUNT) return "unknown";
+  return SCHEDULER_GROUP_NAMES[group];
+}
+
+size_t scheduler_get_stats(SchedulerTaskStats* out, size_t maxTasks) {
+  size_t count = 0;
+  portENTER_CRITICAL(&schedulerMux);
+  for (int i = 0; i < SCHEDULER_MAX_TASKS && count < maxTasks; i++) {
+    if (taskSlots[i].used) out[count++] = taskSlots[i].stats;
+  }
+  portEXIT_CRITICAL(&schedulerMux);
+  return count;
+}
+
+/**
+ * @brief Menulis statistik putaran per grup dan semua task aktif sebagai objek JSON.
+ * Statistik disalin dulu, agar JsonWriter tidak dipanggil di dalam critical section.
+ * @param key Nama field objek di objek induk.
+ */
+void writeSchedulerJson(JsonWriter& writer, const char* key) {
+  SchedulerTaskStats tasks[SCHEDULER_MAX_TASKS];
+  size_t count = scheduler_get_stats(tasks, SCHEDULER_MAX_TASKS);
+
+  writer.beginObject(key);
+  writer.beginArray("groups");
+  for (int g = 0; g < SCHED_GROUP_COUNT; g++) {
+    writer.beginObject()
+      .field("name", SCHEDULER_GROUP_NAMES[g])
+      .field("passes", schedulerLoopStats[g].passes)
+      .field("maxPassUs", (unsigned long)schedulerLoopStats[g].maxPassUs)
+      .endObject();
+  }
+  writer.endArray();
+  writer.beginArray("tasks");
+  for (size_t i = 0; i < count; i++) {
+    const SchedulerTaskStats& stats = tasks[i];
+    writer.beginObject()
+      .field("name", stats.name)
+      .field("group", SCHEDULER_GROUP_NAMES[stats.group])
+      .field("pri", (int)stats.priority)
+      .field("period", stats.periodMs)
+      .field("runs", stats.runs)
+      .field("avgUs", stats.runs > 0 ? (unsigned long)(stats.totalUs / stats.runs) : 0UL)
+      .field("maxUs", (unsigned long)stats.maxUs)
+      .field("lateMs", stats.maxLatenessMs)
+      .field("misses", stats.deadlineMisses)
+      .endObject();
+  }
+  writer.endArray().endObject();
+}
@@ -0,0 +1,73 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+
+// --- Konfigurasi Scheduler ---
+#define SCHEDULER_MAX_TASKS 20 // Jumlah maksimum task (periodik + one-shot) sekaligus
+
+// Prioritas task. Dalam satu putaran, task yang jatuh tempo dijalankan dari
+// prioritas tertinggi, lalu dari deadline yang paling awal.
+enum TaskPriority : uint8_t {
+  TASK_PRIORITY_HIGH = 0,  // Kontrol mesin (tombol, proses seduh)
+  TASK_PRIORITY_NORMAL,    // Jaringan & RFID
+  TASK_PRIORITY_LOW        // Sensor lambat & tampilan
+};
+
+// Grup eksekusi. Setiap grup dijalankan oleh satu task FreeRTOS (lihat modul
+// 'rtos_tasks'), sehingga callback dalam satu grup tidak pernah berjalan bersamaan.
+enum SchedulerGroup : uint8_t {
+  SCHED_GROUP_CONTROL = 0, // Task kontrol: tombol, menu, proses seduh, motor
+  SCHED_GROUP_NETWORK,     // Task jaringan: WebSocket, topik, cache REST
+  SCHED_GROUP_IO,          // loopTask: sensor, RFID, DHT, LCD
+  SCHED_GROUP_COUNT
+};
+
+// Callback task. Dijalankan oleh task grupnya, harus singkat dan tidak boleh memanggil delay().
+typedef void (*TaskCallback)(unsigned long currentMillis);
+
+// Statistik per task
+struct SchedulerTaskStats {
+  const char* name;
+  TaskPriority priority;
+  SchedulerGroup group;
+  bool oneShot;
+  unsigned long periodMs;      // 0 = dijalankan setiap putaran scheduler
+  unsigned long runs;
+  uint64_t totalUs;            // Total waktu eksekusi (64 bit, tidak wrap selama uptime)
+  uint32_t maxUs;              // Waktu eksekusi terlama
+  unsigned long maxLatenessMs; // Keterlambatan mulai terbesar dari jadwal
+  unsigned long deadlineMisses;
+};
+
+// Statistik putaran scheduler per grup (satu kali scheduler_run())
+struct SchedulerLoopStats {
+  unsigned long passes;
+  uint32_t maxPassUs;          // Durasi putaran terlama = batas jitter untuk task dalam grup
+};
+extern SchedulerLoopStats schedulerLoopStats[SCHED_GROUP_COUNT];
+
+// --- Prototipe Fungsi Scheduler ---
+// Semua fungsi aman dipanggil dari task mana pun; tabel task dilindungi critical section.
+// Mengembalikan ID task, atau -1 jika tabel task penuh.
+// deadlineMs = batas keterlambatan mulai yang masih diterima (0 = sama dengan periode).
+int scheduler_add_periodic(const char* name, TaskCallback callback, unsigned long periodMs,
+                           TaskPriority priority, SchedulerGroup group, unsigned long deadlineMs = 0);
+int scheduler_add_oneshot(const char* name, TaskCallback callback, unsigned long delayMs,
+                          TaskPriority priority, SchedulerGroup group);
+bool scheduler_cancel(int taskId);
+bool scheduler_reschedule(int taskId, unsigned long delayMs); // Jadwalkan ulang dari sekarang
+bool scheduler_set_period(int taskId, unsigned long periodMs);
+
+// Menjalankan semua task grup yang jatuh tempo, satu kali masing-masing.
+// Hanya boleh dipanggil oleh task pemilik grup.
+void scheduler_run(SchedulerGroup group, unsigned long currentMillis);
+// Waktu tunggu (ms) sampai task grup berikutnya jatuh tempo, dibatasi maxWaitMs
+unsigned long scheduler_next_wait(SchedulerGroup group, unsigned long currentMillis, unsigned long maxWaitMs);
+const char* scheduler_group_name(SchedulerGroup group);
+
+size_t scheduler_get_stats(SchedulerTaskStats* out, size_t maxTasks);
+void writeSchedulerJson(JsonWriter& writer, const char* key);
+
+#endif // SCHEDULER_H
@@ -6,7 +6,8 @@
 */
 
 #include "storage_detector.h" // Memasukkan file header modul ini
-#include <Arduino.h>          // Diperlukan untuk fungsi Arduino seperti pinMode, digitalWrite, pulseIn, Serial.println
+#include "components/hal/hal.h" // GPIO & jeda mikrodetik lewat HAL (ESP32 atau host)
+#include "components/logger/logger.h"
 
 // --- Definisi Pin Aktual untuk Sensor Ultrasonik HC-SR04 ---
 // Pin-pin ini harus sesuai dengan koneksi fisik HC-SR04 ke ESP32.
@@ -32,21 +33,21 @@ const int SD_ECHO_PIN_3 = 36; // Pin Echo HC-SR04 #3
  */
 void storage_detector_init_all_sensors() {
     // Inisialisasi pin untuk HC-SR04 #1
-    pinMode(SD_TRIG_PIN_1, OUTPUT);
-    pinMode(SD_ECHO_PIN_1, INPUT);
-    Serial.println("[STORAGE_DETECTOR] Sensor 1 (Trig:" + String(SD_TRIG_PIN_1) + ", Echo:" + String(SD_ECHO_PIN_1) + ") diinisialisasi.");
+    hal_gpio_mode(SD_TRIG_PIN_1, OUTPUT);
+    hal_gpio_mode(SD_ECHO_PIN_1, INPUT);
+    Serial.printf("[STORAGE_DETECTOR] Sensor 1 (Trig:%d, Echo:%d) diinisialisasi.\n", SD_TRIG_PIN_1, SD_ECHO_PIN_1);
 
     // Inisialisasi pin untuk HC-SR04 #2
-    digitalWrite(SD_TRIG_PIN_2, LOW); // Pastikan LOW sebelum pinMode agar tidak ada pulsa awal
-    pinMode(SD_TRIG_PIN_2, OUTPUT);
-    pinMode(SD_ECHO_PIN_2, INPUT);
-    Serial.println("[STORAGE_DETECTOR] Sensor 2 (Trig:" + String(SD_TRIG_PIN_2) + ", Echo:" + String(SD_ECHO_PIN_2) + ") diinisialisasi.");
+    hal_gpio_write(SD_TRIG_PIN_2, LOW); // Pastikan LOW sebelum mode OUTPUT agar tidak ada pulsa awal
+    hal_gpio_mode(SD_TRIG_PIN_2, OUTPUT);
+    hal_gpio_mode(SD_ECHO_PIN_2, INPUT);
+    Serial.printf("[STORAGE_DETECTOR] Sensor 2 (Trig:%d, Echo:%d) diinisialisasi.\n", SD_TRIG_PIN_2, SD_ECHO_PIN_2);
 
     // Inisialisasi pin untuk HC-SR04 #3
-    digitalWrite(SD_TRIG_PIN_3, LOW); // Pastikan LOW sebelum pinMode agar tidak ada pulsa awal
-    pinMode(SD_TRIG_PIN_3, OUTPUT);
-    pinMode(SD_ECHO_PIN_3, INPUT);
-    Serial.println("[STORAGE_DETECTOR] Sensor 3 (Trig:" + String(SD_TRIG_PIN_3) + ", Echo:" + String(SD_ECHO_PIN_3) + ") diinisialisasi.");
+    hal_gpio_write(SD_TRIG_PIN_3, LOW); // Pastikan LOW sebelum mode OUTPUT agar tidak ada pulsa awal
+    hal_gpio_mode(SD_TRIG_PIN_3, OUTPUT);
+    hal_gpio_mode(SD_ECHO_PIN_3, INPUT);
+    Serial.printf("[STORAGE_DETECTOR] Sensor 3 (Trig:%d, Echo:%d) diinisialisasi.\n", SD_TRIG_PIN_3, SD_ECHO_PIN_3);
 
     Serial.println("[STORAGE_DETECTOR] Semua Sensor Detektor Penyimpanan berhasil diinisialisasi.");
 }
@@ -61,71 +62,97 @@ void storage_detector_init_all_sensors() {
  */
 long storage_detector_get_distance(int trigPin, int echoPin) {
     // Memastikan pin TRIG dalam keadaan LOW sebelum memulai pengukuran
-    digitalWrite(trigPin, LOW);
-    delayMicroseconds(2); // Menunggu 2 mikrosekon untuk memastikan pin LOW
+    hal_gpio_write(trigPin, LOW);
+    hal_delay_us(2); // Menunggu 2 mikrosekon untuk memastikan pin LOW
 
     // Mengirim pulsa HIGH selama 10 mikrosekon pada pin TRIG
     // Ini akan memicu sensor untuk mengirim 8 siklus burst ultrasonik
-    digitalWrite(trigPin, HIGH);
-    delayMicroseconds(10);
-    digitalWrite(trigPin, LOW); // Menghentikan pulsa TRIG
+    hal_gpio_write(trigPin, HIGH);
+    hal_delay_us(10);
+    hal_gpio_write(trigPin, LOW); // Menghentikan pulsa TRIG
 
     // Mengukur durasi pulsa HIGH pada pin ECHO
     // Durasi ini adalah waktu yang dibutuhkan suara untuk pergi dan kembali
     // Timeout 30000 mikrosekon (30 ms) digunakan untuk menghindari hang jika tidak ada pantulan
     // 30 ms kira-kira setara dengan jarak 5 meter pulang-pergi.
-    long duration = pulseIn(echoPin, HIGH, 30000);
+    long duration = hal_gpio_pulse_in(echoPin, HIGH, 30000);
+    long distance = storage_detector_distance_from_echo(duration);
 
-    // Jika pulseIn mengembalikan 0, berarti terjadi timeout (tidak ada pantulan)
-    if (duration == 0) {
-        Serial.println("[STORAGE_DETECTOR] Sensor (Trig:" + String(trigPin) + ", Echo:" + String(echoPin) + ") Timeout: Tidak ada objek terdeteksi dalam jangkauan.");
+    // Jika hal_gpio_pulse_in mengembalikan 0, berarti terjadi timeout (tidak ada pantulan)
+    if (distance == -1) {
+        LOG_WARN(LOG_MSG_DISTANCE_TIMEOUT, trigPin, echoPin);
         return -1; // Mengembalikan -1 untuk menunjukkan error atau di luar jangkauan
     }
 
-    // Menghitung jarak berdasarkan durasi pulsa
-    // Kecepatan suara di udara adalah sekitar 343 meter/detik atau 0.0343 cm/mikrosekon
-    // Jarak = (Durasi * Kecepatan Suara) / 2 (karena suara pergi dan kembali)
-    long distance = duration * 0.034 / 2; // Menggunakan 0.034 cm/µs untuk penyederhanaan
-
-    // --- Output Debugging ke Serial Monitor ---
-    Serial.println("[STORAGE_DETECTOR] Sensor (Trig:" + String(trigPin) + ", Echo:" + String(echoPin) + ") Pengukuran: " + String(distance) + " cm");
-    // ------------------------------------------
+    // --- Output Debugging (level DEBUG, dibuang saat kompilasi secara default) ---
+    LOG_DEBUG(LOG_MSG_DISTANCE, trigPin, echoPin, distance);
 
     return distance; // Mengembalikan jarak yang terukur
 }
 
 /**
- * @brief Mendapatkan status stok kopi dalam bentuk teks.
- * Mengukur jarak menggunakan pin sensor yang diberikan dan menginterpretasikannya
- * menjadi pesan status "Stok Kopi Menipis/Habis" atau "Stok Tersedia".
- * @param trigPin Pin Trigger HC-SR04.
- * @param echoPin Pin Echo HC-SR04.
- * @return String yang berisi status stok kopi.
+ * @brief Mengubah lebar pulsa ECHO menjadi jarak.
+ * @param durationUs Lebar pulsa dalam mikrodetik, 0 jika timeout.
+ * @return Jarak dalam centimeter (cm), atau -1 jika timeout.
  */
-String getCoffeeStockStatus(int trigPin, int echoPin) {
-    long distance = storage_detector_get_distance(trigPin, echoPin); // Ambil jarak sensor kopi
+long storage_detector_distance_from_echo(long durationUs) {
+    if (durationUs == 0) return -1;
+
+    // Kecepatan suara di udara adalah sekitar 343 meter/detik atau 0.0343 cm/mikrosekon
+    // Jarak = (Durasi * Kecepatan Suara) / 2 (karena suara pergi dan kembali)
+    return durationUs * 0.034 / 2; // Menggunakan 0.034 cm/µs untuk penyederhanaan
+}
+
+// Teks status stok (indeks = CoffeeStockStatus)
+static const char* const COFFEE_STOCK_STATUS_TEXT[] = {
+    "Sensor Error/N/A",
+    "Stok Menipis/Habis",
+    "Stok Tersedia"
+};
 
-    // Threshold 12 cm untuk stok kopi: >=12cm menipis/habis, <12cm tersedia
+/**
+ * @brief Menginterpretasikan jarak sensor menjadi status stok kopi.
+ * @param distance Jarak dalam cm, atau -1 jika sensor timeout.
+ */
+CoffeeStockStatus coffeeStockStatusFromDistance(long distance) {
+    // Threshold 8 cm untuk stok kopi: >=8cm menipis/habis, <8cm tersedia
     const int COFFEE_STOCK_THRESHOLD = 8;
 
     if (distance == -1) {
-        return "Sensor Error/N/A";
+        return STOCK_SENSOR_ERROR;
     } else if (distance >= COFFEE_STOCK_THRESHOLD) {
-        return "Stok Menipis/Habis";
+        return STOCK_LOW;
     } else { // distance < COFFEE_STOCK_THRESHOLD
-        return "Stok Tersedia";
+        return STOCK_AVAILABLE;
     }
 }
 
+/**
+ * @brief Mendapatkan status stok kopi.
+ * Mengukur jarak menggunakan pin sensor yang diberikan dan menginterpretasikannya
+ * menjadi status "Stok Menipis/Habis" atau "Stok Tersedia".
+ * @param trigPin Pin Trigger HC-SR04.
+ * @param echoPin Pin Echo HC-SR04.
+ * @return Status stok kopi; teksnya dari coffeeStockStatusText().
+ */
+CoffeeStockStatus getCoffeeStockStatus(int trigPin, int echoPin) {
+    return coffeeStockStatusFromDistance(storage_detector_get_distance(trigPin, echoPin));
+}
+
+const char* coffeeStockStatusText(CoffeeStockStatus status) {
+    if (status > STOCK_AVAILABLE) return "Unknown";
+    return COFFEE_STOCK_STATUS_TEXT[status];
+}
+
 // Fungsi getCoffeeStockStatus() yang spesifik untuk setiap sensor
-String getCoffee1StockStatus() {
+CoffeeStockStatus getCoffee1StockStatus() {
     return getCoffeeStockStatus(SD_TRIG_PIN_1, SD_ECHO_PIN_1);
 }
 
-String getCoffee2StockStatus() {
+CoffeeStockStatus getCoffee2StockStatus() {
     return getCoffeeStockStatus(SD_TRIG_PIN_2, SD_ECHO_PIN_2);
 }
 
-String getCoffee3StockStatus() {
+CoffeeStockStatus getCoffee3StockStatus() {
     return getCoffeeStockStatus(SD_TRIG_PIN_3, SD_ECHO_PIN_3);
 }
\ No newline at end of file
@@ -14,14 +14,24 @@ extern const int SD_ECHO_PIN_3;
 // --- Deklarasi Fungsi Modul ---
 void storage_detector_init_all_sensors();
 long storage_detector_get_distance(int trigPin, int echoPin);
+long storage_detector_distance_from_echo(long durationUs); // Lebar pulsa ECHO (µs) -> cm, -1 = timeout
+
+// --- Status Stok Kopi ---
+enum CoffeeStockStatus : uint8_t {
+  STOCK_SENSOR_ERROR = 0, // Timeout sensor (tidak ada pantulan)
+  STOCK_LOW,              // Jarak >= ambang: stok menipis/habis
+  STOCK_AVAILABLE
+};
 
-// --- Deklarasi Fungsi untuk Status Teks Kopi ---
 // Fungsi general untuk mendapatkan status stok kopi
-String getCoffeeStockStatus(int trigPin, int echoPin);
+CoffeeStockStatus coffeeStockStatusFromDistance(long distance);
+CoffeeStockStatus getCoffeeStockStatus(int trigPin, int echoPin);
+// Teks status (string statis, aman disimpan atau dikirim tanpa salinan)
+const char* coffeeStockStatusText(CoffeeStockStatus status);
 
 // Fungsi spesifik untuk setiap sensor kopi
-String getCoffee1StockStatus(); // <--- Diperbarui
-String getCoffee2StockStatus(); // <--- Diperbarui
-String getCoffee3StockStatus(); // <--- Diperbarui
+CoffeeStockStatus getCoffee1StockStatus();
+CoffeeStockStatus getCoffee2StockStatus();
+CoffeeStockStatus getCoffee3StockStatus();
 
 #endif // STORAGE_DETECTOR_H
\ No newline at end of file
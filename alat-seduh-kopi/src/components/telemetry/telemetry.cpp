@@ -0,0 +1,143 @@
+/*
+  src/components/telemetry/telemetry.cpp - Implementasi Komponen Telemetri
+  Mengumpulkan data sensor jarak terakhir dan menyusun semua pesan JSON yang
+  dikirim ke klien web (telemetri, antrean pesanan, diagnostik, snapshot, event).
+  Serializer dipanggil dari task jaringan & AsyncTCP, sehingga state mesin dibaca
+  dari snapshot 'machine_state', bukan dari variabel milik task kontrol/IO.
+*/
+
+#include "telemetry.h"
+#include "components/storage_detector/storage_detector.h"
+#include "components/rfid_card_reader/rfid_card_reader.h"
+#include "components/temperature_humidity/temperature_humidity.h"
+#include "components/order_coffee/order_coffee.h"
+#include "components/motor_control/motor_control.h"
+#include "components/machine_state/machine_state.h"
+#include "components/perf_probe/perf_probe.h"
+#include "components/i2c_scanner/i2c_scanner.h"
+
+// --- Definisi Variabel Global Data Sensor (ditulis oleh task IO) ---
+long telemetryDistance1 = 0;
+long telemetryDistance2 = 0;
+long telemetryDistance3 = 0;
+
+/**
+ * @brief Membaca ketiga sensor jarak dan menyimpan hasilnya.
+ * Nilai -1 (timeout) disimpan sebagai 0 agar sama dengan perilaku sebelumnya.
+ */
+void readTelemetrySensors() {
+    PERF_PROBE_SCOPE(PROBE_DISTANCE);
+    long distance1 = storage_detector_get_distance(SD_TRIG_PIN_1, SD_ECHO_PIN_1);
+    long distance2 = storage_detector_get_distance(SD_TRIG_PIN_2, SD_ECHO_PIN_2);
+    long distance3 = storage_detector_get_distance(SD_TRIG_PIN_3, SD_ECHO_PIN_3);
+
+    telemetryDistance1 = (distance1 == -1) ? 0 : distance1;
+    telemetryDistance2 = (distance2 == -1) ? 0 : distance2;
+    telemetryDistance3 = (distance3 == -1) ? 0 : distance3;
+}
+
+// --- Serializer Pesan WebSocket ---
+// Field data sensor, dipakai bersama oleh pesan telemetri dan snapshot
+static void writeTelemetryFields(JsonWriter& writer) {
+    SensorSnapshot sensors = machine_state_sensors();
+    writer.field("distance1", sensors.distance1)
+        .field("distance2", sensors.distance2)
+        .field("distance3", sensors.distance3)
+        .field("rfidUid", sensors.rfidUid)
+        .field("temperature", sensors.temperature, 1)
+        .field("humidity", sensors.humidity, 0);
+}
+
+static void writeActuatorArray(JsonWriter& writer, const uint8_t* speeds) {
+    writer.beginArray("actuators");
+    for (int i = 0; i < ACT_COUNT; i++) {
+        writer.value((long)speeds[i]);
+    }
+    writer.endArray();
+}
+
+void writeTelemetryJson(JsonWriter& writer) {
+    writer.beginObject().field("type", "telemetry");
+    writeTelemetryFields(writer);
+    writer.endObject();
+}
+
+/**
+ * @brief Menyusun snapshot seluruh state yang ditampilkan dashboard dalam satu pesan.
+ * Dikirim sebagai jawaban perintah "resync" setelah klien (re)connect.
+ * @param relayOn State relay web saat ini.
+ */
+void writeSnapshotJson(JsonWriter& writer, bool relayOn) {
+    ControlSnapshot control = machine_state_control();
+    writer.beginObject().field("type", "snapshot");
+
+    writer.beginObject("telemetry");
+    writeTelemetryFields(writer);
+    writer.endObject();
+
+    writer.field("relayState", relayOn)
+        .field("brewPhase", (int)control.brewPhase)
+        .field("brewPhaseName", brewPhaseName(control.brewPhase))
+        .field("menu", control.selectedMenu);
+
+    writeActuatorArray(writer, control.actuatorSpeeds);
+    writeI2cAddressArray(writer, "i2c");
+    writer.endObject();
+}
+
+/**
+ * @brief Menyusun pesan topik "orders": fase seduh dan isi antrean pesanan.
+ * Aman dipanggil dari task AsyncTCP (dipakai juga oleh GET /api/queue).
+ */
+void writeOrdersJson(JsonWriter& writer) {
+    QueuedOrder orders[ORDER_QUEUE_SIZE];
+    size_t count = getOrderQueue(orders, ORDER_QUEUE_SIZE);
+    unsigned long now = millis();
+    ControlSnapshot control = machine_state_control();
+
+    writer.beginObject()
+        .field("type", "orders")
+        .field("brewPhase", (int)control.brewPhase)
+        .field("brewPhaseName", brewPhaseName(control.brewPhase))
+        .field("menu", control.selectedMenu)
+        .field("capacity", ORDER_QUEUE_SIZE);
+    writer.beginArray("orders");
+    for (size_t i = 0; i < count; i++) {
+        writer.beginObject()
+            .field("ticket", (unsigned long)orders[i].ticket)
+            .field("menu", (int)orders[i].menuId)
+            .field("waitMs", now - orders[i].queuedAt)
+            .endObject();
+    }
+    writer.endArray().endObject();
+}
+
+/**
+ * @brief Menyusun pesan topik "diagnostics": heap, uptime, relay, aktuator, dan I2C.
+ * @param relayOn State relay web saat ini.
+ */
+void writeDiagnosticsJson(JsonWriter& writer, bool relayOn) {
+    ControlSnapshot control = machine_state_control();
+    writer.beginObject()
+        .field("type", "diagnostics")
+        .field("uptimeMs", millis())
+        .field("freeHeap", (unsigned long)ESP.getFreeHeap())
+        .field("minFreeHeap", (unsigned long)ESP.getMinFreeHeap())
+        .field("eventsPublished", event_bus_published_count())
+        .field("relayState", relayOn);
+    writeActuatorArray(writer, control.actuatorSpeeds);
+    writeI2cAddressArray(writer, "i2c");
+    writer.endObject();
+}
+
+void writeEventJson(JsonWriter& writer, const BusEvent& event, bool replayed) {
+    writer.beginObject()
+        .field("type", "event")
+        .field("event", event_bus_type_name(event.type))
+        .field("id", (int)event.id)
+        .field("value", (long)event.value)
+        .field("text", event.text)
+        .field("t", event.timestamp);
+    if (replayed) writer.field("replay", true);
+    writer.endObject();
+}
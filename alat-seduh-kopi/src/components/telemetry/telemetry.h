@@ -0,0 +1,30 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+#include "components/event_bus/event_bus.h"
+
+// --- Ukuran Buffer Serialisasi ---
+#define TELEMETRY_JSON_BUFFER_SIZE 256 // Buffer statis untuk pesan telemetri periodik
+#define EVENT_JSON_BUFFER_SIZE 128     // Buffer stack untuk satu pesan event
+#define SNAPSHOT_JSON_BUFFER_SIZE 512  // Buffer statis untuk snapshot state lengkap (resync)
+#define TOPIC_JSON_BUFFER_SIZE 384     // Buffer statis untuk pesan topik orders/diagnostics
+
+// --- Data Sensor Jarak Terakhir (diisi oleh readTelemetrySensors) ---
+extern long telemetryDistance1;
+extern long telemetryDistance2;
+extern long telemetryDistance3;
+
+// --- Prototipe Fungsi Telemetri ---
+void readTelemetrySensors();
+
+// Serializer pesan WebSocket (menulis ke JsonWriter, tanpa alokasi heap)
+void writeTelemetryJson(JsonWriter& writer);
+void writeSnapshotJson(JsonWriter& writer, bool relayOn);
+void writeOrdersJson(JsonWriter& writer);
+void writeDiagnosticsJson(JsonWriter& writer, bool relayOn);
+// replayed = event terjadi saat link WiFi turun dan dikirim ulang setelah link naik
+void writeEventJson(JsonWriter& writer, const BusEvent& event, bool replayed = false);
+
+#endif // TELEMETRY_H
@@ -1,5 +1,8 @@
 #include "temperature_humidity.h"
 #include "components/lcd_display/lcd_display.h" // Include LCD display header untuk update LCD
+#include "components/scheduler/scheduler.h"
+#include "components/perf_probe/perf_probe.h"
+#include "components/logger/logger.h"
 
 // Definisi objek DHT
 // Pastikan pin dan tipe sesuai dengan definisi di .h
@@ -9,47 +12,42 @@ DHT_Unified dht(DHT_PIN, DHT_TYPE);
 float currentTemperature = 0.0;
 float currentHumidity = 0.0;
 
-// Variabel untuk interval pembacaan (hanya di .cpp, tidak perlu extern)
-static unsigned long lastDHTReadMillis = 0;
-const long DHT_READ_INTERVAL = 5000; // Baca setiap 5 detik (5000 ms)
+// Interval pembacaan (dijadwalkan oleh task scheduler "dht")
+const unsigned long DHT_READ_INTERVAL = 5000; // Baca setiap 5 detik (5000 ms)
 
 void setupTemperatureHumidity() {
   dht.begin();
+  scheduler_add_periodic("dht", handleTemperatureHumidity, DHT_READ_INTERVAL, TASK_PRIORITY_LOW, SCHED_GROUP_IO);
+  // Tanpa delay: jika sensor belum siap saat pembacaan pertama task "dht", nilai
+  // tercatat NAN dan dibaca ulang DHT_READ_INTERVAL kemudian
   Serial.println("[DHT] DHT22 Sensor diinisialisasi.");
-  // Opsional: delay sebentar untuk memastikan sensor siap
-  delay(100);
 }
 
 void handleTemperatureHumidity(unsigned long currentMillis) {
-  // Hanya baca sensor jika sudah melewati interval yang ditentukan
-  if (currentMillis - lastDHTReadMillis >= DHT_READ_INTERVAL) {
-    lastDHTReadMillis = currentMillis;
-
-    Serial.println("[DHT] Membaca data sensor...");
-
-    // Baca kelembaban
-    sensors_event_t event;
-    dht.humidity().getEvent(&event);
-    if (isnan(event.relative_humidity)) {
-      Serial.println("[DHT] GAGAL membaca kelembaban dari sensor DHT!");
-      currentHumidity = NAN; // Set ke NAN jika gagal
-    } else {
-      currentHumidity = event.relative_humidity;
-      Serial.print("[DHT] Kelembaban: ");
-      Serial.print(currentHumidity, 0); // Tampilkan tanpa desimal di Serial
-      Serial.println(" %");
-    }
+  PERF_PROBE_SCOPE(PROBE_DHT);
+  // Dipanggil oleh task "dht" setiap DHT_READ_INTERVAL
+
+  // Baca kelembaban
+  sensors_event_t event;
+  dht.humidity().getEvent(&event);
+  if (isnan(event.relative_humidity)) {
+    LOG_WARN(LOG_MSG_DHT_HUMIDITY_FAIL);
+    currentHumidity = NAN; // Set ke NAN jika gagal
+  } else {
+    currentHumidity = event.relative_humidity;
+    LOG_INFO(LOG_MSG_DHT_HUMIDITY, (int)lroundf(currentHumidity)); // Tanpa desimal
+  }
 
-    // Baca suhu
-    dht.temperature().getEvent(&event);
-    if (isnan(event.temperature)) {
-      Serial.println("[DHT] GAGAL membaca suhu dari sensor DHT!");
-      currentTemperature = NAN; // Set ke NAN jika gagal
-    } else {
-      currentTemperature = event.temperature;
-      Serial.print("[DHT] Suhu: ");
-      Serial.print(currentTemperature, 1); // Tampilkan dengan 1 desimal di Serial
-      Serial.println(" °C");
-    }
+  // Baca suhu
+  dht.temperature().getEvent(&event);
+  if (isnan(event.temperature)) {
+    LOG_WARN(LOG_MSG_DHT_TEMPERATURE_FAIL);
+    currentTemperature = NAN; // Set ke NAN jika gagal
+  } else {
+    currentTemperature = event.temperature;
+    // Logger tidak memformat float: suhu dicatat sebagai bagian bulat & satu desimal
+    long tenths = lroundf(currentTemperature * 10.0f);
+    long magnitude = tenths < 0 ? -tenths : tenths;
+    LOG_INFO(LOG_MSG_DHT_TEMPERATURE, tenths < 0 ? "-" : "", magnitude / 10, magnitude % 10);
   }
-}
\ No newline at end of file
+}
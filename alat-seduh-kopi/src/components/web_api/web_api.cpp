@@ -0,0 +1,298 @@
+/*
+  src/components/web_api/web_api.cpp - Implementasi REST API Mesin Kopi
+  Endpoint HTTP ringan di samping WebSocket, agar sistem kasir (POS) bisa memesan
+  dan membaca status tanpa menahan koneksi WebSocket:
+    GET  /api/status           - Snapshot state (format sama dengan pesan "snapshot")
+    POST /api/order?menu=<id>  - Antrekan pesanan (parameter query atau form)
+    GET  /api/queue            - Isi antrean pesanan & fase seduh saat ini
+    GET  /api/metrics          - Statistik WebSocket (per klien), aset, REST, pesanan, heap, tahap boot, WiFi & logger
+    GET  /api/tasks            - Waktu eksekusi & keterlambatan per task scheduler
+    GET  /api/i2c              - Clock bus I2C & statistik transaksi per perangkat
+    GET  /api/logs?since=<seq> - Record log mulai dari nomor urut seq ("next" untuk polling berikutnya)
+
+  Handler berjalan di task AsyncTCP. Respons disusun dengan JsonWriter ke slot
+  buffer statis (WEB_API_RESPONSE_SLOTS) dan dikirim langsung dari slot itu, tanpa
+  String atau alokasi buffer per request. Slot dibebaskan saat request selesai.
+  Snapshot status disusun berkala oleh handleWebApi() di task jaringan (dari snapshot
+  'machine_state'), dan handler hanya menyalin cache-nya.
+*/
+
+#include "web_api.h"
+#include "components/json_writer/json_writer.h"
+#include "components/order_coffee/order_coffee.h"
+#include "components/event_bus/event_bus.h"
+#include "components/ws_command/ws_command.h"
+#include "components/web_assets/web_assets.h"
+#include "components/ws_clients/ws_clients.h"
+#include "components/scheduler/scheduler.h"
+#include "components/rtos_tasks/rtos_tasks.h"
+#include "components/i2c_bus/i2c_bus.h"
+#include "components/boot_sequence/boot_sequence.h"
+#include "components/wifi_service/wifi_service.h"
+#include "components/logger/logger.h"
+#include "components/log_stream/log_stream.h"
+
+WebApiStats webApiStats = {0, 0, 0, 0, 0};
+
+// --- Slot Buffer Respons ---
+struct WebApiSlot {
+  bool used;
+  char buffer[WEB_API_RESPONSE_SIZE];
+};
+static WebApiSlot responseSlots[WEB_API_RESPONSE_SLOTS];
+static portMUX_TYPE responseSlotMux = portMUX_INITIALIZER_UNLOCKED;
+
+// --- Cache Snapshot Status (disusun di task jaringan, dibaca dari task AsyncTCP) ---
+static char statusStaging[WEB_API_RESPONSE_SIZE]; // Hanya dipakai dari task jaringan
+static char statusCache[WEB_API_RESPONSE_SIZE];
+static size_t statusCacheLen = 0;
+static portMUX_TYPE statusCacheMux = portMUX_INITIALIZER_UNLOCKED;
+static unsigned long lastStatusBuildMillis = 0;
+static unsigned long lastStatusEventCount = 0;
+
+static int acquireSlot() {
+  int index = -1;
+  portENTER_CRITICAL(&responseSlotMux);
+  for (int i = 0; i < WEB_API_RESPONSE_SLOTS; i++) {
+    if (!responseSlots[i].used) {
+      responseSlots[i].used = true;
+      index = i;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&responseSlotMux);
+  return index;
+}
+
+static void releaseSlot(int index) {
+  portENTER_CRITICAL(&responseSlotMux);
+  responseSlots[index].used = false;
+  portEXIT_CRITICAL(&responseSlotMux);
+}
+
+// Mengirim isi slot sebagai respons JSON. Slot tetap terpakai sampai request selesai,
+// karena server membaca isi respons secara bertahap dari buffer slot.
+static void sendSlotBuffer(AsyncWebServerRequest* request, int code, int index, size_t len) {
+  AsyncWebServerResponse* response = request->beginResponse_P(code, "application/json",
+      (const uint8_t*)responseSlots[index].buffer, len);
+  if (response == nullptr) {
+    releaseSlot(index);
+    request->send(500);
+    return;
+  }
+  response->addHeader("Cache-Control", "no-store");
+  request->onDisconnect([index]() { releaseSlot(index); });
+  request->send(response);
+  webApiStats.requests++;
+}
+
+static void sendSlot(AsyncWebServerRequest* request, int code, int index, const JsonWriter& writer) {
+  if (writer.overflowed()) {
+    releaseSlot(index);
+    request->send(500, "application/json", "{\"error\":\"overflow\"}");
+    return;
+  }
+  sendSlotBuffer(request, code, index, writer.length());
+}
+
+static void sendBusy(AsyncWebServerRequest* request) {
+  webApiStats.slotsExhausted++;
+  AsyncWebServerResponse* response = request->beginResponse(503, "application/json", "{\"error\":\"busy\"}");
+  if (response == nullptr) return;
+  response->addHeader("Retry-After", "1");
+  request->send(response);
+}
+
+// --- Handler Endpoint ---
+static void handleStatus(AsyncWebServerRequest* request) {
+  int index = acquireSlot();
+  if (index < 0) {
+    sendBusy(request);
+    return;
+  }
+  portENTER_CRITICAL(&statusCacheMux);
+  memcpy(responseSlots[index].buffer, statusCache, statusCacheLen + 1);
+  size_t len = statusCacheLen;
+  portEXIT_CRITICAL(&statusCacheMux);
+  if (len == 0) {
+    releaseSlot(index);
+    request->send(503, "application/json", "{\"error\":\"starting\"}");
+    return;
+  }
+  sendSlotBuffer(request, 200, index, len);
+}
+
+static void handleOrder(AsyncWebServerRequest* request) {
+  int index = acquireSlot();
+  if (index < 0) {
+    sendBusy(request);
+    return;
+  }
+  JsonWriter writer(responseSlots[index].buffer, WEB_API_RESPONSE_SIZE);
+  writer.beginObject();
+
+  // Menu bisa dikirim sebagai query (?menu=2) atau body form (menu=2)
+  const AsyncWebParameter* param = nullptr;
+  if (request->hasParam("menu", true)) param = request->getParam("menu", true);
+  else if (request->hasParam("menu")) param = request->getParam("menu");
+
+  long menuId = param != nullptr ? strtol(param->value().c_str(), nullptr, 10) : 0;
+  if (menuId < 1 || menuId > COFFEE_MENU_COUNT) {
+    webApiStats.ordersRejected++;
+    writer.field("ok", false).field("error", "invalidMenu").endObject();
+    sendSlot(request, 400, index, writer);
+    return;
+  }
+
+  uint32_t ticket = requestCoffeeOrder((int)menuId);
+  writer.field("menu", menuId);
+  if (ticket == 0) {
+    webApiStats.ordersRejected++;
+    writer.field("ok", false).field("error", "queueFull").endObject();
+    sendSlot(request, 503, index, writer);
+    return;
+  }
+  webApiStats.ordersAccepted++;
+  writer.field("ok", true).field("ticket", (unsigned long)ticket).endObject();
+  sendSlot(request, 202, index, writer);
+}
+
+static void handleQueue(AsyncWebServerRequest* request) {
+  int index = acquireSlot();
+  if (index < 0) {
+    sendBusy(request);
+    return;
+  }
+  JsonWriter writer(responseSlots[index].buffer, WEB_API_RESPONSE_SIZE);
+  writeOrdersJson(writer);
+  sendSlot(request, 200, index, writer);
+}
+
+static void handleMetrics(AsyncWebServerRequest* request) {
+  int index = acquireSlot();
+  if (index < 0) {
+    sendBusy(request);
+    return;
+  }
+  JsonWriter writer(responseSlots[index].buffer, WEB_API_RESPONSE_SIZE);
+  writer.beginObject()
+    .field("uptimeMs", millis())
+    .field("freeHeap", (unsigned long)ESP.getFreeHeap())
+    .field("minFreeHeap", (unsigned long)ESP.getMinFreeHeap())
+    .field("eventsPublished", event_bus_published_count());
+  writeBootJson(writer, "boot");
+  writeWifiJson(writer, "wifi");
+  writeLoggerJson(writer, "log");
+
+  writer.beginObject("ws")
+    .field("handled", wsCommandStats.handled)
+    .field("failed", wsCommandStats.failed)
+    .field("rejectedFrames", wsCommandStats.rejectedFrames)
+    .field("unknownCommands", wsCommandStats.unknownCommands);
+  writeWsClientsJson(writer, "clients");
+  writer.endObject();
+
+  writer.beginObject("assets")
+    .field("served", webAssetStats.served)
+    .field("notModified", webAssetStats.notModified)
+    .endObject();
+
+  writer.beginObject("api")
+    .field("requests", webApiStats.requests)
+    .field("ordersAccepted", webApiStats.ordersAccepted)
+    .field("ordersRejected", webApiStats.ordersRejected)
+    .field("slotsExhausted", webApiStats.slotsExhausted)
+    .field("statusRebuilds", webApiStats.statusRebuilds)
+    .endObject();
+
+  writer.beginArray("served");
+  for (int i = 1; i <= COFFEE_MENU_COUNT; i++) {
+    writer.value((long)coffeeOrdersServed[i]);
+  }
+  writer.endArray().endObject();
+  sendSlot(request, 200, index, writer);
+}
+
+static void handleTasks(AsyncWebServerRequest* request) {
+  int index = acquireSlot();
+  if (index < 0) {
+    sendBusy(request);
+    return;
+  }
+  JsonWriter writer(responseSlots[index].buffer, WEB_API_RESPONSE_SIZE);
+  writer.beginObject();
+  writeSchedulerJson(writer, "scheduler");
+  writeRtosTasksJson(writer, "rtos");
+  writer.endObject();
+  sendSlot(request, 200, index, writer);
+}
+
+static void handleI2c(AsyncWebServerRequest* request) {
+  int index = acquireSlot();
+  if (index < 0) {
+    sendBusy(request);
+    return;
+  }
+  JsonWriter writer(responseSlots[index].buffer, WEB_API_RESPONSE_SIZE);
+  writeI2cBusJson(writer);
+  sendSlot(request, 200, index, writer);
+}
+
+// Tanpa since (atau since yang sudah tertimpa) dimulai dari record tertua di ring buffer
+static void handleLogs(AsyncWebServerRequest* request) {
+  int index = acquireSlot();
+  if (index < 0) {
+    sendBusy(request);
+    return;
+  }
+  uint32_t since = 0;
+  if (request->hasParam("since")) since = strtoul(request->getParam("since")->value().c_str(), nullptr, 10);
+
+  JsonWriter writer(responseSlots[index].buffer, WEB_API_RESPONSE_SIZE);
+  writeLogBatchJson(writer, since, LOG_API_BATCH_MAX);
+  sendSlot(request, 200, index, writer);
+}
+
+/**
+ * @brief Mendaftarkan semua endpoint REST API ke server web.
+ * @param server Server web yang sama dengan WebSocket dan aset dashboard.
+ */
+void setupWebApi(AsyncWebServer& server) {
+  server.on("/api/status", HTTP_GET, handleStatus);
+  server.on("/api/order", HTTP_POST, handleOrder);
+  server.on("/api/queue", HTTP_GET, handleQueue);
+  server.on("/api/metrics", HTTP_GET, handleMetrics);
+  server.on("/api/tasks", HTTP_GET, handleTasks);
+  server.on("/api/i2c", HTTP_GET, handleI2c);
+  server.on("/api/logs", HTTP_GET, handleLogs);
+  Serial.println("[WEB_API] Endpoint /api/status, /api/order, /api/queue, /api/metrics, /api/tasks, /api/i2c, /api/logs siap.");
+}
+
+/**
+ * @brief Menyusun ulang cache /api/status jika ada event baru atau cache sudah lama.
+ * Dipanggil dari task jaringan, yang juga memiliki buffer staging.
+ * @param currentMillis Waktu saat ini (millis()).
+ * @param relayOn State relay web saat ini.
+ */
+void handleWebApi(unsigned long currentMillis, bool relayOn) {
+  unsigned long eventCount = event_bus_published_count();
+  if (statusCacheLen > 0 && eventCount == lastStatusEventCount &&
+      currentMillis - lastStatusBuildMillis < WEB_API_STATUS_REFRESH_MS) {
+    return;
+  }
+  lastStatusEventCount = eventCount;
+  lastStatusBuildMillis = currentMillis;
+
+  JsonWriter writer(statusStaging, sizeof(statusStaging));
+  writeSnapshotJson(writer, relayOn);
+  if (writer.overflowed()) {
+    Serial.println("[WEB_API] Snapshot status melebihi ukuran buffer, cache tidak diperbarui.");
+    return;
+  }
+
+  portENTER_CRITICAL(&statusCacheMux);
+  memcpy(statusCache, statusStaging, writer.length() + 1);
+  statusCacheLen = writer.length();
+  portEXIT_CRITICAL(&statusCacheMux);
+  webApiStats.statusRebuilds++;
+}
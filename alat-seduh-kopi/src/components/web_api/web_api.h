@@ -0,0 +1,29 @@
+#ifndef WEB_API_H
+#define WEB_API_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "components/telemetry/telemetry.h"
+
+// --- Konfigurasi REST API ---
+#define WEB_API_RESPONSE_SLOTS 4                        // Jumlah respons yang bisa dikirim bersamaan
+#define WEB_API_RESPONSE_SIZE 2048                      // Ukuran buffer tiap slot respons (metrics/tasks)
+#define WEB_API_STATUS_REFRESH_MS 1000                  // Interval minimum penyusunan ulang cache status
+
+// Statistik REST API (ditampilkan juga di /api/metrics)
+struct WebApiStats {
+  unsigned long requests;       // Request yang dijawab (semua endpoint)
+  unsigned long ordersAccepted;
+  unsigned long ordersRejected; // Menu tidak valid atau antrean penuh
+  unsigned long slotsExhausted; // Request dijawab 503 karena semua slot respons terpakai
+  unsigned long statusRebuilds; // Berapa kali cache status disusun ulang oleh task jaringan
+};
+extern WebApiStats webApiStats;
+
+// --- Prototipe Fungsi REST API ---
+// Mendaftarkan endpoint /api/status, /api/order, /api/queue, /api/metrics, /api/tasks, /api/i2c, /api/logs ke server.
+void setupWebApi(AsyncWebServer& server);
+// Dipanggil dari task jaringan: menyusun ulang cache /api/status dari snapshot state.
+void handleWebApi(unsigned long currentMillis, bool relayOn);
+
+#endif // WEB_API_H
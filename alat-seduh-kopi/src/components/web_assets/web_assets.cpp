@@ -0,0 +1,170 @@
+/*
+  src/components/web_assets/web_assets.cpp - Implementasi Penyajian Aset Web
+  Menyajikan file dashboard yang sudah di-gzip saat build (scripts/compress_assets.py)
+  dengan header Content-Encoding: gzip, ETag kuat, dan Cache-Control. Browser yang
+  mengirim If-None-Match dengan ETag yang sama mendapat 304 tanpa isi.
+
+  Dengan -D DASHBOARD_EMBEDDED, aset dibaca dari array PROGMEM di embedded_assets.h
+  (dibuat oleh script yang sama) sehingga dashboard tersedia tanpa SPIFFS.
+*/
+
+#include "web_assets.h"
+#ifdef DASHBOARD_EMBEDDED
+#include "embedded_assets.h"
+#else
+#include <SPIFFS.h>
+#endif
+
+WebAssetStats webAssetStats = {0, 0};
+
+// --- Tabel Aset (diisi dari manifest saat boot) ---
+struct WebAsset {
+  char path[WEB_ASSET_PATH_LEN];          // Path URL, mis. "/index.html"
+  char etag[WEB_ASSET_ETAG_LEN];          // ETag lengkap dengan tanda kutip
+  char contentType[WEB_ASSET_TYPE_LEN];
+  bool isHtml;
+  const uint8_t* data;                    // Isi gzip di flash (hanya mode embedded)
+  size_t length;
+};
+static WebAsset webAssets[WEB_ASSET_MAX];
+static int webAssetCount = 0;
+
+// Mencari aset berdasarkan URL, "/" dipetakan ke "/index.html"
+static const WebAsset* findWebAsset(const char* url) {
+  if (strcmp(url, "/") == 0) url = "/index.html";
+  for (int i = 0; i < webAssetCount; i++) {
+    if (strcmp(webAssets[i].path, url) == 0) return &webAssets[i];
+  }
+  return nullptr;
+}
+
+static void addCacheHeaders(AsyncWebServerResponse* response, const WebAsset& asset) {
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", asset.isHtml ? WEB_ASSET_CACHE_HTML : WEB_ASSET_CACHE_STATIC);
+}
+
+static void serveWebAsset(AsyncWebServerRequest* request, const WebAsset& asset) {
+  // Jika browser sudah punya versi yang sama, cukup kirim 304 tanpa isi
+  if (request->hasHeader("If-None-Match") &&
+      strstr(request->header("If-None-Match").c_str(), asset.etag) != nullptr) {
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    addCacheHeaders(response, asset);
+    request->send(response);
+    webAssetStats.notModified++;
+    return;
+  }
+
+#ifdef DASHBOARD_EMBEDDED
+  // Dikirim langsung dari flash tanpa menyalin isi ke RAM
+  AsyncWebServerResponse* response = request->beginResponse_P(200, asset.contentType, asset.data, asset.length);
+#else
+  char gzPath[WEB_ASSET_PATH_LEN + 3];
+  snprintf(gzPath, sizeof(gzPath), "%s.gz", asset.path);
+  AsyncWebServerResponse* response = request->beginResponse(SPIFFS, gzPath, asset.contentType);
+#endif
+  response->addHeader("Content-Encoding", "gzip");
+  addCacheHeaders(response, asset);
+  request->send(response);
+  webAssetStats.served++;
+}
+
+// Handler khusus agar header If-None-Match tidak dibuang oleh server
+class WebAssetHandler : public AsyncWebHandler {
+public:
+  bool canHandle(AsyncWebServerRequest* request) override {
+    if (request->method() != HTTP_GET) return false;
+    if (findWebAsset(request->url().c_str()) == nullptr) return false;
+    request->addInterestingHeader("If-None-Match");
+    return true;
+  }
+
+  void handleRequest(AsyncWebServerRequest* request) override {
+    const WebAsset* asset = findWebAsset(request->url().c_str());
+    if (asset == nullptr) {
+      request->send(404);
+      return;
+    }
+    serveWebAsset(request, *asset);
+  }
+};
+static WebAssetHandler webAssetHandler;
+
+// Mengurai satu baris manifest: "<path> <etag> <content-type>"
+static bool parseManifestLine(char* line, WebAsset& asset) {
+  char* path = strtok(line, " \r");
+  char* etag = strtok(nullptr, " \r");
+  char* contentType = strtok(nullptr, " \r");
+  if (path == nullptr || etag == nullptr || contentType == nullptr) return false;
+  if (strlen(path) >= WEB_ASSET_PATH_LEN || strlen(etag) >= WEB_ASSET_ETAG_LEN ||
+      strlen(contentType) >= WEB_ASSET_TYPE_LEN) return false;
+
+  strcpy(asset.path, path);
+  strcpy(asset.etag, etag);
+  strcpy(asset.contentType, contentType);
+  asset.isHtml = strcmp(contentType, "text/html") == 0;
+  asset.data = nullptr;
+  asset.length = 0;
+  return true;
+}
+
+#ifdef DASHBOARD_EMBEDDED
+/**
+ * @brief Mengisi tabel aset dari array tertanam dan mendaftarkan handler ke server.
+ * @param server Server web tempat handler aset didaftarkan.
+ * @return true jika minimal satu aset tertanam tersedia.
+ */
+bool setupWebAssets(AsyncWebServer& server) {
+  webAssetCount = 0;
+  for (size_t i = 0; i < EMBEDDED_ASSET_COUNT && webAssetCount < WEB_ASSET_MAX; i++) {
+    const EmbeddedAsset& embedded = EMBEDDED_ASSETS[i];
+    WebAsset& asset = webAssets[webAssetCount];
+    if (strlen(embedded.path) >= WEB_ASSET_PATH_LEN || strlen(embedded.etag) >= WEB_ASSET_ETAG_LEN ||
+        strlen(embedded.contentType) >= WEB_ASSET_TYPE_LEN) {
+      Serial.printf("[WEB_ASSETS] Aset tertanam %s terlalu panjang, dilewati.\n", embedded.path);
+      continue;
+    }
+    strcpy(asset.path, embedded.path);
+    strcpy(asset.etag, embedded.etag);
+    strcpy(asset.contentType, embedded.contentType);
+    asset.isHtml = strcmp(embedded.contentType, "text/html") == 0;
+    asset.data = embedded.data;
+    asset.length = embedded.length;
+    Serial.printf("[WEB_ASSETS] Aset tertanam %s (%u byte, ETag %s)\n", asset.path, (unsigned)asset.length, asset.etag);
+    webAssetCount++;
+  }
+
+  server.addHandler(&webAssetHandler);
+  return webAssetCount > 0;
+}
+#else
+/**
+ * @brief Membaca manifest aset dari SPIFFS dan mendaftarkan handler ke server.
+ * @param server Server web tempat handler aset didaftarkan.
+ * @return true jika manifest terbaca dan minimal satu aset tersedia.
+ */
+bool setupWebAssets(AsyncWebServer& server) {
+  File manifest = SPIFFS.open(WEB_ASSET_MANIFEST_PATH, "r");
+  if (!manifest) {
+    Serial.println("[WEB_ASSETS] Manifest aset tidak ditemukan. Jalankan 'pio run -t uploadfs'.");
+    return false;
+  }
+
+  char line[WEB_ASSET_PATH_LEN + WEB_ASSET_ETAG_LEN + WEB_ASSET_TYPE_LEN + 4];
+  webAssetCount = 0;
+  while (manifest.available() && webAssetCount < WEB_ASSET_MAX) {
+    size_t n = manifest.readBytesUntil('\n', line, sizeof(line) - 1);
+    line[n] = '\0';
+    if (n == 0) continue;
+    if (parseManifestLine(line, webAssets[webAssetCount])) {
+      Serial.printf("[WEB_ASSETS] Aset %s (ETag %s)\n", webAssets[webAssetCount].path, webAssets[webAssetCount].etag);
+      webAssetCount++;
+    } else {
+      Serial.println("[WEB_ASSETS] Baris manifest tidak valid, dilewati.");
+    }
+  }
+  manifest.close();
+
+  server.addHandler(&webAssetHandler);
+  return webAssetCount > 0;
+}
+#endif
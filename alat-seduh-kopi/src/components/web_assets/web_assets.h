@@ -0,0 +1,31 @@
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+// --- Konfigurasi Aset Web ---
+#define WEB_ASSET_MANIFEST_PATH "/assets.manifest" // Ditulis oleh scripts/compress_assets.py
+#define WEB_ASSET_MAX 8            // Jumlah maksimum aset di manifest
+#define WEB_ASSET_PATH_LEN 28      // Panjang maksimum path URL (batas nama file SPIFFS 32)
+#define WEB_ASSET_ETAG_LEN 20      // ETag 16 hex + tanda kutip
+#define WEB_ASSET_TYPE_LEN 28      // Panjang maksimum Content-Type
+
+// Cache-Control untuk HTML: selalu revalidasi dengan ETag (jawaban 304 jika tidak berubah)
+#define WEB_ASSET_CACHE_HTML "no-cache"
+// Cache-Control untuk aset lain (CSS/JS/gambar)
+#define WEB_ASSET_CACHE_STATIC "public, max-age=86400"
+
+// Statistik penyajian aset
+struct WebAssetStats {
+  unsigned long served;       // Respons 200 (isi gzip dikirim)
+  unsigned long notModified;  // Respons 304
+};
+extern WebAssetStats webAssetStats;
+
+// --- Prototipe Fungsi Aset Web ---
+// Membaca manifest dari SPIFFS dan mendaftarkan handler aset ke server.
+// SPIFFS harus sudah dimount sebelum fungsi ini dipanggil.
+bool setupWebAssets(AsyncWebServer& server);
+
+#endif // WEB_ASSETS_H
@@ -0,0 +1,182 @@
+/*
+  src/components/wifi_service/wifi_service.cpp - Layanan Koneksi WiFi di Latar Belakang
+  Koneksi WiFi tidak pernah ditunggu oleh setup() maupun task kontrol. Event driver
+  (dapat IP / terputus) dicatat dari task event Arduino ke flag atomik, lalu task
+  "wifi" di grup jaringan menjalankan state machine:
+    CONNECTING -> CONNECTED            saat dapat IP
+    CONNECTING -> BACKOFF              saat terputus atau percobaan melewati batas waktu
+    CONNECTED  -> BACKOFF              saat link terputus
+    BACKOFF    -> CONNECTING           setelah jeda backoff (eksponensial + jitter)
+  Proses seduh tidak bergantung pada state ini; modul lain hanya membaca
+  wifi_service_online() atau menerima callback perubahan link.
+*/
+
+#include "wifi_service.h"
+#include <WiFi.h>
+#include <atomic>
+#include "components/scheduler/scheduler.h"
+
+WifiServiceStats wifiServiceStats = {0, 0, 0, 0, 0, 0};
+
+// Flag event dari task event Arduino (dibaca & dihapus oleh task "wifi")
+#define WIFI_EVENT_GOT_IP (1u << 0)
+#define WIFI_EVENT_DISCONNECTED (1u << 1)
+static std::atomic<uint8_t> pendingEvents(0);
+static std::atomic<uint8_t> lastDisconnectReason(0);
+static std::atomic<bool> linkOnline(false);
+
+static const char* wifiSsid = nullptr;
+static const char* wifiPassword = nullptr;
+static WifiLinkCallback linkCallback = nullptr;
+
+// --- State Machine (hanya disentuh task "wifi") ---
+static WifiLinkState linkState = WIFI_LINK_IDLE;
+static unsigned long stateSinceMillis = 0;
+static unsigned long offlineSinceMillis = 0;
+static unsigned long nextBackoffMs = WIFI_BACKOFF_MIN_MS;
+
+static const char* const WIFI_LINK_STATE_NAMES[] = {
+  "idle",
+  "connecting",
+  "connected",
+  "backoff"
+};
+
+// Dijalankan di task event Arduino: hanya mencatat event, tanpa I/O
+static void onWifiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+    pendingEvents.fetch_or(WIFI_EVENT_GOT_IP);
+  } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+    lastDisconnectReason.store(info.wifi_sta_disconnected.reason);
+    pendingEvents.fetch_or(WIFI_EVENT_DISCONNECTED);
+  }
+}
+
+static void setLinkState(WifiLinkState state, unsigned long currentMillis) {
+  linkState = state;
+  stateSinceMillis = currentMillis;
+}
+
+static void startAttempt(unsigned long currentMillis) {
+  wifiServiceStats.attempts++;
+  WiFi.begin(wifiSsid, wifiPassword);
+  setLinkState(WIFI_LINK_CONNECTING, currentMillis);
+}
+
+// Jeda berikutnya: eksponensial dengan jitter ±25% agar banyak mesin tidak reconnect bersamaan
+static void enterBackoff(unsigned long currentMillis) {
+  unsigned long jitter = nextBackoffMs / 4;
+  wifiServiceStats.backoffMs = nextBackoffMs - jitter + (unsigned long)random((long)(2 * jitter + 1));
+  nextBackoffMs = nextBackoffMs * 2 > WIFI_BACKOFF_MAX_MS ? WIFI_BACKOFF_MAX_MS : nextBackoffMs * 2;
+  setLinkState(WIFI_LINK_BACKOFF, currentMillis);
+  Serial.printf("[WiFi] Mencoba lagi dalam %lu ms.\n", wifiServiceStats.backoffMs);
+}
+
+static void goOnline(unsigned long currentMillis) {
+  wifiServiceStats.connects++;
+  wifiServiceStats.offlineMs += currentMillis - offlineSinceMillis;
+  nextBackoffMs = WIFI_BACKOFF_MIN_MS;
+  setLinkState(WIFI_LINK_CONNECTED, currentMillis);
+  linkOnline.store(true);
+  Serial.print("[WiFi] Terhubung. IP Address: ");
+  Serial.print(WiFi.localIP());
+  Serial.printf(", RSSI: %d dBm\n", WiFi.RSSI());
+  if (linkCallback != nullptr) linkCallback(true);
+}
+
+static void goOffline(unsigned long currentMillis) {
+  wifiServiceStats.disconnects++;
+  offlineSinceMillis = currentMillis;
+  linkOnline.store(false);
+  Serial.printf("[WiFi] Link terputus (alasan %u). Mesin tetap melayani pesanan lokal.\n",
+                (unsigned)wifiServiceStats.lastReason);
+  if (linkCallback != nullptr) linkCallback(false);
+}
+
+/**
+ * @brief Memulai koneksi WiFi (tidak menunggu) dan mendaftarkan task "wifi".
+ * @param callback Dipanggil dari task jaringan saat link naik/turun, boleh nullptr.
+ */
+void setupWifiService(const char* ssid, const char* password, WifiLinkCallback callback) {
+  wifiSsid = ssid;
+  wifiPassword = password;
+  linkCallback = callback;
+
+  WiFi.onEvent(onWifiEvent);
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(false);
+
+  unsigned long now = millis();
+  offlineSinceMillis = now;
+  startAttempt(now);
+  scheduler_add_periodic("wifi", handleWifiService, WIFI_SERVICE_INTERVAL_MS, TASK_PRIORITY_NORMAL, SCHED_GROUP_NETWORK);
+  Serial.printf("[WiFi] Menghubungkan ke \"%s\" di latar belakang...\n", ssid);
+}
+
+void handleWifiService(unsigned long currentMillis) {
+  // Event yang datang selama BACKOFF (mis. akibat WiFi.disconnect() sendiri) ikut dibuang
+  uint8_t events = pendingEvents.exchange(0);
+  if ((events & WIFI_EVENT_DISCONNECTED) && linkState != WIFI_LINK_BACKOFF) {
+    wifiServiceStats.lastReason = lastDisconnectReason.load();
+  }
+
+  switch (linkState) {
+    case WIFI_LINK_CONNECTING:
+      if ((events & WIFI_EVENT_GOT_IP) && WiFi.status() == WL_CONNECTED) {
+        goOnline(currentMillis);
+      } else if (events & WIFI_EVENT_DISCONNECTED) {
+        Serial.printf("[WiFi] Koneksi gagal (alasan %u).\n", (unsigned)wifiServiceStats.lastReason);
+        enterBackoff(currentMillis);
+      } else if (currentMillis - stateSinceMillis > WIFI_CONNECT_ATTEMPT_MS) {
+        Serial.println("[WiFi] Percobaan koneksi timeout. Cek SSID/Password.");
+        WiFi.disconnect(); // Hentikan percobaan di driver selama backoff
+        enterBackoff(currentMillis);
+      }
+      break;
+    case WIFI_LINK_CONNECTED:
+      if (events & WIFI_EVENT_DISCONNECTED) {
+        goOffline(currentMillis);
+        enterBackoff(currentMillis);
+      }
+      break;
+    case WIFI_LINK_BACKOFF:
+      if (currentMillis - stateSinceMillis >= wifiServiceStats.backoffMs) startAttempt(currentMillis);
+      break;
+    case WIFI_LINK_IDLE:
+    default:
+      break;
+  }
+}
+
+bool wifi_service_online() {
+  return linkOnline.load();
+}
+
+WifiLinkState wifi_service_state() {
+  return linkState;
+}
+
+const char* wifi_link_state_name(WifiLinkState state) {
+  if (state > WIFI_LINK_BACKOFF) return "unknown";
+  return WIFI_LINK_STATE_NAMES[state];
+}
+
+/**
+ * @brief Menulis {"state", "online", "attempts", "connects", "disconnects", "lastReason",
+ * "backoffMs", "offlineMs"}. offlineMs mencakup periode offline yang sedang berjalan.
+ */
+void writeWifiJson(JsonWriter& writer, const char* key) {
+  bool online = wifi_service_online();
+  unsigned long offlineMs = wifiServiceStats.offlineMs;
+  if (!online) offlineMs += millis() - offlineSinceMillis;
+  writer.beginObject(key)
+    .field("state", wifi_link_state_name(linkState))
+    .field("online", online)
+    .field("attempts", (unsigned long)wifiServiceStats.attempts)
+    .field("connects", (unsigned long)wifiServiceStats.connects)
+    .field("disconnects", (unsigned long)wifiServiceStats.disconnects)
+    .field("lastReason", (int)wifiServiceStats.lastReason)
+    .field("backoffMs", wifiServiceStats.backoffMs)
+    .field("offlineMs", offlineMs)
+    .endObject();
+}
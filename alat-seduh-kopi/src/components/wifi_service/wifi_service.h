@@ -0,0 +1,46 @@
+#ifndef WIFI_SERVICE_H
+#define WIFI_SERVICE_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+
+// --- Konfigurasi Layanan WiFi ---
+#define WIFI_SERVICE_INTERVAL_MS 100   // Periode task "wifi" (grup jaringan)
+#define WIFI_CONNECT_ATTEMPT_MS 15000  // Batas satu percobaan koneksi sebelum backoff
+#define WIFI_BACKOFF_MIN_MS 1000       // Jeda pertama setelah gagal/terputus
+#define WIFI_BACKOFF_MAX_MS 60000      // Jeda terpanjang (backoff eksponensial x2)
+
+// State link WiFi
+enum WifiLinkState : uint8_t {
+  WIFI_LINK_IDLE = 0,   // Belum dimulai
+  WIFI_LINK_CONNECTING, // WiFi.begin() sudah dipanggil, menunggu IP
+  WIFI_LINK_CONNECTED,  // Punya IP
+  WIFI_LINK_BACKOFF     // Menunggu sebelum mencoba lagi
+};
+
+// Statistik layanan (ditulis task jaringan, dibaca tanpa kunci untuk pemantauan)
+struct WifiServiceStats {
+  uint32_t attempts;         // Jumlah WiFi.begin()
+  uint32_t connects;         // Jumlah berhasil mendapat IP
+  uint32_t disconnects;      // Jumlah link terputus setelah terhubung
+  uint8_t lastReason;        // Alasan putus terakhir dari driver (wifi_err_reason_t)
+  unsigned long backoffMs;   // Jeda backoff yang sedang/terakhir dipakai
+  unsigned long offlineMs;   // Total waktu tanpa link sejak boot (tidak termasuk saat ini)
+};
+extern WifiServiceStats wifiServiceStats;
+
+// Dipanggil di task jaringan setiap kali link naik (online = true) atau turun
+typedef void (*WifiLinkCallback)(bool online);
+
+// --- Prototipe Fungsi Layanan WiFi ---
+// Memulai koneksi tanpa menunggu dan mendaftarkan task "wifi" (grup jaringan).
+// Reconnect otomatis bawaan driver dimatikan; layanan ini yang mengatur percobaan ulang.
+void setupWifiService(const char* ssid, const char* password, WifiLinkCallback callback);
+void handleWifiService(unsigned long currentMillis);
+bool wifi_service_online(); // Aman dari task mana pun
+WifiLinkState wifi_service_state();
+const char* wifi_link_state_name(WifiLinkState state);
+
+void writeWifiJson(JsonWriter& writer, const char* key);
+
+#endif // WIFI_SERVICE_H
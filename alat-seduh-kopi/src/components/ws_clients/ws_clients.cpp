@@ -0,0 +1,467 @@
+/*
+  src/components/ws_clients/ws_clients.cpp - Implementasi Langganan Topik & Backpressure
+  Setiap klien melanggan topik (telemetry, orders, diagnostics, logs) dengan interval
+  periodiknya sendiri. Task jaringan menanyakan topik mana yang jatuh tempo, menyusun JSON
+  tiap topik tersebut sekali, lalu pesan hanya dikirim ke pelanggan yang jatuh tempo.
+  Satu AsyncWebSocketMessageBuffer dibagi (refcount) ke semua penerima pesan yang sama,
+  jadi heap per pesan tidak bertambah dengan jumlah klien.
+
+  Klien yang tertinggal (antrean >= WS_CLIENT_QUEUE_SOFT_LIMIT, queueIsFull() atau
+  !canSend()) tidak diberi pesan baru:
+    - pesan periodik dibuang, klien menerima data terbaru pada periode berikutnya;
+    - event dibuang, dan klien mendapat satu snapshot (resync) setelah lancar lagi.
+  Balasan perintah (ack dari task AsyncTCP, snapshot lewat ws_clients_send()) tidak
+  pernah dibuang. Dengan begitu memori yang tertahan di antrean AsyncTCP dibatasi oleh
+  WS_CLIENT_MAX x WS_CLIENT_QUEUE_SOFT_LIMIT pesan, seberapa pun lambat kliennya.
+
+  Buffer bersama (makeBuffer/_cleanBuffers) hanya dikelola task jaringan. Ack perintah
+  dikirim langsung oleh task AsyncTCP dengan client->text(data, len), agar kedua task
+  tidak pernah membersihkan buffer yang sedang diisi task lain.
+
+  Topik logs tidak periodik maupun event: setiap pelanggan punya kursor nomor urut
+  record log. Klien yang tertinggal tidak kehilangan apa pun selama record-nya belum
+  tertimpa di ring buffer; ia menerima batch mulai dari kursornya saat lancar lagi.
+*/
+
+#include "ws_clients.h"
+#include "components/ws_command/ws_command.h"
+
+// --- Informasi Topik (indeks = WsTopic) ---
+struct WsTopicInfo {
+  const char* name;
+  unsigned long defaultIntervalMs; // 0 = topik hanya event
+  unsigned long minIntervalMs;
+};
+static const WsTopicInfo TOPIC_INFO[WS_TOPIC_COUNT] = {
+  {"telemetry",   2000, 250},
+  {"orders",      1000, 250},
+  {"diagnostics", 5000, 100},
+  {"logs",        0,    0}
+};
+
+// --- Tabel Klien (ditulis dari task AsyncTCP, dibaca dari task jaringan) ---
+struct WsClientSlot {
+  bool used;
+  bool needsResync;                           // Ada event yang dibuang, klien perlu snapshot
+  unsigned long intervalMs[WS_TOPIC_COUNT];   // Interval periodik yang diminta per topik
+  unsigned long lastSentMs[WS_TOPIC_COUNT];
+  bool cursorValid;                           // Kursor topik logs sudah diinisialisasi
+  uint32_t cursor;                            // Record log berikutnya untuk klien ini
+  WsClientStats stats;
+};
+static WsClientSlot clientSlots[WS_CLIENT_MAX];
+static portMUX_TYPE clientSlotMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Harus dipanggil di dalam critical section clientSlotMux
+static WsClientSlot* findClientSlot(uint32_t clientId) {
+  for (int i = 0; i < WS_CLIENT_MAX; i++) {
+    if (clientSlots[i].used && clientSlots[i].stats.id == clientId) return &clientSlots[i];
+  }
+  return nullptr;
+}
+
+static bool isSubscribed(const WsClientSlot& slot, WsTopic topic) {
+  return (slot.stats.topicMask & WS_TOPIC_BIT(topic)) != 0;
+}
+
+static bool isDue(const WsClientSlot& slot, WsTopic topic, unsigned long currentMillis) {
+  return isSubscribed(slot, topic) && slot.intervalMs[topic] > 0 &&
+         currentMillis - slot.lastSentMs[topic] >= slot.intervalMs[topic];
+}
+
+// Menyalin ID klien yang melanggan topik (dan jatuh tempo jika dueOnly), agar
+// pengiriman tidak dilakukan di dalam critical section
+static size_t copySubscriberIds(uint32_t* ids, WsTopic topic, bool dueOnly, unsigned long currentMillis) {
+  size_t count = 0;
+  portENTER_CRITICAL(&clientSlotMux);
+  for (int i = 0; i < WS_CLIENT_MAX; i++) {
+    const WsClientSlot& slot = clientSlots[i];
+    if (!slot.used || !isSubscribed(slot, topic)) continue;
+    if (dueOnly && !isDue(slot, topic, currentMillis)) continue;
+    ids[count++] = slot.stats.id;
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+  return count;
+}
+
+// Mengecek apakah klien masih bisa menerima pesan topik, sekaligus mencatat kedalaman antreannya
+static bool clientCanAccept(AsyncWebSocketClient* client, uint32_t clientId) {
+  size_t depth = client->queueLen();
+  bool canAccept = client->status() == WS_CONNECTED && client->canSend() &&
+                   !client->queueIsFull() && depth < WS_CLIENT_QUEUE_SOFT_LIMIT;
+
+  portENTER_CRITICAL(&clientSlotMux);
+  WsClientSlot* slot = findClientSlot(clientId);
+  if (slot != nullptr) {
+    slot->stats.queueDepth = (uint16_t)depth;
+    if (depth > slot->stats.maxQueueDepth) slot->stats.maxQueueDepth = (uint16_t)depth;
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+  return canAccept;
+}
+
+// Satu pesan disalin sekali ke AsyncWebSocketMessageBuffer, lalu dibagi (refcount) ke
+// semua klien penerima, sehingga heap per pesan tetap sama berapa pun jumlah kliennya.
+// Buffer hanya dibuat jika ada penerima. false jika buffer gagal dialokasikan.
+// Hanya dipanggil dari task jaringan: buffer baru belum punya referensi, sehingga
+// _cleanBuffers() dari task lain bisa membebaskannya sebelum dikirim.
+static bool sendShared(AsyncWebSocket& ws, AsyncWebSocketClient* const* clients, size_t count,
+                       const JsonWriter& writer) {
+  if (count == 0) return true;
+  AsyncWebSocketMessageBuffer* buffer = ws.makeBuffer(writer.length());
+  if (buffer == nullptr) return false;
+  buffer->lock(); // Tidak dibersihkan sebelum semua klien memegang referensinya
+  memcpy(buffer->get(), writer.c_str(), writer.length());
+  for (size_t i = 0; i < count; i++) {
+    clients[i]->text(buffer);
+  }
+  buffer->unlock();
+  ws._cleanBuffers(); // Seperti textAll(): buffer dilepas setelah klien terakhir selesai mengirim
+  return true;
+}
+
+// Mengirim satu pesan topik ke daftar klien dan mencatat hasilnya
+static void sendToClients(AsyncWebSocket& ws, const uint32_t* ids, size_t count, WsTopic topic,
+                          const JsonWriter& writer, WsMessageClass messageClass, unsigned long currentMillis) {
+  AsyncWebSocketClient* receivers[WS_CLIENT_MAX];
+  bool accepted[WS_CLIENT_MAX];
+  size_t receiverCount = 0;
+  for (size_t i = 0; i < count; i++) {
+    AsyncWebSocketClient* client = ws.client(ids[i]);
+    accepted[i] = client != nullptr && clientCanAccept(client, ids[i]);
+    if (accepted[i]) receivers[receiverCount++] = client;
+  }
+  bool sent = sendShared(ws, receivers, receiverCount, writer);
+
+  for (size_t i = 0; i < count; i++) {
+    if (ws.client(ids[i]) == nullptr) continue; // Klien sudah terputus, slotnya sudah dilepas
+    bool delivered = sent && accepted[i];
+
+    portENTER_CRITICAL(&clientSlotMux);
+    WsClientSlot* slot = findClientSlot(ids[i]);
+    if (slot != nullptr) {
+      if (messageClass == WS_MSG_PERIODIC) {
+        // Periode berikutnya dihitung dari sekarang, baik terkirim maupun dibuang
+        slot->lastSentMs[topic] = currentMillis;
+        if (!delivered) slot->stats.droppedPeriodic++;
+      } else if (!delivered) {
+        slot->stats.droppedEvents++;
+        slot->needsResync = true;
+      }
+      if (delivered) slot->stats.sent++;
+    }
+    portEXIT_CRITICAL(&clientSlotMux);
+  }
+}
+
+/**
+ * @brief Mulai melacak klien yang baru terhubung dengan langganan bawaan.
+ * @return false jika tabel klien penuh (pemanggil sebaiknya menutup koneksi).
+ */
+bool ws_clients_connected(uint32_t clientId) {
+  bool added = false;
+  portENTER_CRITICAL(&clientSlotMux);
+  for (int i = 0; i < WS_CLIENT_MAX; i++) {
+    if (!clientSlots[i].used) {
+      WsClientSlot& slot = clientSlots[i];
+      slot = WsClientSlot();
+      slot.used = true;
+      slot.stats.id = clientId;
+      slot.stats.topicMask = WS_TOPIC_DEFAULT_MASK;
+      for (int t = 0; t < WS_TOPIC_COUNT; t++) slot.intervalMs[t] = TOPIC_INFO[t].defaultIntervalMs;
+      added = true;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+  return added;
+}
+
+void ws_clients_disconnected(uint32_t clientId) {
+  portENTER_CRITICAL(&clientSlotMux);
+  WsClientSlot* slot = findClientSlot(clientId);
+  if (slot != nullptr) slot->used = false;
+  portEXIT_CRITICAL(&clientSlotMux);
+}
+
+/**
+ * @brief Menambahkan langganan topik untuk klien.
+ * @param intervalMs Interval periodik yang diminta, 0 = bawaan. Dibatasi ke minimum topik.
+ * @return false jika klien tidak dilacak atau interval melebihi WS_TOPIC_MAX_INTERVAL_MS.
+ */
+bool ws_clients_subscribe(uint32_t clientId, WsTopic topic, unsigned long intervalMs) {
+  if (topic >= WS_TOPIC_COUNT || intervalMs > WS_TOPIC_MAX_INTERVAL_MS) return false;
+  const WsTopicInfo& info = TOPIC_INFO[topic];
+  if (info.defaultIntervalMs == 0) intervalMs = 0; // Topik hanya event
+  else if (intervalMs == 0) intervalMs = info.defaultIntervalMs;
+  else if (intervalMs < info.minIntervalMs) intervalMs = info.minIntervalMs;
+
+  bool found = false;
+  portENTER_CRITICAL(&clientSlotMux);
+  WsClientSlot* slot = findClientSlot(clientId);
+  if (slot != nullptr) {
+    slot->stats.topicMask |= WS_TOPIC_BIT(topic);
+    slot->intervalMs[topic] = intervalMs;
+    slot->lastSentMs[topic] = 0; // Kirim data pertama secepatnya
+    if (topic == WS_TOPIC_LOGS) slot->cursorValid = false; // Mulai lagi dari backlog
+    found = true;
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+  return found;
+}
+
+bool ws_clients_unsubscribe(uint32_t clientId, WsTopic topic) {
+  if (topic >= WS_TOPIC_COUNT) return false;
+  bool found = false;
+  portENTER_CRITICAL(&clientSlotMux);
+  WsClientSlot* slot = findClientSlot(clientId);
+  if (slot != nullptr) {
+    slot->stats.topicMask &= ~WS_TOPIC_BIT(topic);
+    found = true;
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+  return found;
+}
+
+bool ws_topic_from_name(const char* name, WsTopic& topic) {
+  for (int t = 0; t < WS_TOPIC_COUNT; t++) {
+    if (strcmp(name, TOPIC_INFO[t].name) == 0) {
+      topic = (WsTopic)t;
+      return true;
+    }
+  }
+  return false;
+}
+
+const char* ws_topic_name(WsTopic topic) {
+  return topic < WS_TOPIC_COUNT ? TOPIC_INFO[topic].name : "unknown";
+}
+
+// Event yang mengubah alur pesanan masuk ke "orders", sisanya ke "diagnostics"
+WsTopic ws_topic_for_event(EventType type) {
+  switch (type) {
+    case EVT_BUTTON:
+    case EVT_CARD_TAP:
+    case EVT_MENU:
+    case EVT_BREW_PHASE:
+      return WS_TOPIC_ORDERS;
+    default:
+      return WS_TOPIC_DIAGNOSTICS;
+  }
+}
+
+uint8_t ws_clients_due_topics(unsigned long currentMillis) {
+  uint8_t due = 0;
+  portENTER_CRITICAL(&clientSlotMux);
+  for (int i = 0; i < WS_CLIENT_MAX; i++) {
+    if (!clientSlots[i].used) continue;
+    for (int t = 0; t < WS_TOPIC_COUNT; t++) {
+      if (isDue(clientSlots[i], (WsTopic)t, currentMillis)) due |= WS_TOPIC_BIT(t);
+    }
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+  return due;
+}
+
+unsigned long ws_clients_fastest_interval(WsTopic topic) {
+  unsigned long fastest = 0;
+  portENTER_CRITICAL(&clientSlotMux);
+  for (int i = 0; i < WS_CLIENT_MAX; i++) {
+    const WsClientSlot& slot = clientSlots[i];
+    if (!slot.used || !isSubscribed(slot, topic) || slot.intervalMs[topic] == 0) continue;
+    if (fastest == 0 || slot.intervalMs[topic] < fastest) fastest = slot.intervalMs[topic];
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+  return fastest;
+}
+
+/**
+ * @brief Mengirim event ke semua pelanggan topik, dengan kebijakan backpressure per klien.
+ * Klien yang tertinggal ditandai agar ws_clients_service() menjadwalkan resync.
+ */
+void ws_clients_publish(AsyncWebSocket& ws, WsTopic topic, const JsonWriter& writer) {
+  if (writer.overflowed()) {
+    Serial.println("[WS_CLIENTS] Pesan JSON melebihi ukuran buffer, tidak dikirim.");
+    return;
+  }
+  uint32_t ids[WS_CLIENT_MAX];
+  size_t count = copySubscriberIds(ids, topic, false, 0);
+  sendToClients(ws, ids, count, topic, writer, WS_MSG_EVENT, 0);
+}
+
+/**
+ * @brief Mengirim pesan periodik ke pelanggan topik yang sudah jatuh tempo.
+ * Pesan disusun sekali oleh pemanggil untuk semua pelanggan tersebut.
+ */
+void ws_clients_publish_due(AsyncWebSocket& ws, WsTopic topic, const JsonWriter& writer,
+                            unsigned long currentMillis) {
+  const JsonWriter* messages[] = {&writer};
+  ws_clients_publish_due(ws, topic, messages, 1, currentMillis);
+}
+
+/**
+ * @brief Mengirim beberapa pesan periodik satu topik ke pelanggan yang sama.
+ * Pelanggan yang jatuh tempo ditentukan sekali, sehingga semua pesan sampai ke
+ * klien yang sama dalam satu periode (mis. "diagnostics" + "perf").
+ */
+void ws_clients_publish_due(AsyncWebSocket& ws, WsTopic topic, const JsonWriter* const* messages,
+                            size_t messageCount, unsigned long currentMillis) {
+  uint32_t ids[WS_CLIENT_MAX];
+  size_t count = copySubscriberIds(ids, topic, true, currentMillis);
+  for (size_t m = 0; m < messageCount; m++) {
+    if (messages[m]->overflowed()) {
+      Serial.printf("[WS_CLIENTS] Pesan topik %s melebihi ukuran buffer, tidak dikirim.\n", ws_topic_name(topic));
+      continue;
+    }
+    sendToClients(ws, ids, count, topic, *messages[m], WS_MSG_PERIODIC, currentMillis);
+  }
+}
+
+/**
+ * @brief Menjadwalkan satu snapshot untuk klien yang sempat kehilangan event
+ * dan antreannya sudah longgar kembali.
+ */
+void ws_clients_service(AsyncWebSocket& ws) {
+  uint32_t ids[WS_CLIENT_MAX];
+  size_t count = 0;
+  portENTER_CRITICAL(&clientSlotMux);
+  for (int i = 0; i < WS_CLIENT_MAX; i++) {
+    if (clientSlots[i].used && clientSlots[i].needsResync) ids[count++] = clientSlots[i].stats.id;
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+
+  for (size_t i = 0; i < count; i++) {
+    AsyncWebSocketClient* client = ws.client(ids[i]);
+    if (client == nullptr || !clientCanAccept(client, ids[i])) continue;
+    if (!requestWsSnapshot(ids[i])) continue;
+
+    portENTER_CRITICAL(&clientSlotMux);
+    WsClientSlot* slot = findClientSlot(ids[i]);
+    if (slot != nullptr) {
+      slot->needsResync = false;
+      slot->stats.resyncs++;
+    }
+    portEXIT_CRITICAL(&clientSlotMux);
+  }
+}
+
+// Perbandingan nomor urut yang aman terhadap wrap-around
+static inline bool cursorBefore(uint32_t a, uint32_t b) {
+  return (int32_t)(a - b) < 0;
+}
+
+/**
+ * @brief Mencari kursor terkecil di antara pelanggan topik yang antreannya masih longgar.
+ * Klien yang sedang tertinggal tidak ikut, agar tidak menahan batch untuk klien lain.
+ */
+bool ws_clients_min_cursor(AsyncWebSocket& ws, WsTopic topic, uint32_t initialCursor, uint32_t& cursor) {
+  uint32_t ids[WS_CLIENT_MAX];
+  uint32_t cursors[WS_CLIENT_MAX];
+  size_t count = 0;
+  portENTER_CRITICAL(&clientSlotMux);
+  for (int i = 0; i < WS_CLIENT_MAX; i++) {
+    WsClientSlot& slot = clientSlots[i];
+    if (!slot.used || !isSubscribed(slot, topic)) continue;
+    if (!slot.cursorValid) {
+      slot.cursor = initialCursor;
+      slot.cursorValid = true;
+    }
+    ids[count] = slot.stats.id;
+    cursors[count++] = slot.cursor;
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+
+  bool found = false;
+  for (size_t i = 0; i < count; i++) {
+    AsyncWebSocketClient* client = ws.client(ids[i]);
+    if (client == nullptr || !clientCanAccept(client, ids[i])) continue;
+    if (!found || cursorBefore(cursors[i], cursor)) cursor = cursors[i];
+    found = true;
+  }
+  return found;
+}
+
+/**
+ * @brief Mengirim batch yang disusun sekali ke semua pelanggan yang menunggu record from.
+ * Pelanggan yang kursornya lebih maju menunggu batch berikutnya (tidak menerima duplikat).
+ */
+void ws_clients_publish_cursor(AsyncWebSocket& ws, WsTopic topic, const JsonWriter& writer,
+                               uint32_t from, uint32_t next) {
+  if (writer.overflowed()) {
+    Serial.printf("[WS_CLIENTS] Pesan topik %s melebihi ukuran buffer, tidak dikirim.\n", ws_topic_name(topic));
+    return;
+  }
+  uint32_t ids[WS_CLIENT_MAX];
+  size_t count = 0;
+  portENTER_CRITICAL(&clientSlotMux);
+  for (int i = 0; i < WS_CLIENT_MAX; i++) {
+    const WsClientSlot& slot = clientSlots[i];
+    if (!slot.used || !isSubscribed(slot, topic) || !slot.cursorValid) continue;
+    if (cursorBefore(from, slot.cursor)) continue;
+    ids[count++] = slot.stats.id;
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+
+  AsyncWebSocketClient* receivers[WS_CLIENT_MAX];
+  uint32_t receiverIds[WS_CLIENT_MAX];
+  size_t receiverCount = 0;
+  for (size_t i = 0; i < count; i++) {
+    AsyncWebSocketClient* client = ws.client(ids[i]);
+    if (client == nullptr || !clientCanAccept(client, ids[i])) continue;
+    receivers[receiverCount] = client;
+    receiverIds[receiverCount++] = ids[i];
+  }
+  if (!sendShared(ws, receivers, receiverCount, writer)) return; // Kursor tetap, dicoba lagi batch berikutnya
+
+  for (size_t i = 0; i < receiverCount; i++) {
+    portENTER_CRITICAL(&clientSlotMux);
+    WsClientSlot* slot = findClientSlot(receiverIds[i]);
+    if (slot != nullptr) {
+      slot->cursor = next;
+      slot->stats.sent++;
+    }
+    portEXIT_CRITICAL(&clientSlotMux);
+  }
+}
+
+/**
+ * @brief Mengirim satu pesan ke satu klien lewat buffer bersama (snapshot resync).
+ * Hanya dari task jaringan, seperti semua pemakai sendShared().
+ * @return false jika buffer pesan gagal dialokasikan.
+ */
+bool ws_clients_send(AsyncWebSocket& ws, AsyncWebSocketClient* client, const JsonWriter& writer) {
+  return sendShared(ws, &client, 1, writer);
+}
+
+size_t ws_clients_get_stats(WsClientStats* out, size_t maxClients) {
+  size_t count = 0;
+  portENTER_CRITICAL(&clientSlotMux);
+  for (int i = 0; i < WS_CLIENT_MAX && count < maxClients; i++) {
+    if (clientSlots[i].used) out[count++] = clientSlots[i].stats;
+  }
+  portEXIT_CRITICAL(&clientSlotMux);
+  return count;
+}
+
+/**
+ * @brief Menulis statistik per klien sebagai array JSON.
+ * @param key Nama field array di objek induk.
+ */
+void writeWsClientsJson(JsonWriter& writer, const char* key) {
+  WsClientStats stats[WS_CLIENT_MAX];
+  size_t count = ws_clients_get_stats(stats, WS_CLIENT_MAX);
+  writer.beginArray(key);
+  for (size_t i = 0; i < count; i++) {
+    writer.beginObject()
+      .field("id", (unsigned long)stats[i].id)
+      .field("topics", (unsigned)stats[i].topicMask)
+      .field("queue", (unsigned)stats[i].queueDepth)
+      .field("maxQueue", (unsigned)stats[i].maxQueueDepth)
+      .field("sent", stats[i].sent)
+      .field("droppedPeriodic", stats[i].droppedPeriodic)
+      .field("droppedEvents", stats[i].droppedEvents)
+      .field("resyncs", stats[i].resyncs)
+      .endObject();
+  }
+  writer.endArray();
+}
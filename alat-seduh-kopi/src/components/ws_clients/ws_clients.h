@@ -0,0 +1,91 @@
+#ifndef WS_CLIENTS_H
+#define WS_CLIENTS_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "components/json_writer/json_writer.h"
+#include "components/event_bus/event_bus.h"
+
+// --- Konfigurasi Backpressure Klien WebSocket ---
+#define WS_CLIENT_MAX 8               // Jumlah klien yang dilacak (klien lain ditolak)
+#define WS_CLIENT_QUEUE_SOFT_LIMIT 4  // Antrean kirim per klien di atas ini dianggap tertinggal.
+                                      // Jauh di bawah batas antrean library, sehingga
+                                      // balasan perintah (ack/snapshot) selalu masih muat.
+
+// --- Topik Langganan ---
+enum WsTopic : uint8_t {
+  WS_TOPIC_TELEMETRY = 0, // Sensor jarak, suhu, kelembaban, UID RFID (periodik)
+  WS_TOPIC_ORDERS,        // Antrean pesanan & fase seduh (periodik + event menu/kartu/tombol)
+  WS_TOPIC_DIAGNOSTICS,   // Heap, relay, aktuator, I2C (periodik + event aktuator/relay)
+  WS_TOPIC_LOGS,          // Log sistem (berbasis kursor, dikirim saat ada record baru)
+  WS_TOPIC_COUNT
+};
+#define WS_TOPIC_BIT(topic) ((uint8_t)(1u << (topic)))
+// Klien yang belum mengirim "subscribe" menerima semua topik kecuali log
+#define WS_TOPIC_DEFAULT_MASK (WS_TOPIC_BIT(WS_TOPIC_TELEMETRY) | WS_TOPIC_BIT(WS_TOPIC_ORDERS) | \
+                               WS_TOPIC_BIT(WS_TOPIC_DIAGNOSTICS))
+#define WS_TOPIC_MAX_INTERVAL_MS 60000 // Interval periodik terpanjang yang bisa diminta
+
+// Kelas pesan, menentukan kebijakan untuk klien yang tertinggal
+enum WsMessageClass : uint8_t {
+  WS_MSG_PERIODIC = 0, // Dibuang, klien menerima serialisasi berikutnya pada periode selanjutnya
+  WS_MSG_EVENT         // Dibuang, diganti satu snapshot (resync) setelah klien lancar lagi
+};
+
+// Statistik per klien
+struct WsClientStats {
+  uint32_t id;
+  uint8_t topicMask;               // Topik yang dilanggan (WS_TOPIC_BIT)
+  uint16_t queueDepth;             // Panjang antrean kirim terakhir yang terlihat
+  uint16_t maxQueueDepth;
+  unsigned long sent;              // Pesan topik yang dikirim
+  unsigned long droppedPeriodic;
+  unsigned long droppedEvents;
+  unsigned long resyncs;           // Snapshot pengganti event yang dibuang
+};
+
+// --- Prototipe Fungsi Klien WebSocket ---
+// Dipanggil dari onWsEvent (task AsyncTCP). false jika tabel klien penuh.
+bool ws_clients_connected(uint32_t clientId);
+void ws_clients_disconnected(uint32_t clientId);
+
+// Langganan topik (intervalMs 0 = interval bawaan topik)
+bool ws_clients_subscribe(uint32_t clientId, WsTopic topic, unsigned long intervalMs);
+bool ws_clients_unsubscribe(uint32_t clientId, WsTopic topic);
+bool ws_topic_from_name(const char* name, WsTopic& topic);
+const char* ws_topic_name(WsTopic topic);
+WsTopic ws_topic_for_event(EventType type);
+
+// Topik periodik yang punya minimal satu pelanggan jatuh tempo (bitmask WS_TOPIC_BIT)
+uint8_t ws_clients_due_topics(unsigned long currentMillis);
+// Interval tercepat yang diminta pelanggan topik, 0 jika tidak ada pelanggan
+unsigned long ws_clients_fastest_interval(WsTopic topic);
+
+// Kirim pesan event ke semua pelanggan topik
+void ws_clients_publish(AsyncWebSocket& ws, WsTopic topic, const JsonWriter& writer);
+// Kirim pesan periodik hanya ke pelanggan topik yang sudah jatuh tempo
+void ws_clients_publish_due(AsyncWebSocket& ws, WsTopic topic, const JsonWriter& writer,
+                            unsigned long currentMillis);
+void ws_clients_publish_due(AsyncWebSocket& ws, WsTopic topic, const JsonWriter* const* messages,
+                            size_t messageCount, unsigned long currentMillis);
+// Dipanggil dari task jaringan: jadwalkan resync untuk klien yang sudah lancar
+void ws_clients_service(AsyncWebSocket& ws);
+
+// --- Topik Berbasis Kursor (logs) ---
+// Setiap pelanggan menyimpan nomor urut record berikutnya yang belum diterimanya.
+// Kursor terkecil di antara pelanggan yang bisa menerima pesan; pelanggan baru diberi
+// kursor initialCursor. false jika tidak ada pelanggan yang bisa menerima.
+bool ws_clients_min_cursor(AsyncWebSocket& ws, WsTopic topic, uint32_t initialCursor, uint32_t& cursor);
+// Kirim satu batch [from, next) ke pelanggan yang kursornya <= from, lalu majukan
+// kursornya ke next. Klien yang tertinggal tidak dikirimi dan kursornya tetap.
+void ws_clients_publish_cursor(AsyncWebSocket& ws, WsTopic topic, const JsonWriter& writer,
+                               uint32_t from, uint32_t next);
+
+// Satu pesan ke satu klien, tanpa cek backpressure (snapshot resync). Hanya dari task
+// jaringan; task AsyncTCP mengirim ack dengan client->text(data, len).
+bool ws_clients_send(AsyncWebSocket& ws, AsyncWebSocketClient* client, const JsonWriter& writer);
+
+size_t ws_clients_get_stats(WsClientStats* out, size_t maxClients);
+void writeWsClientsJson(JsonWriter& writer, const char* key);
+
+#endif // WS_CLIENTS_H
@@ -0,0 +1,357 @@
+/*
+  src/components/ws_command/ws_command.cpp - Implementasi Parser Perintah WebSocket
+  Menyusun ulang pesan WebSocket yang terfragmentasi ke buffer berukuran tetap,
+  memvalidasi isinya, lalu meneruskan perintah ke handler melalui tabel dispatch
+  constexpr. Tidak ada alokasi heap di seluruh jalur ini.
+
+  Format perintah (teks ASCII, dipisah spasi):
+    toggleRelay                    - Toggle relay web
+    order <menuId>                 - Antrekan pesanan kopi (1=Torabika, 2=Good Day, 3=ABC Susu)
+    cancel                         - Batalkan menu yang belum dikonfirmasi
+    recipe <menuId> <field> <nilai> - Ubah resep (water, heat, hotwater, dose, speed, mixspeed, mix, pour)
+    stats                          - Statistik perintah & pesanan
+    resync                         - Minta snapshot state lengkap (dikirim dari task jaringan)
+    subscribe <topik> [intervalMs] - Langganan topik telemetry/orders/diagnostics/logs
+    unsubscribe <topik>            - Berhenti melanggan topik
+    i2cScan                        - Scan penuh bus I2C (hasil dikirim sebagai pesan "i2cScan")
+*/
+
+#include "ws_command.h"
+#include <stdlib.h>
+#include "components/order_coffee/order_coffee.h"
+#include "components/event_bus/event_bus.h"
+#include "components/ws_clients/ws_clients.h"
+#include "components/i2c_scanner/i2c_scanner.h"
+#include "components/logger/logger.h"
+
+WsCommandStats wsCommandStats = {0, 0, 0, 0};
+
+// --- Buffer Reassembly Pesan Terfragmentasi (satu slot per klien) ---
+struct ReassemblySlot {
+  bool used;
+  bool discarding;          // Pesan melebihi batas, sisa fragment dibuang
+  uint32_t clientId;
+  size_t len;
+  char buffer[WS_COMMAND_MAX_LEN + 1];
+};
+static ReassemblySlot reassemblySlots[WS_COMMAND_MAX_CLIENTS];
+
+// Batas nilai resep yang diterima dari web
+static const unsigned long RECIPE_MAX_DURATION_MS = 60000;
+
+// --- Fungsi Helper ---
+static bool parseLong(const char* text, long& out) {
+  char* end = nullptr;
+  out = strtol(text, &end, 10);
+  return end != text && *end == '\0';
+}
+
+static void writeError(JsonWriter& reply, const char* error) {
+  reply.field("error", error);
+}
+
+// --- Handler Perintah ---
+static bool cmdToggleRelay(const WsCommandArgs& args, JsonWriter& reply) {
+  reply.field("relayState", toggleWebRelay());
+  return true;
+}
+
+static bool cmdOrder(const WsCommandArgs& args, JsonWriter& reply) {
+  long menuId;
+  if (!parseLong(args.argv[0], menuId) || menuId < 1 || menuId > COFFEE_MENU_COUNT) {
+    writeError(reply, "invalidMenu");
+    return false;
+  }
+  reply.field("menu", menuId);
+  uint32_t ticket = requestCoffeeOrder((int)menuId);
+  if (ticket == 0) {
+    writeError(reply, "queueFull");
+    return false;
+  }
+  reply.field("ticket", (unsigned long)ticket);
+  return true;
+}
+
+static bool cmdCancel(const WsCommandArgs& args, JsonWriter& reply) {
+  if (!requestCoffeeCancel()) {
+    writeError(reply, "notCancelable");
+    return false;
+  }
+  return true;
+}
+
+static bool cmdSetRecipe(const WsCommandArgs& args, JsonWriter& reply) {
+  long menuId, value;
+  if (!parseLong(args.argv[0], menuId) || menuId < 1 || menuId > COFFEE_MENU_COUNT) {
+    writeError(reply, "invalidMenu");
+    return false;
+  }
+  if (!parseLong(args.argv[2], value) || value < 0) {
+    writeError(reply, "invalidValue");
+    return false;
+  }
+
+  // Diubah pada salinan lalu ditulis utuh; task kontrol menyalin resep di bawah mux yang sama
+  BrewRecipe recipe = getBrewRecipe((int)menuId);
+  const char* field = args.argv[1];
+  unsigned long* duration = nullptr;
+  uint8_t* speed = nullptr;
+
+  if (strcmp(field, "water") == 0) duration = &recipe.fillWaterMs;
+  else if (strcmp(field, "heat") == 0) duration = &recipe.heatMs;
+  else if (strcmp(field, "hotwater") == 0) duration = &recipe.hotWaterMs;
+  else if (strcmp(field, "dose") == 0) duration = &recipe.dispenseMs;
+  else if (strcmp(field, "mix") == 0) duration = &recipe.mixMs;
+  else if (strcmp(field, "pour") == 0) duration = &recipe.pourMs;
+  else if (strcmp(field, "speed") == 0) speed = &recipe.dispenseSpeed;
+  else if (strcmp(field, "mixspeed") == 0) speed = &recipe.mixerSpeed;
+  else {
+    writeError(reply, "invalidField");
+    return false;
+  }
+
+  if ((duration != nullptr && (unsigned long)value > RECIPE_MAX_DURATION_MS) ||
+      (speed != nullptr && value > 255)) {
+    writeError(reply, "outOfRange");
+    return false;
+  }
+
+  if (duration != nullptr) *duration = (unsigned long)value;
+  else *speed = (uint8_t)value;
+  setBrewRecipe((int)menuId, recipe);
+
+  reply.field("menu", menuId).field("field", field).field("value", value);
+  return true;
+}
+
+// Snapshot disusun di buffer statis task jaringan, sehingga penyusunannya ditunda
+// ke task jaringan dan tidak ada ack terpisah untuk perintah ini.
+static bool cmdResync(const WsCommandArgs& args, JsonWriter& reply) {
+  return requestWsSnapshot(args.clientId);
+}
+
+static bool cmdSubscribe(const WsCommandArgs& args, JsonWriter& reply) {
+  WsTopic topic;
+  long intervalMs = 0;
+  if (!ws_topic_from_name(args.argv[0], topic)) {
+    writeError(reply, "invalidTopic");
+    return false;
+  }
+  reply.field("topic", ws_topic_name(topic));
+  if (args.count > 1 && (!parseLong(args.argv[1], intervalMs) || intervalMs < 0)) {
+    writeError(reply, "invalidValue");
+    return false;
+  }
+  if (!ws_clients_subscribe(args.clientId, topic, (unsigned long)intervalMs)) {
+    writeError(reply, "outOfRange");
+    return false;
+  }
+  return true;
+}
+
+static bool cmdUnsubscribe(const WsCommandArgs& args, JsonWriter& reply) {
+  WsTopic topic;
+  if (!ws_topic_from_name(args.argv[0], topic)) {
+    writeError(reply, "invalidTopic");
+    return false;
+  }
+  reply.field("topic", ws_topic_name(topic));
+  return ws_clients_unsubscribe(args.clientId, topic);
+}
+
+static bool cmdStats(const WsCommandArgs& args, JsonWriter& reply) {
+  reply.beginObject("stats")
+    .field("handled", wsCommandStats.handled)
+    .field("failed", wsCommandStats.failed)
+    .field("rejectedFrames", wsCommandStats.rejectedFrames)
+    .field("unknownCommands", wsCommandStats.unknownCommands)
+    .field("eventsPublished", event_bus_published_count());
+  reply.beginArray("served");
+  for (int i = 1; i <= COFFEE_MENU_COUNT; i++) {
+    reply.value((long)coffeeOrdersServed[i]);
+  }
+  reply.endArray().endObject();
+  return true;
+}
+
+// Scan berjalan di task IO; hasilnya dikirim ke pelanggan diagnostics saat selesai
+static bool cmdI2cScan(const WsCommandArgs& args, JsonWriter& reply) {
+  if (!i2c_scan_request_full()) {
+    writeError(reply, "busy");
+    return false;
+  }
+  return true;
+}
+
+// --- Tabel Dispatch Perintah ---
+static constexpr WsCommand WS_COMMANDS[] = {
+  {"toggleRelay", 0, 0, true,  cmdToggleRelay},
+  {"order",       1, 1, true,  cmdOrder},
+  {"cancel",      0, 0, true,  cmdCancel},
+  {"recipe",      3, 3, true,  cmdSetRecipe},
+  {"stats",       0, 0, true,  cmdStats},
+  {"resync",      0, 0, false, cmdResync},
+  {"subscribe",   1, 2, true,  cmdSubscribe},
+  {"unsubscribe", 1, 1, true,  cmdUnsubscribe},
+  {"i2cScan",     0, 0, true,  cmdI2cScan},
+};
+static constexpr size_t WS_COMMAND_COUNT = sizeof(WS_COMMANDS) / sizeof(WS_COMMANDS[0]);
+
+// --- Balasan Penolakan ---
+// Burst frame buruk cukup dihitung di wsCommandStats; log dibatasi satu record per
+// WS_COMMAND_REJECT_LOG_MS berisi kode error (literal statis) dan jumlah yang dilewati.
+// Hanya dipanggil dari task AsyncTCP, jadi state pembatas tidak perlu dikunci.
+static unsigned long lastRejectLogMs = 0;
+static bool rejectLogged = false;
+static uint32_t rejectsSuppressed = 0;
+
+static void logReject(const char* error) {
+  unsigned long now = millis();
+  if (rejectLogged && now - lastRejectLogMs < WS_COMMAND_REJECT_LOG_MS) {
+    rejectsSuppressed++;
+    return;
+  }
+  LOG_WARN(LOG_MSG_WS_COMMAND_REJECTED, error, rejectsSuppressed);
+  rejectLogged = true;
+  lastRejectLogMs = now;
+  rejectsSuppressed = 0;
+}
+
+static WsCommandResult reject(JsonWriter& reply, const char* cmd, const char* error) {
+  logReject(error);
+  reply.beginObject()
+    .field("type", "ack")
+    .field("cmd", cmd)
+    .field("ok", false)
+    .field("error", error)
+    .endObject();
+  return WS_CMD_REJECTED;
+}
+
+static WsCommandResult rejectFrame(JsonWriter& reply, const char* error) {
+  wsCommandStats.rejectedFrames++;
+  return reject(reply, "", error);
+}
+
+// --- Eksekusi Satu Pesan Lengkap ---
+// 'line' harus diakhiri '\0' dan boleh diubah (token dipisah di tempat).
+static WsCommandResult executeLine(uint32_t clientId, char* line, size_t len, JsonWriter& reply) {
+  for (size_t i = 0; i < len; i++) {
+    uint8_t c = (uint8_t)line[i];
+    if (c < 0x20 || c > 0x7E) return rejectFrame(reply, "badChar");
+  }
+
+  // Pisahkan token berdasarkan spasi
+  char* name = nullptr;
+  WsCommandArgs args;
+  args.clientId = clientId;
+  args.count = 0;
+  char* p = line;
+  while (*p != '\0') {
+    while (*p == ' ') *p++ = '\0';
+    if (*p == '\0') break;
+    if (name == nullptr) {
+      name = p;
+    } else if (args.count < WS_COMMAND_MAX_ARGS) {
+      args.argv[args.count++] = p;
+    } else {
+      return rejectFrame(reply, "tooManyArgs");
+    }
+    while (*p != ' ' && *p != '\0') p++;
+  }
+  if (name == nullptr) return rejectFrame(reply, "empty");
+
+  for (size_t i = 0; i < WS_COMMAND_COUNT; i++) {
+    const WsCommand& command = WS_COMMANDS[i];
+    if (strcmp(command.name, name) != 0) continue;
+
+    if (args.count < command.minArgs || args.count > command.maxArgs) {
+      wsCommandStats.failed++;
+      return reject(reply, command.name, "badArgs");
+    }
+
+    bool ok;
+    if (command.sendAck) {
+      reply.beginObject().field("type", "ack").field("cmd", command.name);
+      ok = command.handler(args, reply);
+      reply.field("ok", ok).endObject();
+    } else {
+      ok = command.handler(args, reply);
+    }
+    if (ok) wsCommandStats.handled++;
+    else wsCommandStats.failed++;
+    return WS_CMD_HANDLED;
+  }
+
+  wsCommandStats.unknownCommands++;
+  return reject(reply, "", "unknownCommand");
+}
+
+// --- Manajemen Slot Reassembly ---
+static ReassemblySlot* findReassemblySlot(uint32_t clientId, bool create) {
+  ReassemblySlot* freeSlot = nullptr;
+  for (int i = 0; i < WS_COMMAND_MAX_CLIENTS; i++) {
+    if (reassemblySlots[i].used) {
+      if (reassemblySlots[i].clientId == clientId) return &reassemblySlots[i];
+    } else if (freeSlot == nullptr) {
+      freeSlot = &reassemblySlots[i];
+    }
+  }
+  if (create && freeSlot != nullptr) {
+    freeSlot->used = true;
+    freeSlot->discarding = false;
+    freeSlot->clientId = clientId;
+    freeSlot->len = 0;
+  }
+  return create ? freeSlot : nullptr;
+}
+
+/**
+ * @brief Memproses satu potongan data WebSocket dari klien.
+ * Pesan satu frame yang utuh langsung dieksekusi dari buffer stack. Pesan yang
+ * terfragmentasi (atau frame yang datang dalam beberapa paket TCP) disusun ulang
+ * di slot klien dan dieksekusi saat potongan terakhir diterima.
+ * @return WS_CMD_INCOMPLETE jika masih menunggu data, selain itu 'reply' berisi balasan.
+ */
+WsCommandResult ws_command_process(uint32_t clientId, const WsFragment& fragment,
+                                   const uint8_t* data, size_t len, JsonWriter& reply) {
+  bool frameDone = fragment.index + len == fragment.frameLen;
+  bool messageDone = frameDone && fragment.finalFrame;
+
+  // --- Jalur cepat: satu frame utuh dalam satu paket ---
+  if (messageDone && fragment.index == 0 && findReassemblySlot(clientId, false) == nullptr) {
+    if (!fragment.isText) return rejectFrame(reply, "binary");
+    if (len > WS_COMMAND_MAX_LEN) return rejectFrame(reply, "tooLong");
+    char line[WS_COMMAND_MAX_LEN + 1];
+    memcpy(line, data, len);
+    line[len] = '\0';
+    return executeLine(clientId, line, len, reply);
+  }
+
+  // --- Jalur reassembly ---
+  ReassemblySlot* slot = findReassemblySlot(clientId, true);
+  if (slot == nullptr) return rejectFrame(reply, "busy"); // Semua slot sedang dipakai
+
+  if (!fragment.isText || slot->len + len > WS_COMMAND_MAX_LEN) {
+    slot->discarding = true;
+  }
+  if (!slot->discarding) {
+    memcpy(slot->buffer + slot->len, data, len);
+    slot->len += len;
+  }
+
+  if (!messageDone) return WS_CMD_INCOMPLETE;
+
+  // Pesan lengkap: lepaskan slot sebelum eksekusi
+  slot->used = false;
+  if (slot->discarding) {
+    return rejectFrame(reply, fragment.isText ? "tooLong" : "binary");
+  }
+  slot->buffer[slot->len] = '\0';
+  return executeLine(clientId, slot->buffer, slot->len, reply);
+}
+
+void ws_command_client_disconnected(uint32_t clientId) {
+  ReassemblySlot* slot = findReassemblySlot(clientId, false);
+  if (slot != nullptr) slot->used = false;
+}
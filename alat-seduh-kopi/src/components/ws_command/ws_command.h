@@ -0,0 +1,65 @@
+#ifndef WS_COMMAND_H
+#define WS_COMMAND_H
+
+#include <Arduino.h>
+#include "components/json_writer/json_writer.h"
+
+// --- Konfigurasi Parser Perintah WebSocket ---
+#define WS_COMMAND_MAX_LEN 128    // Panjang maksimum satu perintah (setelah reassembly)
+#define WS_COMMAND_MAX_CLIENTS 4  // Jumlah klien yang bisa mengirim pesan terfragmentasi bersamaan
+#define WS_COMMAND_MAX_ARGS 4     // Jumlah maksimum argumen setelah nama perintah
+#define WS_COMMAND_REPLY_SIZE 256 // Ukuran buffer balasan JSON
+#define WS_COMMAND_REJECT_LOG_MS 1000 // Paling banyak satu log penolakan per periode ini
+
+// Potongan frame WebSocket yang diterima (disalin dari AwsFrameInfo oleh main.cpp)
+struct WsFragment {
+  bool finalFrame;     // Frame terakhir dari pesan (FIN)
+  bool isText;         // Opcode pesan adalah teks
+  uint64_t index;      // Offset data ini di dalam frame
+  uint64_t frameLen;   // Panjang total frame
+};
+
+// Argumen perintah yang sudah dipisah per spasi (menunjuk ke buffer reassembly)
+struct WsCommandArgs {
+  uint32_t clientId;  // Klien pengirim perintah
+  uint8_t count;
+  const char* argv[WS_COMMAND_MAX_ARGS];
+};
+
+// Handler perintah. Mengisi 'reply' dan mengembalikan true jika perintah berhasil.
+typedef bool (*WsCommandHandler)(const WsCommandArgs& args, JsonWriter& reply);
+
+struct WsCommand {
+  const char* name;
+  uint8_t minArgs;
+  uint8_t maxArgs;
+  bool sendAck;       // false jika handler mengirim balasannya sendiri (mis. snapshot)
+  WsCommandHandler handler;
+};
+
+// Hasil pemrosesan satu potongan frame
+enum WsCommandResult : uint8_t {
+  WS_CMD_INCOMPLETE = 0, // Menunggu potongan/fragment berikutnya
+  WS_CMD_HANDLED,        // Perintah dieksekusi, balasan (jika ada) ada di 'reply'
+  WS_CMD_REJECTED        // Frame/perintah ditolak, alasan ada di 'reply'
+};
+
+// Statistik parser
+struct WsCommandStats {
+  unsigned long handled;
+  unsigned long failed;          // Perintah dikenal tapi handler mengembalikan false
+  unsigned long rejectedFrames;  // Frame biner, terlalu panjang, atau karakter tidak valid
+  unsigned long unknownCommands;
+};
+extern WsCommandStats wsCommandStats;
+
+// --- Disediakan oleh main.cpp ---
+bool toggleWebRelay(); // Toggle relay web pada motorPin, mengembalikan state yang baru
+bool requestWsSnapshot(uint32_t clientId); // Jadwalkan pengiriman snapshot dari task jaringan
+
+// --- Prototipe Fungsi Parser Perintah ---
+WsCommandResult ws_command_process(uint32_t clientId, const WsFragment& fragment,
+                                   const uint8_t* data, size_t len, JsonWriter& reply);
+void ws_command_client_disconnected(uint32_t clientId);
+
+#endif // WS_COMMAND_H
@@ -4,15 +4,20 @@ Versi: Terintegrasi dengan RFID RC522 (RST Pin 2), Logika Menu Kopi, dan DHT22
 
 Deskripsi:
 Kode ini mengimplementasikan server web asinkron pada ESP32 untuk:
-1. Menghubungkan ke jaringan Wi-Fi (dengan debugging status koneksi).
-2. Melayani file web (index.html) dari SPIFFS.
+1. Menghubungkan ke jaringan Wi-Fi di latar belakang (modul 'boot_sequence'): hardware
+    diinisialisasi lebih dulu tanpa delay, sehingga pesanan lokal diterima sebelum WiFi
+    & server web siap. Durasi setiap tahap boot dicatat di Serial & /api/metrics.
+    Link WiFi dijaga modul 'wifi_service' (reconnect dengan backoff eksponensial); event
+    yang terjadi saat offline dijurnal dan dikirim ulang ke klien web setelah link naik.
+2. Melayani file web (index.html) dari SPIFFS dalam bentuk gzip dengan ETag & Cache-Control.
 3. Menggunakan WebSocket untuk komunikasi real-time dua arah.
 4. Mengontrol status sebuah relay (yang terhubung ke motor atau perangkat lain)
     melalui pesan WebSocket dari klien web.
 5. Membaca data dari sensor jarak (asumsi HC-SR04 atau sejenisnya)
     melalui library 'storage_detector' dan mengirimkannya ke klien web secara periodik.
 6. Menampilkan status sistem, IP Address, dan data sensor pada LCD I2C.
-7. Melakukan pemindaian I2C saat startup untuk mendeteksi perangkat I2C yang terhubung
+7. Melakukan pemindaian I2C (modul 'i2c_scanner') tanpa menahan boot: scan cepat rentang
+    PCF8574 setelah web server aktif, scan penuh atas permintaan dari halaman diagnostik,
     dan mengirimkan hasilnya ke klien web.
 8. Mengelola input dari 4 push button dan mengontrol 2 LED pada PCF8574 kedua (0x21)
     melalui modul 'order_coffee' yang terpisah, dan menampilkan status tombol di web. <<< DIUBAH
@@ -20,10 +25,62 @@ Kode ini mengimplementasikan server web asinkron pada ESP32 untuk:
     dan menampilkannya pada Serial Monitor, LCD, dan halaman web.
 10. Membaca data dari sensor DHT22 (suhu & kelembaban) melalui modul
     'temperature_humidity' dan mengirimkannya ke klien web.
+11. Meneruskan event perubahan state (tombol, kartu, fase seduh, aktuator, relay)
+    dari modul 'event_bus' ke klien web secara langsung, dengan rate limit & coalescing.
+    Klien yang lambat tidak diberi pesan baru (modul 'ws_clients'), sehingga heap tetap stabil.
+12. Menyediakan REST API (/api/status, /api/order, /api/queue, /api/metrics, /api/tasks, /api/i2c)
+    melalui modul 'web_api' untuk integrasi kasir tanpa WebSocket.
+13. Klien WebSocket melanggan topik (telemetry, orders, diagnostics, logs) dengan interval
+    masing-masing; setiap topik disusun sekali per tick dan dikirim hanya ke pelanggannya.
+14. Menjalankan semua pekerjaan loop() sebagai task periodik/one-shot pada modul
+    'scheduler', dengan prioritas, deadline, dan statistik waktu eksekusi per task.
+15. Membagi task scheduler ke tiga task FreeRTOS (modul 'rtos_tasks'): kontrol mesin
+    (core 1, prioritas tertinggi), jaringan (core 0), dan sensor/RFID/LCD (loopTask).
+    Data antar task lewat antrean lock-free SPSC dan snapshot SeqLock ('machine_state').
+16. Mengukur waktu eksekusi setiap handler komponen dengan cycle counter (modul
+    'perf_probe'), dilaporkan sebagai histogram p50/p99/max di topik diagnostics & Serial.
+17. Mengatur bus I2C bersama (modul 'i2c_bus'): Wire dimulai sekali dengan clock
+    tertinggi yang didukung semua perangkat, transaksi antre menurut prioritas
+    (motor > front panel > LCD), dengan statistik transaksi, error & latensi per perangkat.
+18. Membaca tombol front panel hanya saat pin INT PCF8574 0x21 (GPIO39) aktif: satu
+    pembacaan byte untuk 8 pin, LED ditulis dari shadow register. Tanpa penekanan
+    tombol, front panel tidak menimbulkan lalu lintas I2C.
+19. Debounce tombol front panel bit-paralel (counter vertikal, 'port_debouncer.h') dengan
+    event tekan, lepas, tahan & tekan ganda. PB4 dikonfirmasi saat dilepas; PB4 ditahan
+    1 detik membatalkan menu yang dipilih.
+20. Log runtime melalui modul 'logger': pemanggil hanya menulis record biner berukuran
+    tetap (ID pesan + argumen) ke ring buffer lock-free; format teks & penulisan ke UART
+    dikerjakan task "logDrain" sebatas ruang buffer TX. Level di atas LOG_LEVEL dibuang
+    saat kompilasi.
+21. Log sistem bisa dipantau dari dashboard tanpa kabel USB: topik WebSocket "logs"
+    (kursor per klien, batch diformat sekali untuk semua pelanggan) dan
+    GET /api/logs?since=<seq>. Pembaca hanya membaca ring buffer, tanpa menahan producer.
+22. Tanpa Arduino String di state global & jalur runtime: UID RFID disimpan di buffer
+    char tetap, status stok kopi berupa enum (teks statis), dan parameter teks berupa
+    const char*, agar heap tidak terfragmentasi selama mesin menyala berhari-hari.
+23. Memantau heap & stack (modul 'memory_monitor'): heap bebas, blok terbesar,
+    fragmentasi & sisa stack task control/network/io disampel setiap detik, dengan
+    riwayat min/max per menit di topik diagnostics dan event "memory" saat fragmentasi
+    melewati ambang.
+24. Akses perangkat keras lewat HAL tipis (modul 'hal': GPIO, PWM, I2C, SPI, clock)
+    dengan backend ESP32 dan backend host. Env PlatformIO 'native' mengompilasi
+    firmware yang sama untuk Linux terhadap periferal simulasi (PCF8574, LCD, HC-SR04,
+    DHT22, RC522) yang bisa digerakkan dari konsol stdin, lihat lib/arduino_host.
+25. Simulator siklus seduh (folder 'sim', env 'sim'): komponen firmware yang sama dijalankan
+    dengan clock virtual terhadap model pompa, pemanas, hopper & pelanggan (web dan
+    kartu + tombol), melaporkan waktu siklus, on-time aktuator & waktu tunggu antrean.
+    Mode '--soak-hours 72' memeriksa heap firmware tetap datar selama 72 jam virtual.
+26. Microbenchmark jalur panas (folder 'bench', env 'bench' & 'bench_esp32'): serializer
+    telemetri, format UID, debounce front panel, konversi jarak & scene LCD, dengan
+    ns/op, alokasi/op & byte/op dalam JSON/CSV (scripts/bench_compare.py).
 
 Asumsi:
-- Ada file 'index.html' yang tersimpan di SPIFFS.
+- Ada file 'index.html.gz' & 'assets.manifest' di SPIFFS (dibuat dari folder 'data/'
+  oleh scripts/compress_assets.py saat 'pio run -t uploadfs').
+  Pada env 'esp32dev_embedded' (-D DASHBOARD_EMBEDDED) aset ikut tertanam di firmware
+  dan SPIFFS tidak dimount saat boot.
 - Library 'storage_detector' berfungsi untuk membaca sensor jarak (kode implementasi di file terpisah).
+- Pin INT PCF8574 front panel terhubung ke GPIO39 dengan pull-up eksternal 10k ke 3V3.
 - 'motorPin' (GPIO 4) terhubung ke relay yang mengontrol motor,
 dengan logika aktif LOW (HIGH = OFF, LOW = ON).
 - Pin-pin untuk sensor jarak (SD_TRIG_PIN_1, SD_ECHO_PIN_1, dst.)
@@ -38,13 +95,15 @@ didefinisikan di 'components/storage_detector/storage_detector.h'.
 // --- Bagian 1: Inklusi Library & Komponen ---
 #include <Arduino.h>
 #include <WiFi.h>
+#ifndef DASHBOARD_EMBEDDED
 #include <SPIFFS.h>
+#endif
 #include <ESPAsyncWebServer.h>
 #include <AsyncTCP.h>
-#include <vector> // Diperlukan untuk std::vector
 #include <Wire.h> // Diperlukan untuk komunikasi I2C
 #include <SPI.h> // Diperlukan untuk komunikasi SPI (digunakan oleh RFID)
 #include <Adafruit_PCF8574.h> // Diperlukan untuk PCF8574
+#include <atomic>
 
 // --- Inklusi Komponen Lokal Anda ---
 #include "components/lcd_display/lcd_display.h"
@@ -53,6 +112,26 @@ didefinisikan di 'components/storage_detector/storage_detector.h'.
 #include "components/rfid_card_reader/rfid_card_reader.h"
 #include "components/temperature_humidity/temperature_humidity.h"
 #include "components/motor_control/motor_control.h"
+#include "components/event_bus/event_bus.h"
+#include "components/json_writer/json_writer.h"
+#include "components/telemetry/telemetry.h"
+#include "components/ws_command/ws_command.h"
+#include "components/web_assets/web_assets.h"
+#include "components/web_api/web_api.h"
+#include "components/ws_clients/ws_clients.h"
+#include "components/scheduler/scheduler.h"
+#include "components/rtos_tasks/rtos_tasks.h"
+#include "components/rtos_tasks/spsc_queue.h"
+#include "components/machine_state/machine_state.h"
+#include "components/perf_probe/perf_probe.h"
+#include "components/i2c_bus/i2c_bus.h"
+#include "components/i2c_scanner/i2c_scanner.h"
+#include "components/boot_sequence/boot_sequence.h"
+#include "components/wifi_service/wifi_service.h"
+#include "components/logger/logger.h"
+#include "components/log_stream/log_stream.h"
+#include "components/memory_monitor/memory_monitor.h"
+#include "components/hal/hal.h"
 
 // --- Bagian 2: Konfigurasi Wi-Fi ---
 const char* ssid = "Coffee WD";
@@ -60,111 +139,399 @@ const char* password = "coffeewd123";
 
 // --- Bagian 3: Konfigurasi Perangkat Keras & Variabel Status ---
 const int motorPin = 4;
-bool motorState = LOW;
+std::atomic<bool> motorState(false); // Ditulis dari task AsyncTCP, dibaca task jaringan
 
 // --- Bagian 4: Objek Server Web & WebSocket ---
 AsyncWebServer server(80);
 AsyncWebSocket ws("/ws");
 
-// --- Bagian 5: Pengaturan Interval Pembacaan Sensor ---
-unsigned long lastSensorReadMillis = 0;
-const long sensorReadInterval = 2000; // Interval 2 detik
+// --- Bagian 5: Pengaturan Interval Task ---
+const unsigned long sensorReadInterval = 2000;             // Pembacaan sensor jarak (2 detik)
+const unsigned long SENSOR_DISPLAY_ROTATE_INTERVAL = 3000; // Rotasi data sensor di LCD (3 detik)
+const unsigned long WEB_API_TASK_INTERVAL = 50;            // Pengecekan cache /api/status
+const unsigned long TOPIC_TASK_INTERVAL = 10;              // Pengecekan topik WebSocket jatuh tempo
+int sensorTaskId = -1;
+int sensorDisplayMode = 0; // 0=Jarak, 1=DHT, 2=RFID/Motor
 
 // --- Bagian 7: Definisi Alamat PCF8574 ---
-#define PCF8574_MOTOR_CONTROL_ADDRESS 0x20// Alamat I2C PCF8574 pertama (jika digunakan)
-#define PCF8574_FRONT_PANEL_ADDRESS 0x21 // Alamat I2C PCF8574 kedua (untuk Front Panel/Order Coffee)
+#define PCF8574_MOTOR_CONTROL_ADDRESS I2C_MOTOR_ADDRESS // Alamat I2C PCF8574 pertama (jika digunakan)
+#define PCF8574_FRONT_PANEL_ADDRESS I2C_FRONT_PANEL_ADDRESS // Alamat I2C PCF8574 kedua (untuk Front Panel/Order Coffee)
 Adafruit_PCF8574 pcf1; // Deklarasi objek PCF8574 (jika digunakan)
 
-// --- Bagian 8: GLOBAL VARIABLE UNTUK MENYIMPAN HASIL I2C SCAN ---
-String i2cScanResultsJson = "{\"type\":\"i2cScan\",\"addresses\":[]}";
+// --- Bagian 8: Buffer Serialisasi JSON ---
+// Buffer statis untuk telemetri periodik & snapshot (hanya dipakai dari task jaringan).
+// Pesan lain disusun di buffer stack agar aman dipanggil dari task AsyncTCP.
+char telemetryJsonBuffer[TELEMETRY_JSON_BUFFER_SIZE];
+char snapshotJsonBuffer[SNAPSHOT_JSON_BUFFER_SIZE];
+char topicJsonBuffer[TOPIC_JSON_BUFFER_SIZE];
+char memoryJsonBuffer[MEMORY_JSON_BUFFER_SIZE];
+#if PERF_PROBE_ENABLED
+char perfJsonBuffer[PERF_JSON_BUFFER_SIZE];
+#endif
+
+// Pesan hanya diserialisasi sekali, lalu ws_clients_publish() membagikan satu buffer
+// pesan (refcount) ke pelanggan topiknya, sesuai kebijakan backpressure (klien yang tertinggal tidak
+// diberi pesan baru).
+
+// Menyusun setiap topik periodik yang jatuh tempo tepat sekali, lalu mengirimnya
+// hanya ke pelanggan yang jatuh tempo (interval dipilih masing-masing klien).
+void publishDueTopics(unsigned long currentMillis) {
+    uint8_t due = ws_clients_due_topics(currentMillis);
+    if (due == 0) return;
+
+    if (due & WS_TOPIC_BIT(WS_TOPIC_TELEMETRY)) {
+        JsonWriter writer(telemetryJsonBuffer, sizeof(telemetryJsonBuffer));
+        writeTelemetryJson(writer);
+        ws_clients_publish_due(ws, WS_TOPIC_TELEMETRY, writer, currentMillis);
+    }
+    if (due & WS_TOPIC_BIT(WS_TOPIC_ORDERS)) {
+        JsonWriter writer(topicJsonBuffer, sizeof(topicJsonBuffer));
+        writeOrdersJson(writer);
+        ws_clients_publish_due(ws, WS_TOPIC_ORDERS, writer, currentMillis);
+    }
+    if (due & WS_TOPIC_BIT(WS_TOPIC_DIAGNOSTICS)) {
+        JsonWriter writer(topicJsonBuffer, sizeof(topicJsonBuffer));
+        writeDiagnosticsJson(writer, motorState);
+        // Heap & stack ikut topik diagnostics sebagai pesan "memory" terpisah
+        JsonWriter memoryWriter(memoryJsonBuffer, sizeof(memoryJsonBuffer));
+        writeMemoryJson(memoryWriter);
+#if PERF_PROBE_ENABLED
+        // Histogram probe ikut topik diagnostics sebagai pesan "perf" terpisah
+        JsonWriter perfWriter(perfJsonBuffer, sizeof(perfJsonBuffer));
+        writePerfJson(perfWriter);
+        const JsonWriter* messages[] = {&writer, &memoryWriter, &perfWriter};
+        ws_clients_publish_due(ws, WS_TOPIC_DIAGNOSTICS, messages, 3, currentMillis);
+#else
+        const JsonWriter* messages[] = {&writer, &memoryWriter};
+        ws_clients_publish_due(ws, WS_TOPIC_DIAGNOSTICS, messages, 2, currentMillis);
+#endif
+    }
+}
+
+// --- Bagian 8b: Penerusan Event Bus ke WebSocket ---
+// Event dipublikasikan dari task kontrol, task IO, atau AsyncTCP. onBusEvent() hanya
+// memasukkan event ke antrean SPSC milik task publisher (tanpa kunci, tanpa I/O jaringan),
+// sehingga task kontrol tidak pernah menunggu WebSocket. Task jaringan mengosongkan
+// antrean, lalu mengirim langsung atau menahan event yang datang lebih cepat dari
+// WS_EVENT_MIN_INTERVAL_MS di slot pending (event terbaru menimpa yang lama).
+const unsigned long WS_EVENT_MIN_INTERVAL_MS = 20; // Rate limit per jenis+id event
+const int WS_EVENT_SLOT_COUNT = 24;                // Jumlah slot rate limit/coalescing
+const size_t WS_EVENT_QUEUE_SIZE = 16;             // Antrean event per task publisher
+
+struct WsEventSlot {
+    bool used;
+    bool pending;
+    EventType type;
+    uint8_t id;
+    unsigned long lastSentMillis;
+    BusEvent event; // Event terbaru yang menunggu dikirim
+};
+
+// Slot hanya disentuh oleh task jaringan
+WsEventSlot wsEventSlots[WS_EVENT_SLOT_COUNT];
+unsigned long wsEventsCoalesced = 0;
+// Satu antrean per peran task: producer = task publisher, consumer = task jaringan
+SpscQueue<BusEvent, WS_EVENT_QUEUE_SIZE + 1> wsEventQueues[TASK_ROLE_COUNT];
+
+void sendWsEvent(const BusEvent& event, bool replayed = false) {
+    char json[EVENT_JSON_BUFFER_SIZE];
+    JsonWriter writer(json, sizeof(json));
+    writeEventJson(writer, event, replayed);
+    ws_clients_publish(ws, ws_topic_for_event(event.type), writer);
+}
+
+// --- Jurnal Event Offline ---
+// Selama link WiFi turun, event tetap dikeluarkan dari antrean SPSC (task publisher tidak
+// terpengaruh) dan disimpan di ring buffer; jika penuh, event terlama dibuang. Setelah link
+// naik dan ada klien WebSocket, isi jurnal dikirim ulang berurutan dengan tanda "replay",
+// beberapa event per putaran. Selama jurnal belum kosong, event baru ikut masuk jurnal
+// agar urutan tetap terjaga. Hanya disentuh task jaringan.
+const size_t WS_OFFLINE_EVENT_CAPACITY = 32;
+const int WS_REPLAY_PER_PASS = 4;
+BusEvent offlineEvents[WS_OFFLINE_EVENT_CAPACITY];
+size_t offlineEventHead = 0;
+size_t offlineEventCount = 0;
+unsigned long offlineEventsDropped = 0;
+unsigned long offlineEventsReplayed = 0;
+unsigned long linkUpMillis = 0; // Event sebelum waktu ini ditandai "replay"
+
+void journalOfflineEvent(const BusEvent& event) {
+    if (offlineEventCount == WS_OFFLINE_EVENT_CAPACITY) {
+        offlineEventHead = (offlineEventHead + 1) % WS_OFFLINE_EVENT_CAPACITY;
+        offlineEventCount--;
+        offlineEventsDropped++;
+    }
+    offlineEvents[(offlineEventHead + offlineEventCount) % WS_OFFLINE_EVENT_CAPACITY] = event;
+    offlineEventCount++;
+}
+
+void replayOfflineEvents() {
+    if (offlineEventCount == 0 || !wifi_service_online() || ws.count() == 0) return;
+    for (int i = 0; i < WS_REPLAY_PER_PASS && offlineEventCount > 0; i++) {
+        const BusEvent& event = offlineEvents[offlineEventHead];
+        sendWsEvent(event, (long)(event.timestamp - linkUpMillis) < 0);
+        offlineEventHead = (offlineEventHead + 1) % WS_OFFLINE_EVENT_CAPACITY;
+        offlineEventCount--;
+        offlineEventsReplayed++;
+    }
+    if (offlineEventCount == 0) {
+        Serial.printf("[WiFi] Event offline terkirim ulang (total %lu, dibuang %lu).\n",
+                      offlineEventsReplayed, offlineEventsDropped);
+    }
+}
+
+WsEventSlot* findWsEventSlot(EventType type, uint8_t id) {
+    WsEventSlot* freeSlot = nullptr;
+    for (int i = 0; i < WS_EVENT_SLOT_COUNT; i++) {
+        if (wsEventSlots[i].used) {
+            if (wsEventSlots[i].type == type && wsEventSlots[i].id == id) return &wsEventSlots[i];
+        } else if (freeSlot == nullptr) {
+            freeSlot = &wsEventSlots[i];
+        }
+    }
+    if (freeSlot != nullptr) {
+        freeSlot->used = true;
+        freeSlot->pending = false;
+        freeSlot->type = type;
+        freeSlot->id = id;
+        freeSlot->lastSentMillis = 0;
+    }
+    return freeSlot;
+}
+
+// Subscriber event bus: dijalankan di task publisher, hanya mengantrekan event
+void onBusEvent(const BusEvent& event) {
+    wsEventQueues[rtos_current_role()].push(event); // Penuh = event dibuang & dihitung
+}
+
+// Kirim langsung atau tahan jika event sejenis baru saja dikirim
+void forwardWsEvent(const BusEvent& event, unsigned long currentMillis) {
+    if (!wifi_service_online() || offlineEventCount > 0) {
+        journalOfflineEvent(event);
+        return;
+    }
+    WsEventSlot* slot = findWsEventSlot(event.type, event.id);
+    if (slot != nullptr) {
+        if (currentMillis - slot->lastSentMillis < WS_EVENT_MIN_INTERVAL_MS) {
+            if (slot->pending) wsEventsCoalesced++; // Event lama ditimpa yang terbaru
+            slot->event = event;
+            slot->pending = true;
+            return;
+        }
+        slot->lastSentMillis = currentMillis;
+        slot->pending = false;
+    }
+    sendWsEvent(event);
+}
+
+// Kosongkan antrean event dari semua task publisher
+void drainWsEventQueues(unsigned long currentMillis) {
+    BusEvent event;
+    for (int role = 0; role < TASK_ROLE_COUNT; role++) {
+        while (wsEventQueues[role].pop(event)) forwardWsEvent(event, currentMillis);
+    }
+}
+
+// Kirim event yang ditahan setelah interval rate limit terlewati
+void flushPendingWsEvents(unsigned long currentMillis) {
+    for (int i = 0; i < WS_EVENT_SLOT_COUNT; i++) {
+        WsEventSlot& slot = wsEventSlots[i];
+        if (slot.used && slot.pending && currentMillis - slot.lastSentMillis >= WS_EVENT_MIN_INTERVAL_MS) {
+            slot.pending = false;
+            slot.lastSentMillis = currentMillis;
+            sendWsEvent(slot.event);
+        }
+    }
+}
 
 // --- Bagian 9: Fungsi Callback WebSocket ---
 void onWsEvent(AsyncWebSocket *server, AsyncWebSocketClient *client,
                 AwsEventType type, void *arg, uint8_t *data, size_t len) {
     if(type == WS_EVT_CONNECT){
-        Serial.printf("WebSocket client #%u connected.\n", client->id());
-        String jsonRelay = "{\"relayState\":";
-        jsonRelay += (motorState ? "true" : "false");
-        jsonRelay += "}";
-        client->text(jsonRelay);
-        client->text(i2cScanResultsJson); // Kirim hasil I2C scan
+        // State awal dikirim sebagai snapshot setelah klien mengirim "resync"
+        LOG_INFO(LOG_MSG_WS_CONNECTED, client->id());
+        if (!ws_clients_connected(client->id())) {
+            LOG_WARN(LOG_MSG_WS_CLIENTS_FULL, client->id());
+            client->close();
+        }
     }
     else if(type == WS_EVT_DISCONNECT){
-        Serial.printf("WebSocket client #%u disconnected.\n", client->id());
+        LOG_INFO(LOG_MSG_WS_DISCONNECTED, client->id());
+        ws_command_client_disconnected(client->id());
+        ws_clients_disconnected(client->id());
     }
     else if(type == WS_EVT_DATA){
-        String msg = (char*)data;
-        Serial.println("Pesan dari client: " + msg);
-        if(msg == "toggleRelay"){
-            motorState = !motorState;
-            digitalWrite(motorPin, motorState ? LOW : HIGH);
-            Serial.printf("Motor diubah ke: %s.\n", motorState ? "ON" : "OFF");
-            String json = "{\"relayState\":";
-            json += (motorState ? "true" : "false");
-            json += "}";
-            ws.textAll(json);
+        // Payload tidak diakhiri '\0' dan bisa terfragmentasi, serahkan ke parser perintah
+        AwsFrameInfo* info = (AwsFrameInfo*)arg;
+        WsFragment fragment;
+        fragment.finalFrame = info->final;
+        fragment.isText = info->message_opcode == WS_TEXT;
+        fragment.index = info->index;
+        fragment.frameLen = info->len;
+
+        char replyJson[WS_COMMAND_REPLY_SIZE];
+        JsonWriter reply(replyJson, sizeof(replyJson));
+        WsCommandResult result = ws_command_process(client->id(), fragment, data, len, reply);
+        if (result == WS_CMD_INCOMPLETE) return; // Penolakan dihitung & dilog (dibatasi) oleh ws_command
+        if (!reply.overflowed() && reply.length() > 0) {
+            // Balasan hanya untuk pengirim. Disalin langsung oleh AsyncTCP, tanpa buffer
+            // bersama, karena buffer bersama hanya dikelola task jaringan (ws_clients)
+            client->text(reply.c_str(), reply.length());
         }
     }
 }
 
-// --- Bagian 10: Fungsi I2C Scanner ---
-std::vector<String> i2cScanner() {
-    Serial.println("\n--- Memulai I2C Scanner ---");
-    lcd.clear(); // Gunakan objek lcd yang sudah extern dari lcd_display.h
-    lcd.setCursor(0, 0);
-    lcd.print("Scanning I2C...");
-
-    byte error, address;
-    int nDevices = 0;
-    std::vector<String> foundAddresses;
-
-    for(address = 1; address < 127; address++ ) {
-    Wire.beginTransmission(address);
-    error = Wire.endTransmission();
-        if (error == 0) {
-            String addrStr = "0x";
-            if (address < 16) addrStr += "0";
-            addrStr += String(address, HEX);
-
-            foundAddresses.push_back(addrStr);
-
-            Serial.print("I2C device found at address: ");
-            Serial.println(addrStr);
-
-            // Tampilkan 2 alamat per baris, 2 baris total
-            lcd.setCursor(nDevices % 2 == 0 ? 0 : 10, (nDevices / 2) + 1);
-            lcd.print(addrStr);
-            nDevices++;
-            if (nDevices >= 4) { // Pindah layar LCD setelah 4 device terdeteksi
-                delay(1000);
-                lcd.clear();
-                lcd.setCursor(0,0);
-                lcd.print("Scanning I2C (cont)...");
-                nDevices = 0; // Reset counter untuk baris LCD
-            }
+// Toggle relay web (dipanggil oleh perintah "toggleRelay" dari ws_command)
+bool toggleWebRelay() {
+    bool newState = !motorState.load();
+    motorState.store(newState);
+    hal_gpio_write(motorPin, newState ? LOW : HIGH);
+    LOG_INFO(LOG_MSG_RELAY_TOGGLED, newState ? "ON" : "OFF");
+    event_bus_publish(EVT_RELAY, 0, newState ? 1 : 0); // Diteruskan ke semua klien oleh onBusEvent()
+    return newState;
+}
+
+// --- Bagian 9b: Snapshot State untuk Klien yang (Re)connect ---
+// Perintah "resync" datang dari task AsyncTCP, sedangkan snapshot disusun di buffer
+// statis task jaringan, sehingga ID klien diantrekan di sini dan snapshot dikirim
+// oleh flushPendingSnapshots().
+const int PENDING_SNAPSHOT_MAX = 8;
+uint32_t pendingSnapshotClients[PENDING_SNAPSHOT_MAX];
+int pendingSnapshotCount = 0;
+portMUX_TYPE pendingSnapshotMux = portMUX_INITIALIZER_UNLOCKED;
+
+bool requestWsSnapshot(uint32_t clientId) {
+    bool queued = false;
+    portENTER_CRITICAL(&pendingSnapshotMux);
+    for (int i = 0; i < pendingSnapshotCount; i++) {
+        if (pendingSnapshotClients[i] == clientId) queued = true; // Sudah diantrekan
+    }
+    if (!queued && pendingSnapshotCount < PENDING_SNAPSHOT_MAX) {
+        pendingSnapshotClients[pendingSnapshotCount++] = clientId;
+        queued = true;
+    }
+    portEXIT_CRITICAL(&pendingSnapshotMux);
+    return queued;
+}
+
+void flushPendingSnapshots() {
+    while (true) {
+        uint32_t clientId;
+        portENTER_CRITICAL(&pendingSnapshotMux);
+        bool hasPending = pendingSnapshotCount > 0;
+        if (hasPending) clientId = pendingSnapshotClients[--pendingSnapshotCount];
+        portEXIT_CRITICAL(&pendingSnapshotMux);
+        if (!hasPending) return;
+
+        AsyncWebSocketClient* client = ws.client(clientId);
+        if (client == nullptr) continue; // Klien sudah terputus
+
+        JsonWriter writer(snapshotJsonBuffer, sizeof(snapshotJsonBuffer));
+        writeSnapshotJson(writer, motorState);
+        if (writer.overflowed()) {
+            LOG_WARN(LOG_MSG_WS_SNAPSHOT_OVERFLOW);
+            continue;
         }
+        ws_clients_send(ws, client, writer);
     }
+}
 
-    if (foundAddresses.empty()) {
-        Serial.println("\nTidak ada perangkat I2C ditemukan.");
-        lcd.setCursor(0, 1);
-        lcd.print("No I2C Devices Found!");
-    } else {
-        Serial.println("\nScan selesai. " + String(foundAddresses.size()) + " perangkat I2C ditemukan.");
-        lcd.setCursor(0, 0);
-        lcd.print("I2C Found: ");
-        lcd.print(foundAddresses.size());
-        delay(2000);
+// --- Bagian 10: Task Scheduler Milik main.cpp ---
+// Task komponen (order, rfid, dht, lcd, brew) didaftarkan oleh fungsi setup komponennya.
+// Grup: ws/topics/webApi = task jaringan, sensors/lcdRotate = task IO (loopTask).
+
+// Kirim hasil scan I2C ke pelanggan diagnostics setiap kali scan (cepat/penuh) selesai
+static uint32_t publishedI2cScanVersion = 0;
+void publishI2cScan() {
+    uint32_t version = i2c_scan_version();
+    if (version == publishedI2cScanVersion) return;
+    publishedI2cScanVersion = version;
+
+    JsonWriter writer(topicJsonBuffer, sizeof(topicJsonBuffer));
+    writeI2cScanJson(writer);
+    ws_clients_publish(ws, WS_TOPIC_DIAGNOSTICS, writer);
+}
+
+// Jaringan: bersihkan klien terputus, kirim event baru & tertahan, log, resync & snapshot
+void wsTask(unsigned long currentMillis) {
+    PERF_PROBE_SCOPE(PROBE_WS);
+    ws.cleanupClients();
+    drainWsEventQueues(currentMillis);
+    replayOfflineEvents();
+    flushPendingWsEvents(currentMillis);
+    publishI2cScan();
+    publishLogStream(ws);   // Batch log baru untuk pelanggan topik logs
+    ws_clients_service(ws); // Jadwalkan resync untuk klien yang sudah lancar
+    flushPendingSnapshots();
+}
+
+void webApiTask(unsigned long currentMillis) {
+    PERF_PROBE_SCOPE(PROBE_WEB_API);
+    handleWebApi(currentMillis, motorState); // Perbarui cache /api/status
+}
+
+// Pembacaan sensor jarak
+void sensorTask(unsigned long currentMillis) {
+    readTelemetrySensors();
+}
+
+// Rotasi data sensor di LCD, hanya jika tidak ada menu aktif atau sedang diproses
+void displayRotateTask(unsigned long currentMillis) {
+    ControlSnapshot control = machine_state_control(); // State menu milik task kontrol
+    if (!control.menuActive && !control.menuConfirmed) {
+        sensorDisplayMode = (sensorDisplayMode + 1) % 3; // Rotasi antara 0, 1, 2
     }
+}
+
+// Pengiriman topik periodik ke klien WebSocket. Data tetap dikirim ke web meskipun
+// menu aktif atau sedang diproses; LCD sudah diupdate oleh komponen order_coffee.
+// Periode task sensor (grup IO) disesuaikan dari sini lewat scheduler_set_period().
+void topicsTask(unsigned long currentMillis) {
+    PERF_PROBE_SCOPE(PROBE_TOPICS);
+    // Sensor dibaca lebih sering jika ada klien yang melanggan telemetri dengan interval lebih cepat
+    unsigned long readInterval = sensorReadInterval;
+    unsigned long telemetryInterval = ws_clients_fastest_interval(WS_TOPIC_TELEMETRY);
+    if (telemetryInterval > 0 && telemetryInterval < readInterval) readInterval = telemetryInterval;
+    scheduler_set_period(sensorTaskId, readInterval);
+
+    publishDueTopics(currentMillis);
+}
 
-    Serial.println("\n--- I2C Scanner Selesai ---");
-    delay(1000);
+// Perubahan link dari modul 'wifi_service' (task jaringan). Server web dimulai saat
+// link pertama kali naik; setelah itu tetap listen melewati putus-sambung WiFi.
+static bool webServerStarted = false;
+void onWifiLink(bool online) {
+    if (!online) {
+        boot_set_state(BOOT_OFFLINE);
+        return;
+    }
+    linkUpMillis = millis();
+    if (!webServerStarted) {
+        boot_stage_end(BOOT_STAGE_WIFI);
+        boot_stage_begin(BOOT_STAGE_WEB);
+        server.begin(); // Mulai server web dan WebSocket
+        boot_stage_end(BOOT_STAGE_WEB);
+        webServerStarted = true;
+    }
+    boot_set_state(BOOT_ONLINE);
+    Serial.print("[WiFi] Server web aktif. Silakan akses: ");
+    Serial.println(WiFi.localIP()); // IPAddress dicetak langsung, tanpa String sementara
+}
 
-    return foundAddresses;
+void setupMainTasks() {
+    scheduler_add_periodic("ws", wsTask, 0, TASK_PRIORITY_NORMAL, SCHED_GROUP_NETWORK);
+    scheduler_add_periodic("topics", topicsTask, TOPIC_TASK_INTERVAL, TASK_PRIORITY_NORMAL, SCHED_GROUP_NETWORK);
+    scheduler_add_periodic("webApi", webApiTask, WEB_API_TASK_INTERVAL, TASK_PRIORITY_NORMAL, SCHED_GROUP_NETWORK);
+    sensorTaskId = scheduler_add_periodic("sensors", sensorTask, sensorReadInterval, TASK_PRIORITY_LOW, SCHED_GROUP_IO);
+    scheduler_add_periodic("lcdRotate", displayRotateTask, SENSOR_DISPLAY_ROTATE_INTERVAL, TASK_PRIORITY_LOW, SCHED_GROUP_IO);
 }
 
 // --- Bagian 11: Fungsi Setup (Inisialisasi) ---
+// Boot bertahap: tahap hardware dijalankan berurutan tanpa delay, lalu task kontrol
+// langsung dimulai sehingga tombol & kartu RFID bisa memesan sebelum WiFi terhubung.
+// WiFi & server web diselesaikan di latar belakang oleh modul 'wifi_service'.
 void setup() {
+    Serial.setTxBufferSize(LOG_SERIAL_TX_BUFFER); // Harus sebelum begin(); dipakai task "logDrain"
     Serial.begin(115200); // Mengatur baud rate Serial Monitor
 
     // --- Log Pembuka Setup ---
@@ -172,10 +539,19 @@ void setup() {
     Serial.println("[SETUP START] Memulai Inisialisasi Sistem Kopi");
     Serial.println("====================================================");
 
+    // loopTask menjadi task IO sebelum komponen mendaftarkan task
+    boot_stage_begin(BOOT_STAGE_CORE);
+    setupRtosTasks();
+    setupLogger();
+    setupPerfProbe();
+    setupMemoryMonitor();
+    boot_stage_end(BOOT_STAGE_CORE);
+
     // --- [1] Inisialisasi I2C Bus & Perangkat ---
     Serial.println("\n--- [1] Inisialisasi I2C Bus & Perangkat ---");
-    Wire.begin(21, 22); // SDA di GPIO 21, SCL di GPIO 22
+    boot_stage_begin(BOOT_STAGE_I2C);
     Serial.println("Inisialisasi I2C Bus...");
+    setupI2cBus(); // Satu-satunya Wire.begin(): SDA GPIO 21, SCL GPIO 22, clock sesuai perangkat
 
     // Setup LCD Display
     setupLCD(); // Fungsi ini sudah mencetak "LCD terinisialisasi."
@@ -184,71 +560,52 @@ void setup() {
     lcd.print("Mesin Kopi Smart");
     lcd.setCursor(0, 1);
     lcd.print("Booting...");
-    delay(1000);
-
-    // --- Panggil fungsi I2C Scanner di awal startup ---
-    Serial.println("Memulai I2C Scanner...");
-    std::vector<String> addresses = i2cScanner();
-
-    // --- Buat string JSON dari hasil scan I2C untuk WebSocket ---
-    if (addresses.empty()) {
-        i2cScanResultsJson = "{\"type\":\"i2cScan\",\"addresses\":[]}";
-        Serial.println("I2C Scan: Tidak ada perangkat I2C ditemukan.");
-    } else {
-        Serial.println("I2C Scan berhasil, alamat ditemukan: " + String(addresses.size()));
-    }
-    i2cScanResultsJson = "{\"type\":\"i2cScan\",\"addresses\":[";
-    for (size_t i = 0; i < addresses.size(); ++i) {
-        i2cScanResultsJson += "\"" + addresses[i] + "\"";
-        if (i < addresses.size() - 1) {
-            i2cScanResultsJson += ",";
-        }
-    }
-    i2cScanResultsJson += "]}";
-    Serial.println("I2C Scan JSON untuk Web: " + i2cScanResultsJson);
-    Serial.println("Melanjutkan setup setelah I2C scan...");
-    lcd.clear();
-    lcd.setCursor(0, 0);
-    lcd.print("Setup Devices...");
+
+    // Scan I2C hanya dijadwalkan; berjalan bertahap di loopTask setelah setup() selesai,
+    // dan hasilnya dikirim ke klien web oleh task jaringan (lihat publishI2cScan()).
+    setupI2cScanner();
+    boot_stage_end(BOOT_STAGE_I2C);
 
     // --- [2] Inisialisasi Komponen Hardware ---
     Serial.println("\n--- [2] Inisialisasi Komponen Hardware ---");
 
     Serial.println("\n--- [2.1] Modul PCF8574 ---");
+    boot_stage_begin(BOOT_STAGE_ACTUATORS);
     // Inisialisasi Motor Control (PCF8574 0x20)
     Serial.println("Menginisialisasi PCF8574 (0x20 - Motor Control)...");
     setupMotorControl(PCF8574_MOTOR_CONTROL_ADDRESS);
-    Serial.println("PCF8574 (Motor Control) OK!");
-    Serial.println("Motor Control pins configured (termasuk LM298N ENA/ENB & semua pompa).");
     Serial.println("Motor Control (PCF8574 0x20) siap digunakan.");
 
     // Inisialisasi Order Coffee Front Panel (PCF8574 0x21)
     Serial.println("\nMenginisialisasi PCF8574 (0x21 - Order Coffee Front Panel)...");
     setupOrderCoffee(PCF8574_FRONT_PANEL_ADDRESS);
-    Serial.println("PCF8574 (Order Coffee Front Panel) OK!");
-    Serial.println("Order Coffee Front Panel pins configured.");
     Serial.println("Order Coffee (PCF8574 0x21) siap digunakan.");
+    boot_stage_end(BOOT_STAGE_ACTUATORS);
 
     Serial.println("\n--- [2.2] Modul Komunikasi & Sensor ---");
+    boot_stage_begin(BOOT_STAGE_SENSORS);
     // Inisialisasi Bus SPI (untuk RFID)
     Serial.println("Inisialisasi SPI Bus...");
-    SPI.begin();
+    hal_spi_begin();
 
     // Inisialisasi Modul RFID RC522
     setupRfidCardReader();
-    Serial.println("Inisialisasi RFID RC522 selesai.");
     Serial.println("RFID Reader terintegrasi OK!");
 
-    // Inisialisasi Sensor DHT22
+    // Inisialisasi Sensor DHT22 (pembacaan pertama oleh task "dht", tanpa menunggu di sini)
     setupTemperatureHumidity();
-    Serial.println("DHT22 Sensor diinisialisasi.");
-    Serial.println("DHT22 Sensor terintegrasi OK!");
 
     // Inisialisasi semua sensor jarak (Storage Detectors)
     storage_detector_init_all_sensors();
     Serial.println("Semua Sensor Detektor Penyimpanan berhasil diinisialisasi.");
+    boot_stage_end(BOOT_STAGE_SENSORS);
 
     Serial.println("\n--- [2.3] Sistem File (SPIFFS) ---");
+    boot_stage_begin(BOOT_STAGE_STORAGE);
+#ifdef DASHBOARD_EMBEDDED
+    // Dashboard tertanam di firmware, SPIFFS tidak dibutuhkan saat boot
+    Serial.println("Dashboard tertanam di firmware, SPIFFS dilewati.");
+#else
     // Inisialisasi SPIFFS untuk melayani file web
     if (!SPIFFS.begin(true)) {
         Serial.println("Gagal mount SPIFFS. Pastikan sudah di-upload!");
@@ -257,186 +614,55 @@ void setup() {
         while (true); // Hentikan eksekusi jika SPIFFS gagal
     }
     Serial.println("SPIFFS berhasil dimount.");
+#endif
+    boot_stage_end(BOOT_STAGE_STORAGE);
 
-    // --- [3] Konektivitas Jaringan ---
+    // --- [3] Konektivitas Jaringan (dimulai, tidak ditunggu) ---
     Serial.println("\n--- [3] Konektivitas Jaringan ---");
-    Serial.println("Inisialisasi WiFi...");
-    Serial.println("Menghubungkan ke WiFi.....");
-    lcd.clear();
-    lcd.setCursor(0, 0);
-    lcd.print("Connecting to WiFi ");
-    lcd.setCursor(0, 1);
+    // Handler didaftarkan sekarang; server.begin() dipanggil oleh onWifiLink()
+    // setelah WiFi terhubung.
+    ws.onEvent(onWsEvent);
+    event_bus_subscribe(onBusEvent); // Teruskan event komponen ke klien web
+    server.addHandler(&ws);
 
-    // Koneksi WiFi dengan Timeout
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, password);
-
-    unsigned long connectionAttemptStart = millis();
-    const long CONNECTION_TIMEOUT_MS = 30000; // Timeout 30 detik
-
-    int dot_count = 0;
-    while (WiFi.status() != WL_CONNECTED) {
-        delay(500);
-        Serial.print(".");
-        lcd.print(".");
-        dot_count++;
-        if (dot_count >= 10) {
-            lcd.setCursor(0, 1);
-            lcd.print("          "); // Clear 10 spaces
-            lcd.setCursor(0, 1);
-            dot_count = 0;
-        }
+    // Endpoint REST API untuk integrasi kasir (POS)
+    setupWebApi(server);
 
-        if (millis() - connectionAttemptStart > CONNECTION_TIMEOUT_MS) {
-            Serial.println("\nKoneksi WiFi Timeout!");
-            lcd.clear();
-            lcd.setCursor(0, 0);
-            lcd.print("WiFi FAILED!");
-            lcd.setCursor(0, 1);
-            lcd.print("Check SSID/Pass!");
-            while (true); // Hentikan eksekusi jika WiFi gagal setelah timeout
-        }
+    // Handler untuk melayani aset web (index.html) versi gzip dari SPIFFS
+    // (atau dari flash pada mode DASHBOARD_EMBEDDED), lengkap dengan ETag & Cache-Control (lihat scripts/compress_assets.py)
+    if (!setupWebAssets(server)) {
+        Serial.println("Aset web tidak tersedia, dashboard tidak dapat dibuka.");
     }
-    Serial.println(); // Baris baru setelah titik-titik koneksi
 
-    // Koneksi WiFi Berhasil
-    Serial.println("WiFi Berhasil Terhubung!");
-    Serial.print("  IP Address: ");
-    Serial.println(WiFi.localIP());
-    Serial.print("  Kekuatan Sinyal (RSSI): ");
-    Serial.print(WiFi.RSSI());
-    Serial.println(" dBm");
+    // Koneksi, reconnect & backoff dijalankan task "wifi" (grup jaringan)
+    boot_stage_begin(BOOT_STAGE_WIFI);
+    setupWifiService(ssid, password, onWifiLink);
 
-    lcd.clear();
-    lcd.setCursor(0, 0);
-    lcd.print("WiFi Connected!");
-    lcd.setCursor(0, 1);
-    lcd.print("IP: ");
-    lcd.print(WiFi.localIP());
+    // --- [4] Task RTOS: Mesin Siap Menerima Pesanan Lokal ---
+    boot_stage_begin(BOOT_STAGE_TASKS);
+    // Task jaringan & sensor milik main.cpp (task komponen sudah didaftarkan di setup masing-masing)
+    setupMainTasks();
 
-    // --- Konfigurasi WebSocket dan Server Web ---
-    ws.onEvent(onWsEvent);
-    server.addHandler(&ws);
-
-    // Handler untuk melayani file index.html dari SPIFFS
-    server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(SPIFFS, "/index.html", "text/html");
-    });
+    // Set tampilan awal LCD ke idle menu
+    displayIdleMenu();
 
-    // Mulai server web dan WebSocket
-    server.begin();
-    Serial.println("Server web dimulai.");
-    lcd.setCursor(0, 2);
-    lcd.print("Server Started!");
+    // Task kontrol & jaringan mulai berjalan; loop() menjadi task IO
+    if (!startRtosTasks()) {
+        Serial.println("[SETUP] Task RTOS gagal dibuat, sistem dihentikan.");
+        while (true) delay(1000);
+    }
+    boot_stage_end(BOOT_STAGE_TASKS);
+    boot_set_state(BOOT_LOCAL_READY);
 
     // --- Log Penutup Setup ---
-    delay(2000);
     Serial.println("\n====================================================");
-    Serial.println("[SETUP SELESAI] Sistem siap digunakan.");
-    Serial.println("Silakan akses server web di: " + WiFi.localIP().toString());
+    Serial.println("[SETUP SELESAI] Tombol & kartu RFID siap, WiFi menyusul.");
     Serial.println("====================================================");
-
-    // Set tampilan awal LCD ke idle menu
-    displayIdleMenu();
 }
 
 // --- Bagian 12: Fungsi Loop (Eksekusi Berulang) ---
+// loopTask hanya menjalankan grup IO (sensor, RFID, DHT, LCD); grup kontrol & jaringan
+// dijalankan oleh task FreeRTOS masing-masing. Statistik tersedia di GET /api/tasks.
 void loop() {
-    // Membersihkan koneksi WebSocket yang terputus
-        ws.cleanupClients();
-
-    // Dapatkan waktu saat ini
-        unsigned long currentMillis = millis();
-
-    // --- Panggil Fungsi Handle dari Komponen order_coffee ---
-        handleOrderCoffee();
-
-    // --- Panggil Fungsi Handle dari Komponen rfid_card_reader ---
-        handleRfidCardReader(currentMillis);
-
-    // --- Panggil Fungsi Handle dari Komponen temperature_humidity ---
-        handleTemperatureHumidity(currentMillis);
-
-    // --- Pembacaan Sensor Jarak dan Pengiriman Data ke Web ---
-        // Hanya update LCD dengan data sensor jika tidak ada menu aktif atau sedang diproses
-        if (!menuActive && !menuConfirmed) { // <<< Variabel ini sekarang extern dari order_coffee.h
-            if(currentMillis - lastSensorReadMillis >= sensorReadInterval){
-                lastSensorReadMillis = currentMillis;
-
-                long distance1 = storage_detector_get_distance(SD_TRIG_PIN_1, SD_ECHO_PIN_1);
-                long distance2 = storage_detector_get_distance(SD_TRIG_PIN_2, SD_ECHO_PIN_2);
-                long distance3 = storage_detector_get_distance(SD_TRIG_PIN_3, SD_ECHO_PIN_3);
-
-                if(distance1 == -1) distance1 = 0;
-                if(distance2 == -1) distance2 = 0;
-                if(distance3 == -1) distance3 = 0;
-
-                 // --- Update LCD untuk Baris 1 (Rotasi Data Sensor) ---
-                static unsigned long lastSensorDisplayRotateMillis = 0;
-                const long SENSOR_DISPLAY_ROTATE_INTERVAL = 3000; // Rotasi setiap 3 detik
-                static int sensorDisplayMode = 0; // 0=Jarak, 1=DHT, 2=RFID/Motor
-
-                if (currentMillis - lastSensorDisplayRotateMillis >= SENSOR_DISPLAY_ROTATE_INTERVAL) {
-                    lastSensorDisplayRotateMillis = currentMillis;
-                    sensorDisplayMode = (sensorDisplayMode + 1) % 3; // Rotasi antara 0, 1, 2
-                }
-
-                // --- Mengirim Data ke Klien WebSocket ---
-                String json = "{\"distance1\":";
-                json += distance1;
-                json += ",\"distance2\":";
-                json += distance2;
-                json += ",\"distance3\":";
-                json += distance3;
-
-                // --- Tambahkan status RFID UID ---
-                json += ",\"rfidUid\":\"";
-                json += currentRfidUid;
-                json += "\"";
-
-                // --- Tambahkan status Suhu dan Kelembaban ---
-                json += ",\"temperature\":";
-                json += String(currentTemperature, 1); // Format ke 1 desimal
-                json += ",\"humidity\":";
-                json += String(currentHumidity, 0); // Format ke 0 desimal
-                json += "}";
-
-                ws.textAll(json); // Kirim JSON ke semua klien WebSocket yang terhubung
-                // Serial.println("Data terkirim: " + json); // Aktifkan untuk debugging
-            }
-        } else {
-            // Jika menu aktif atau sedang diproses, jangan tampilkan data sensor di baris 1 LCD
-            // LCD sudah diupdate oleh handleOrderCoffee() saat menu dipilih/dikonfirmasi
-            // Namun, tetap kirim data ke web agar web tetap update
-            if(currentMillis - lastSensorReadMillis >= sensorReadInterval){
-                lastSensorReadMillis = currentMillis;
-
-                long distance1 = storage_detector_get_distance(SD_TRIG_PIN_1, SD_ECHO_PIN_1);
-                long distance2 = storage_detector_get_distance(SD_TRIG_PIN_2, SD_ECHO_PIN_2);
-                long distance3 = storage_detector_get_distance(SD_TRIG_PIN_3, SD_ECHO_PIN_3);
-
-                if(distance1 == -1) distance1 = 0;
-                if(distance2 == -1) distance2 = 0;
-                if(distance3 == -1) distance3 = 0;
-
-                String json = "{\"distance1\":";
-                json += distance1;
-                json += ",\"distance2\":";
-                json += distance2;
-                json += ",\"distance3\":";
-                json += distance3;
-
-                json += ",\"rfidUid\":\"";
-                json += currentRfidUid;
-                json += "\"";
-
-                json += ",\"temperature\":";
-                json += String(currentTemperature, 1);
-                json += ",\"humidity\":";
-                json += String(currentHumidity, 0);
-
-                json += "}";
-                ws.textAll(json);
-            }
-        }
-}
\ No newline at end of file
+    runIoTaskPass();
+}
@@ -0,0 +1,175 @@
+/*
+  test/test_ws_command/test_ws_command.cpp - Uji Reassembly & Framing Parser Perintah
+  Dijalankan di env native: 'pio test -e native -f test_ws_command'.
+  Potongan frame disusun seperti yang diteruskan onWsEvent() dari AwsFrameInfo.
+*/
+
+#include <Arduino.h>
+#include <unity.h>
+#include "components/ws_command/ws_command.h"
+
+#define CLIENT_A 1
+#define CLIENT_B 2
+
+static char replyJson[WS_COMMAND_REPLY_SIZE];
+
+// --- Helper ---
+static WsFragment makeFragment(bool finalFrame, bool isText, uint64_t index, uint64_t frameLen) {
+  WsFragment fragment;
+  fragment.finalFrame = finalFrame;
+  fragment.isText = isText;
+  fragment.index = index;
+  fragment.frameLen = frameLen;
+  return fragment;
+}
+
+// Mengirim satu potongan; balasan (jika ada) ditulis ke replyJson
+static WsCommandResult sendChunk(uint32_t clientId, const WsFragment& fragment, const char* data, size_t len) {
+  JsonWriter reply(replyJson, sizeof(replyJson));
+  return ws_command_process(clientId, fragment, (const uint8_t*)data, len, reply);
+}
+
+// Satu frame teks utuh dalam satu paket
+static WsCommandResult sendText(uint32_t clientId, const char* text) {
+  size_t len = strlen(text);
+  return sendChunk(clientId, makeFragment(true, true, 0, len), text, len);
+}
+
+static void assertReplyHas(const char* expected) {
+  TEST_ASSERT_NOT_NULL_MESSAGE(strstr(replyJson, expected), replyJson);
+}
+
+void setUp() {
+  wsCommandStats = WsCommandStats{0, 0, 0, 0};
+  replyJson[0] = '\0';
+}
+
+void tearDown() {
+  ws_command_client_disconnected(CLIENT_A);
+  ws_command_client_disconnected(CLIENT_B);
+  for (uint32_t id = 10; id < 10 + WS_COMMAND_MAX_CLIENTS; id++) ws_command_client_disconnected(id);
+}
+
+// --- Framing ---
+static void test_single_frame() {
+  TEST_ASSERT_EQUAL(WS_CMD_HANDLED, sendText(CLIENT_A, "stats"));
+  assertReplyHas("\"cmd\":\"stats\"");
+  assertReplyHas("\"ok\":true");
+  TEST_ASSERT_EQUAL(1, wsCommandStats.handled);
+}
+
+static void test_frame_split_across_tcp_chunks() {
+  const char* text = "stats";
+  TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE, sendChunk(CLIENT_A, makeFragment(true, true, 0, 5), text, 2));
+  TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE, sendChunk(CLIENT_A, makeFragment(true, true, 2, 5), text + 2, 2));
+  TEST_ASSERT_EQUAL(WS_CMD_HANDLED, sendChunk(CLIENT_A, makeFragment(true, true, 4, 5), text + 4, 1));
+  assertReplyHas("\"cmd\":\"stats\"");
+}
+
+static void test_multi_frame_message() {
+  // Frame lanjutan mulai dari index 0 lagi; FIN hanya pada frame terakhir
+  TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE, sendChunk(CLIENT_A, makeFragment(false, true, 0, 3), "sta", 3));
+  TEST_ASSERT_EQUAL(WS_CMD_HANDLED, sendChunk(CLIENT_A, makeFragment(true, true, 0, 2), "ts", 2));
+  assertReplyHas("\"cmd\":\"stats\"");
+}
+
+static void test_interleaved_clients_keep_separate_buffers() {
+  TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE, sendChunk(CLIENT_A, makeFragment(false, true, 0, 3), "sta", 3));
+  TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE, sendChunk(CLIENT_B, makeFragment(false, true, 0, 3), "xyz", 3));
+  TEST_ASSERT_EQUAL(WS_CMD_HANDLED, sendChunk(CLIENT_A, makeFragment(true, true, 0, 2), "ts", 2));
+  assertReplyHas("\"cmd\":\"stats\"");
+}
+
+// --- Penolakan ---
+static void test_oversize_single_frame_rejected() {
+  char text[WS_COMMAND_MAX_LEN + 2];
+  memset(text, 'a', sizeof(text) - 1);
+  text[sizeof(text) - 1] = '\0';
+  TEST_ASSERT_EQUAL(WS_CMD_REJECTED, sendText(CLIENT_A, text));
+  assertReplyHas("\"error\":\"tooLong\"");
+  TEST_ASSERT_EQUAL(1, wsCommandStats.rejectedFrames);
+}
+
+static void test_oversize_fragmented_message_discarded() {
+  char chunk[WS_COMMAND_MAX_LEN];
+  memset(chunk, 'a', sizeof(chunk));
+  TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE,
+                    sendChunk(CLIENT_A, makeFragment(false, true, 0, sizeof(chunk)), chunk, sizeof(chunk)));
+  // Potongan yang melewati batas dibuang, tetapi pesan baru ditolak saat FIN diterima
+  TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE, sendChunk(CLIENT_A, makeFragment(false, true, 0, 4), "aaaa", 4));
+  TEST_ASSERT_EQUAL(WS_CMD_REJECTED, sendChunk(CLIENT_A, makeFragment(true, true, 0, 4), "aaaa", 4));
+  assertReplyHas("\"error\":\"tooLong\"");
+
+  // Slot dilepas: perintah berikutnya kembali diproses normal
+  TEST_ASSERT_EQUAL(WS_CMD_HANDLED, sendText(CLIENT_A, "stats"));
+}
+
+static void test_binary_frame_rejected() {
+  const uint8_t data[] = {0x00, 0xFF, 0x10};
+  JsonWriter reply(replyJson, sizeof(replyJson));
+  TEST_ASSERT_EQUAL(WS_CMD_REJECTED,
+                    ws_command_process(CLIENT_A, makeFragment(true, false, 0, sizeof(data)), data, sizeof(data), reply));
+  assertReplyHas("\"error\":\"binary\"");
+}
+
+static void test_bad_char_rejected() {
+  TEST_ASSERT_EQUAL(WS_CMD_REJECTED, sendText(CLIENT_A, "stats\t"));
+  assertReplyHas("\"error\":\"badChar\"");
+}
+
+static void test_too_many_args_rejected() {
+  TEST_ASSERT_EQUAL(WS_CMD_REJECTED, sendText(CLIENT_A, "recipe 1 water 100 200 300"));
+  assertReplyHas("\"error\":\"tooManyArgs\"");
+}
+
+static void test_bad_args_rejected() {
+  TEST_ASSERT_EQUAL(WS_CMD_REJECTED, sendText(CLIENT_A, "order"));
+  assertReplyHas("\"cmd\":\"order\"");
+  assertReplyHas("\"error\":\"badArgs\"");
+  TEST_ASSERT_EQUAL(1, wsCommandStats.failed);
+}
+
+static void test_unknown_command_rejected() {
+  TEST_ASSERT_EQUAL(WS_CMD_REJECTED, sendText(CLIENT_A, "brew now"));
+  assertReplyHas("\"error\":\"unknownCommand\"");
+  TEST_ASSERT_EQUAL(1, wsCommandStats.unknownCommands);
+}
+
+// --- Slot Reassembly ---
+static void test_disconnect_releases_slot() {
+  // Pesan setengah jadi tidak boleh tersambung ke pesan klien berikutnya dengan ID yang sama
+  TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE, sendChunk(CLIENT_A, makeFragment(false, true, 0, 3), "xyz", 3));
+  ws_command_client_disconnected(CLIENT_A);
+  TEST_ASSERT_EQUAL(WS_CMD_HANDLED, sendText(CLIENT_A, "stats"));
+  assertReplyHas("\"cmd\":\"stats\"");
+}
+
+static void test_disconnect_frees_slot_for_other_client() {
+  for (uint32_t id = 10; id < 10 + WS_COMMAND_MAX_CLIENTS; id++) {
+    TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE, sendChunk(id, makeFragment(false, true, 0, 3), "sta", 3));
+  }
+  TEST_ASSERT_EQUAL(WS_CMD_REJECTED, sendChunk(CLIENT_B, makeFragment(false, true, 0, 3), "sta", 3));
+  assertReplyHas("\"error\":\"busy\"");
+
+  ws_command_client_disconnected(10);
+  TEST_ASSERT_EQUAL(WS_CMD_INCOMPLETE, sendChunk(CLIENT_B, makeFragment(false, true, 0, 3), "sta", 3));
+  TEST_ASSERT_EQUAL(WS_CMD_HANDLED, sendChunk(CLIENT_B, makeFragment(true, true, 0, 2), "ts", 2));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_single_frame);
+  RUN_TEST(test_frame_split_across_tcp_chunks);
+  RUN_TEST(test_multi_frame_message);
+  RUN_TEST(test_interleaved_clients_keep_separate_buffers);
+  RUN_TEST(test_oversize_single_frame_rejected);
+  RUN_TEST(test_oversize_fragmented_message_discarded);
+  RUN_TEST(test_binary_frame_rejected);
+  RUN_TEST(test_bad_char_rejected);
+  RUN_TEST(test_too_many_args_rejected);
+  RUN_TEST(test_bad_args_rejected);
+  RUN_TEST(test_unknown_command_rejected);
+  RUN_TEST(test_disconnect_releases_slot);
+  RUN_TEST(test_disconnect_frees_slot_for_other_client);
+  return UNITY_END();
+}